@@ -22,9 +22,11 @@
 #include "core/fpdfapi/parser/cpdf_number.h"
 #include "core/fpdfapi/parser/cpdf_parser.h"
 #include "core/fpdfapi/parser/cpdf_security_handler.h"
+#include "core/fpdfapi/parser/cpdf_stream.h"
 #include "core/fpdfapi/parser/cpdf_string.h"
 #include "core/fpdfapi/parser/fpdf_parser_utility.h"
 #include "core/fpdfapi/parser/object_tree_traversal_util.h"
+#include "core/fxcrt/cfx_threadpool.h"
 #include "core/fxcrt/check.h"
 #include "core/fxcrt/containers/contains.h"
 #include "core/fxcrt/fixed_size_data_vector.h"
@@ -39,6 +41,11 @@ namespace {
 
 const size_t kArchiveBufferSize = 32768;
 
+// Limits on how much gets queued for compression on the thread pool. Enough
+// to keep the threads busy, while bounding the memory held by the queue.
+constexpr size_t kMaxPendingObjects = 256;
+constexpr size_t kMaxPendingSize = 16 * 1024 * 1024;
+
 class CFX_FileBufferArchive final : public IFX_ArchiveStream {
  public:
   explicit CFX_FileBufferArchive(RetainPtr<IFX_RetainableWriteStream> file);
@@ -131,7 +138,18 @@ CPDF_Creator::CPDF_Creator(CPDF_Document* pDoc,
 
 CPDF_Creator::~CPDF_Creator() = default;
 
-bool CPDF_Creator::WriteIndirectObj(uint32_t objnum, const CPDF_Object* pObj) {
+CPDF_Creator::PendingObject::PendingObject() = default;
+
+CPDF_Creator::PendingObject::PendingObject(PendingObject&&) = default;
+
+CPDF_Creator::PendingObject& CPDF_Creator::PendingObject::operator=(
+    PendingObject&&) = default;
+
+CPDF_Creator::PendingObject::~PendingObject() = default;
+
+bool CPDF_Creator::WriteIndirectObj(uint32_t objnum,
+                                    const CPDF_Object* pObj,
+                                    CPDF_FlateEncoder* encoder) {
   if (!archive_->WriteDWord(objnum) || !archive_->WriteString(" 0 obj\r\n")) {
     return false;
   }
@@ -141,33 +159,81 @@ bool CPDF_Creator::WriteIndirectObj(uint32_t objnum, const CPDF_Object* pObj) {
     encryptor = std::make_unique<CPDF_Encryptor>(GetCryptoHandler(), objnum);
   }
 
-  if (!pObj->WriteTo(archive_.get(), encryptor.get())) {
+  const bool written =
+      encoder ? pObj->AsStream()->WriteEncodedTo(archive_.get(),
+                                                 encryptor.get(), *encoder)
+              : pObj->WriteTo(archive_.get(), encryptor.get());
+  if (!written) {
     return false;
   }
 
   return archive_->WriteString("\r\nendobj\r\n");
 }
 
+bool CPDF_Creator::QueueIndirectObj(uint32_t objnum,
+                                    RetainPtr<const CPDF_Object> object,
+                                    bool delete_after_writing) {
+  PendingObject pending;
+  pending.objnum = objnum;
+  if (const CPDF_Stream* stream = object->AsStream()) {
+    pending.encoder = stream->CreateEncoder(encode_options_);
+    pending_size_ += stream->GetRawSize();
+  }
+  pending.object = std::move(object);
+  pending.delete_after_writing = delete_after_writing;
+  pending_objs_.push_back(std::move(pending));
+
+  // Without a thread pool, queueing would only cost memory.
+  if (CFX_ThreadPool::GetConcurrency() > 1 &&
+      pending_objs_.size() < kMaxPendingObjects &&
+      pending_size_ < kMaxPendingSize) {
+    return true;
+  }
+  return WritePendingObjs();
+}
+
+bool CPDF_Creator::WritePendingObjs() {
+  // Compressing only touches each encoder's own data, see
+  // CPDF_FlateEncoder::Encode().
+  CFX_ThreadPool::ParallelFor(
+      pending_objs_.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          if (pending_objs_[i].encoder) {
+            pending_objs_[i].encoder->Encode();
+          }
+        }
+      });
+
+  std::vector<PendingObject> pending_objs = std::move(pending_objs_);
+  pending_objs_.clear();
+  pending_size_ = 0;
+  for (PendingObject& pending : pending_objs) {
+    object_offsets_[pending.objnum] = archive_->CurrentOffset();
+    if (!WriteIndirectObj(pending.object->GetObjNum(), pending.object.Get(),
+                          pending.encoder.get())) {
+      return false;
+    }
+    if (pending.delete_after_writing) {
+      // Release the object first, so that deleting it frees the memory.
+      pending.encoder.reset();
+      pending.object.Reset();
+      document_->DeleteIndirectObject(pending.objnum);
+    }
+  }
+  return true;
+}
+
 bool CPDF_Creator::WriteOldIndirectObject(uint32_t objnum) {
   if (parser_->IsObjectFree(objnum)) {
     return true;
   }
 
-  object_offsets_[objnum] = archive_->CurrentOffset();
-
   bool bExistInMap = !!document_->GetIndirectObject(objnum);
   RetainPtr<CPDF_Object> pObj = document_->GetOrParseIndirectObject(objnum);
   if (!pObj) {
-    object_offsets_.erase(objnum);
     return true;
   }
-  if (!WriteIndirectObj(pObj->GetObjNum(), pObj.Get())) {
-    return false;
-  }
-  if (!bExistInMap) {
-    document_->DeleteIndirectObject(objnum);
-  }
-  return true;
+  return QueueIndirectObj(objnum, std::move(pObj), !bExistInMap);
 }
 
 bool CPDF_Creator::WriteOldObjs() {
@@ -191,6 +257,9 @@ bool CPDF_Creator::WriteOldObjs() {
     }
     last_object_number_written = objnum;
   }
+  if (!WritePendingObjs()) {
+    return false;
+  }
   // If there are no new objects to write, then adjust `last_obj_num_` if
   // needed to reflect the actual last object number.
   if (new_obj_num_array_.empty()) {
@@ -207,12 +276,12 @@ bool CPDF_Creator::WriteNewObjs() {
       continue;
     }
 
-    object_offsets_[objnum] = archive_->CurrentOffset();
-    if (!WriteIndirectObj(pObj->GetObjNum(), pObj.Get())) {
+    if (!QueueIndirectObj(objnum, std::move(pObj),
+                          /*delete_after_writing=*/false)) {
       return false;
     }
   }
-  return true;
+  return WritePendingObjs();
 }
 
 void CPDF_Creator::InitNewObjNumOffsets() {
@@ -317,7 +386,8 @@ CPDF_Creator::Stage CPDF_Creator::WriteDoc_Stage2() {
     if (encrypt_dict_ && encrypt_dict_->IsInline()) {
       last_obj_num_ += 1;
       FX_FILESIZE saveOffset = archive_->CurrentOffset();
-      if (!WriteIndirectObj(last_obj_num_, encrypt_dict_.Get())) {
+      if (!WriteIndirectObj(last_obj_num_, encrypt_dict_.Get(),
+                            /*encoder=*/nullptr)) {
         return Stage::kInvalid;
       }
 
@@ -689,6 +759,11 @@ bool CPDF_Creator::SetFileVersion(int32_t fileVersion) {
   return true;
 }
 
+void CPDF_Creator::SetEncodeOptions(
+    const FlateModule::EncodeOptions& options) {
+  encode_options_ = options;
+}
+
 void CPDF_Creator::RemoveSecurity() {
   security_handler_.Reset();
   security_changed_ = true;
@@ -11,6 +11,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/fxcodec/flate/flatemodule.h"
 #include "core/fxcrt/fx_stream.h"
 #include "core/fxcrt/retain_ptr.h"
 #include "core/fxcrt/unowned_ptr.h"
@@ -20,6 +21,7 @@ class CPDF_CryptoHandler;
 class CPDF_SecurityHandler;
 class CPDF_Dictionary;
 class CPDF_Document;
+class CPDF_FlateEncoder;
 class CPDF_Object;
 class CPDF_Parser;
 
@@ -36,6 +38,11 @@ class CPDF_Creator {
   bool Create(uint32_t flags);
   bool SetFileVersion(int32_t fileVersion);
 
+  // Applies to the streams that get compressed when writing. Independent
+  // streams get compressed on CFX_ThreadPool, if there is one, but the output
+  // is the same either way.
+  void SetEncodeOptions(const FlateModule::EncodeOptions& options);
+
  private:
   enum class Stage {
     kInvalid = -1,
@@ -65,10 +72,32 @@ class CPDF_Creator {
   CPDF_Creator::Stage WriteDoc_Stage3();
   CPDF_Creator::Stage WriteDoc_Stage4();
 
+  // An object queued by QueueIndirectObj().
+  struct PendingObject {
+    PendingObject();
+    PendingObject(PendingObject&&);
+    PendingObject& operator=(PendingObject&&);
+    ~PendingObject();
+
+    uint32_t objnum = 0;
+    RetainPtr<const CPDF_Object> object;
+    std::unique_ptr<CPDF_FlateEncoder> encoder;  // Only set for streams.
+    bool delete_after_writing = false;
+  };
+
   bool WriteOldIndirectObject(uint32_t objnum);
   bool WriteOldObjs();
   bool WriteNewObjs();
-  bool WriteIndirectObj(uint32_t objnum, const CPDF_Object* pObj);
+  bool WriteIndirectObj(uint32_t objnum,
+                        const CPDF_Object* pObj,
+                        CPDF_FlateEncoder* encoder);
+
+  // Writing goes through a queue, so that the streams in it can be compressed
+  // in parallel. Objects still get written in the order they were queued.
+  bool QueueIndirectObj(uint32_t objnum,
+                        RetainPtr<const CPDF_Object> object,
+                        bool delete_after_writing);
+  bool WritePendingObjs();
 
   CPDF_CryptoHandler* GetCryptoHandler();
 
@@ -85,6 +114,9 @@ class CPDF_Creator {
   FX_FILESIZE xref_start_ = 0;
   std::map<uint32_t, FX_FILESIZE> object_offsets_;
   std::vector<uint32_t> new_obj_num_array_;  // Sorted, ascending.
+  std::vector<PendingObject> pending_objs_;
+  size_t pending_size_ = 0;  // Raw size of the streams in `pending_objs_`.
+  FlateModule::EncodeOptions encode_options_;
   RetainPtr<CPDF_Array> id_array_;
   int32_t file_version_ = 0;
   bool security_changed_ = false;
@@ -6,6 +6,7 @@
 
 #include <string>
 
+#include "core/fxcrt/cfx_threadpool.h"
 #include "public/cpp/fpdf_scopers.h"
 #include "public/fpdf_annot.h"
 #include "public/fpdf_edit.h"
@@ -18,6 +19,19 @@
 
 class CPDFCreatorEmbedderTest : public EmbedderTest {};
 
+TEST_F(CPDFCreatorEmbedderTest, SavedDocsAreEqualWithThreadPool) {
+  ASSERT_TRUE(OpenDocument("annotation_stamp_with_ap.pdf"));
+  EXPECT_TRUE(FPDF_SaveAsCopy(document(), this, 0));
+  const std::string saved_doc_1 = GetString();
+  ClearString();
+
+  // Streams now get compressed in parallel, but must come out the same.
+  CFX_ThreadPool::InitializeGlobals(3);
+  EXPECT_TRUE(FPDF_SaveAsCopy(document(), this, 0));
+  CFX_ThreadPool::DestroyGlobals();
+  EXPECT_EQ(saved_doc_1, GetString());
+}
+
 TEST_F(CPDFCreatorEmbedderTest, SavedDocsAreEqualAfterParse) {
   ASSERT_TRUE(OpenDocument("annotation_stamp_with_ap.pdf"));
   // Save without additional data reading.
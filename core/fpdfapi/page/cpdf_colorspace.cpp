@@ -228,6 +228,7 @@ class CPDF_ICCBasedCS final : public CPDF_BasedCS {
                           int image_height,
                           bool bTransMask) const override;
   bool IsNormal() const override;
+  bool CanTranslateConcurrently() const override;
   uint32_t v_Load(CPDF_Document* pDoc,
                   const CPDF_Array* pArray,
                   std::set<const CPDF_Object*>* pVisited) override;
@@ -679,6 +680,15 @@ bool CPDF_ColorSpace::IsNormal() const {
          GetFamily() == Family::kCalGray || GetFamily() == Family::kCalRGB;
 }
 
+bool CPDF_ColorSpace::CanTranslateConcurrently() const {
+  // These only read state that loading them set up.
+  return GetFamily() == Family::kDeviceGray ||
+         GetFamily() == Family::kDeviceRGB ||
+         GetFamily() == Family::kDeviceCMYK ||
+         GetFamily() == Family::kCalGray || GetFamily() == Family::kCalRGB ||
+         GetFamily() == Family::kLab;
+}
+
 const CPDF_PatternCS* CPDF_ColorSpace::AsPatternCS() const {
   return nullptr;
 }
@@ -1079,6 +1089,15 @@ bool CPDF_ICCBasedCS::IsNormal() const {
   return false;
 }
 
+bool CPDF_ICCBasedCS::CanTranslateConcurrently() const {
+  // IccTransform is thread-safe, and TranslateImageLine() builds `cache_` on
+  // first use.
+  if (profile_->IsSRGB() || profile_->IsSupported()) {
+    return true;
+  }
+  return base_cs_ && base_cs_->CanTranslateConcurrently();
+}
+
 bool CPDF_ICCBasedCS::FindAlternateProfile(
     CPDF_Document* pDoc,
     const CPDF_Dictionary* dict,
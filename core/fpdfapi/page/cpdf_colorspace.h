@@ -125,8 +125,14 @@ class CPDF_ColorSpace : public Retainable, public Observable {
                                   int image_height,
                                   bool bTransMask) const;
   virtual void EnableStdConversion(bool bEnabled);
+  bool IsStdConversionEnabled() const { return std_conversion_ != 0; }
   virtual bool IsNormal() const;
 
+  // Returns whether TranslateImageLine() and GetRGB() may run on several
+  // threads at once, after TranslateImageLine() ran on one thread to set up
+  // any state it creates on first use.
+  virtual bool CanTranslateConcurrently() const;
+
   // Returns `this` as a CPDF_PatternCS* if `this` is a pattern.
   virtual const CPDF_PatternCS* AsPatternCS() const;
 
@@ -146,7 +152,6 @@ class CPDF_ColorSpace : public Retainable, public Observable {
   // components count.
   void SetComponentsForStockCS(uint32_t nComponents);
 
-  bool IsStdConversionEnabled() const { return std_conversion_ != 0; }
   bool HasSameArray(const CPDF_Object* pObj) const { return array_ == pObj; }
 
  private:
@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -28,11 +29,13 @@
 #include "core/fpdfapi/parser/fpdf_parser_decode.h"
 #include "core/fpdfapi/parser/fpdf_parser_utility.h"
 #include "core/fxcodec/basic/basicmodule.h"
+#include "core/fxcodec/downsampling_scanlinedecoder.h"
 #include "core/fxcodec/icc/icc_transform.h"
 #include "core/fxcodec/jbig2/jbig2_decoder.h"
 #include "core/fxcodec/jpeg/jpegmodule.h"
 #include "core/fxcodec/jpx/cjpx_decoder.h"
 #include "core/fxcodec/scanlinedecoder.h"
+#include "core/fxcrt/cfx_threadpool.h"
 #include "core/fxcrt/check.h"
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/compiler_specific.h"
@@ -43,10 +46,17 @@
 #include "core/fxcrt/stl_util.h"
 #include "core/fxcrt/zip.h"
 #include "core/fxge/calculate_pitch.h"
+#include "core/fxge/dib/cfx_cmyk_to_srgb.h"
 #include "core/fxge/dib/cfx_dibitmap.h"
 
 namespace {
 
+// Images with fewer pixels are converted a row at a time as they are used.
+constexpr size_t kMinParallelConversionPixels = 1024 * 1024;
+
+// Rows are handed to threads in groups of about this many pixels.
+constexpr size_t kParallelConversionGrainPixels = 64 * 1024;
+
 bool IsValidDimension(int value) {
   static constexpr int kMaxImageDimension = 0x01FFFF;
   return value > 0 && value <= kMaxImageDimension;
@@ -307,11 +317,13 @@ CPDF_DIB::LoadState CPDF_DIB::StartLoadDIBBase(
     bool bStdCS,
     CPDF_ColorSpace::Family GroupFamily,
     bool bLoadMask,
-    const CFX_Size& max_size_required) {
+    const CFX_Size& max_size_required,
+    const FX_RECT& decode_area) {
   std_cs_ = bStdCS;
   has_mask_ = bHasMask;
   group_family_ = GroupFamily;
   load_mask_ = bLoadMask;
+  decode_area_ = decode_area;
 
   if (!stream_->IsInline()) {
     pFormResources = nullptr;
@@ -538,6 +550,19 @@ bool CPDF_DIB::GetDecodeAndMaskArray() {
           (comp_data_[i].decode_step_ - comp_data_[i].decode_min_) / max_data;
     }
   }
+  if (!default_decode_ && family_ == CPDF_ColorSpace::Family::kDeviceCMYK &&
+      components_ == 4) {
+    cmyk_decode_table_ = DataVector<uint8_t>(4 * 256);
+    for (uint32_t i = 0; i < components_; i++) {
+      for (int data = 0; data < 256; data++) {
+        const float value = std::clamp(comp_data_[i].decode_min_ +
+                                           comp_data_[i].decode_step_ * data,
+                                       0.0f, 1.0f);
+        cmyk_decode_table_[i * 256 + data] =
+            static_cast<uint8_t>(FXSYS_roundf(value * 255));
+      }
+    }
+  }
   if (dict_->KeyExist("SMask")) {
     return true;
   }
@@ -595,18 +620,38 @@ CPDF_DIB::LoadState CPDF_DIB::CreateDecoder(uint8_t resolution_levels_to_skip) {
   } else if (decoder == "FlateDecode") {
     decoder_ = CreateFlateDecoder(src_span, GetWidth(), GetHeight(),
                                   components_, bpc_, pParams);
+  } else if (decoder == "LZWDecode") {
+    decoder_ = CreateLZWDecoder(src_span, GetWidth(), GetHeight(), components_,
+                                bpc_, pParams);
   } else if (decoder == "RunLengthDecode") {
     decoder_ = BasicModule::CreateRunLengthDecoder(
         src_span, GetWidth(), GetHeight(), components_, bpc_);
   } else if (decoder == "DCTDecode") {
-    if (!CreateDCTDecoder(src_span, pParams)) {
+    const uint8_t jpeg_levels_to_skip = std::min(
+        resolution_levels_to_skip, JpegModule::kMaxResolutionLevelsToSkip);
+    if (!CreateDCTDecoder(src_span, pParams, jpeg_levels_to_skip)) {
       return LoadState::kFail;
     }
+    if (decoder_ && jpeg_levels_to_skip > 0) {
+      // As with JPX, the image shrinks to the decoded size.
+      ScaleDown(jpeg_levels_to_skip);
+      resolution_levels_to_skip -= jpeg_levels_to_skip;
+    }
   }
   if (!decoder_) {
     return LoadState::kFail;
   }
 
+  // Shrink whatever resolution the decoder could not skip row by row, so
+  // huge images are never converted at full size.
+  resolution_levels_to_skip = std::min(
+      resolution_levels_to_skip, DownsamplingScanlineDecoder::kMaxLevels);
+  if (resolution_levels_to_skip > 0 && CanDownsampleRows()) {
+    decoder_ = std::make_unique<DownsamplingScanlineDecoder>(
+        std::move(decoder_), resolution_levels_to_skip);
+    ScaleDown(resolution_levels_to_skip);
+  }
+
   const std::optional<uint32_t> requested_pitch =
       fxge::CalculatePitch8(bpc_, components_, GetWidth());
   if (!requested_pitch.has_value()) {
@@ -623,11 +668,43 @@ CPDF_DIB::LoadState CPDF_DIB::CreateDecoder(uint8_t resolution_levels_to_skip) {
   return LoadState::kSuccess;
 }
 
+bool CPDF_DIB::CanDownsampleRows() const {
+  // Averaging pixels needs components that vary smoothly, which rules out
+  // palette indices, color keys and 1-bit masks.
+  if (image_mask_ || color_key_ || bpc_ != 8 || !color_space_ ||
+      family_ == CPDF_ColorSpace::Family::kIndexed ||
+      decoder_->CountComps() != static_cast<int>(components_) ||
+      !DownsamplingScanlineDecoder::CanDownsample(*decoder_)) {
+    return false;
+  }
+
+  // Smaller images get cached whole anyway, so keep rendering them exactly.
+  FX_SAFE_SIZE_T size = GetWidth();
+  size *= GetHeight();
+  size *= components_;
+  return size.ValueOrDefault(kHugeImageSize) >= kHugeImageSize;
+}
+
+void CPDF_DIB::ScaleDown(uint8_t levels) {
+  // Round up like the decoders do, so their rows are never narrower than the
+  // image.
+  const int scale = 1 << levels;
+  SetWidth((GetWidth() + scale - 1) / scale);
+  SetHeight((GetHeight() + scale - 1) / scale);
+  if (!decode_area_.IsEmpty()) {
+    decode_area_ = FX_RECT(decode_area_.left / scale, decode_area_.top / scale,
+                           (decode_area_.right + scale - 1) / scale,
+                           (decode_area_.bottom + scale - 1) / scale);
+  }
+}
+
 bool CPDF_DIB::CreateDCTDecoder(pdfium::span<const uint8_t> src_span,
-                                const CPDF_Dictionary* pParams) {
+                                const CPDF_Dictionary* pParams,
+                                uint8_t resolution_levels_to_skip) {
   decoder_ = JpegModule::CreateDecoder(
       src_span, GetWidth(), GetHeight(), components_,
-      !pParams || pParams->GetIntegerFor("ColorTransform", 1));
+      !pParams || pParams->GetIntegerFor("ColorTransform", 1),
+      resolution_levels_to_skip, decode_area_);
   if (decoder_) {
     return true;
   }
@@ -639,6 +716,11 @@ bool CPDF_DIB::CreateDCTDecoder(pdfium::span<const uint8_t> src_span,
   }
 
   const JpegModule::ImageInfo& info = info_opt.value();
+  if (GetWidth() != static_cast<int>(info.width) ||
+      GetHeight() != static_cast<int>(info.height)) {
+    // The area no longer matches the image.
+    decode_area_ = FX_RECT();
+  }
   SetWidth(info.width);
   SetHeight(info.height);
 
@@ -650,7 +732,9 @@ bool CPDF_DIB::CreateDCTDecoder(pdfium::span<const uint8_t> src_span,
   if (components_ == static_cast<uint32_t>(info.num_components)) {
     bpc_ = info.bits_per_components;
     decoder_ = JpegModule::CreateDecoder(src_span, GetWidth(), GetHeight(),
-                                         components_, info.color_transform);
+                                         components_, info.color_transform,
+                                         resolution_levels_to_skip,
+                                         decode_area_);
     return true;
   }
 
@@ -700,7 +784,8 @@ bool CPDF_DIB::CreateDCTDecoder(pdfium::span<const uint8_t> src_span,
 
   bpc_ = info.bits_per_components;
   decoder_ = JpegModule::CreateDecoder(src_span, GetWidth(), GetHeight(),
-                                       components_, info.color_transform);
+                                       components_, info.color_transform,
+                                       resolution_levels_to_skip, decode_area_);
   return true;
 }
 
@@ -714,6 +799,9 @@ RetainPtr<CFX_DIBitmap> CPDF_DIB::LoadJpxBitmap(
     return nullptr;
   }
 
+  if (!decode_area_.IsEmpty()) {
+    decoder->SetDecodeArea(decode_area_);
+  }
   SetWidth(GetWidth() >> resolution_levels_to_skip);
   SetHeight(GetHeight() >> resolution_levels_to_skip);
 
@@ -976,7 +1064,8 @@ CPDF_DIB::LoadState CPDF_DIB::StartLoadMaskDIB(
   mask_ = pdfium::MakeRetain<CPDF_DIB>(document_, std::move(mask_stream));
   LoadState ret =
       mask_->StartLoadDIBBase(false, nullptr, nullptr, true,
-                              CPDF_ColorSpace::Family::kUnknown, false, {0, 0});
+                              CPDF_ColorSpace::Family::kUnknown, false, {0, 0},
+                              FX_RECT());
   if (ret == LoadState::kContinue) {
     if (status_ == LoadState::kFail) {
       status_ = LoadState::kContinue;
@@ -1114,6 +1203,10 @@ void CPDF_DIB::TranslateScanline24bpp(
     return;
   }
 
+  if (TranslateScanline24bppCMYKDecode(dest_scan, src_scan)) {
+    return;
+  }
+
   // Using at least 16 elements due to the call color_space_->GetRGB().
   std::vector<float> color_values(std::max(components_, 16u));
   FX_RGB_STRUCT<float> rgb = {};
@@ -1225,6 +1318,135 @@ bool CPDF_DIB::TranslateScanline24bppDefaultDecode(
   return true;
 }
 
+bool CPDF_DIB::TranslateScanline24bppCMYKDecode(
+    pdfium::span<uint8_t> dest_scan,
+    pdfium::span<const uint8_t> src_scan) const {
+  if (cmyk_decode_table_.empty() || bpc_ != 8 || components_ != 4 ||
+      TransMask() || color_space_->IsStdConversionEnabled()) {
+    return false;
+  }
+
+  // Same results as TranslateScanline24bpp() gets through GetRGB(), as the
+  // table rounds decoded values the way AdobeCMYK_to_sRGB() does, and the
+  // bytes it gets back survive the round trip through floats unchanged.
+  static constexpr size_t kChunkPixels = 64;
+  std::array<FX_CMYK_STRUCT<uint8_t>, kChunkPixels> cmyk;
+  auto src = fxcrt::reinterpret_span<const FX_CMYK_STRUCT<uint8_t>>(src_scan)
+                 .first(static_cast<size_t>(GetWidth()));
+  auto dest = fxcrt::reinterpret_span<FX_BGR_STRUCT<uint8_t>>(dest_scan);
+  while (!src.empty()) {
+    const size_t pixels = std::min(src.size(), kChunkPixels);
+    for (size_t i = 0; i < pixels; ++i) {
+      cmyk[i] = {cmyk_decode_table_[src[i].cyan],
+                 cmyk_decode_table_[256 + src[i].magenta],
+                 cmyk_decode_table_[512 + src[i].yellow],
+                 cmyk_decode_table_[768 + src[i].key]};
+    }
+    AdobeCMYK_to_sRGB1Row(pdfium::span(cmyk).first(pixels), dest);
+    src = src.subspan(pixels);
+    dest = dest.subspan(pixels);
+  }
+  return true;
+}
+
+bool CPDF_DIB::HasSourceInMemory(uint32_t src_pitch) const {
+  return (cached_bitmap_ && src_pitch <= cached_bitmap_->GetPitch()) ||
+         !decoder_;
+}
+
+pdfium::span<const uint8_t> CPDF_DIB::GetSourceLineInMemory(
+    int line,
+    uint32_t src_pitch,
+    DataVector<uint8_t>& temp_buffer) const {
+  if (cached_bitmap_ && src_pitch <= cached_bitmap_->GetPitch()) {
+    if (line >= cached_bitmap_->GetHeight()) {
+      line = cached_bitmap_->GetHeight() - 1;
+    }
+    return cached_bitmap_->GetScanline(line);
+  }
+
+  if (stream_acc_->GetSize() <= line * src_pitch) {
+    return pdfium::span<const uint8_t>();
+  }
+
+  pdfium::span<const uint8_t> remaining_bytes =
+      stream_acc_->GetSpan().subspan(line * src_pitch);
+  if (remaining_bytes.size() >= src_pitch) {
+    return remaining_bytes.first(src_pitch);
+  }
+  temp_buffer = DataVector<uint8_t>(src_pitch);
+  fxcrt::Copy(remaining_bytes, temp_buffer);
+  return temp_buffer;
+}
+
+pdfium::span<const uint8_t> CPDF_DIB::GetConvertedScanline(
+    int line,
+    uint32_t src_pitch) const {
+  if (!tried_converting_rows_) {
+    tried_converting_rows_ = true;
+    ConvertRowsInParallel(src_pitch);
+  }
+  // Conversion of DeviceCMYK depends on this, so rows converted without it
+  // do not apply while it is on.
+  if (converted_rows_.empty() || line < 0 || line >= GetHeight() ||
+      color_space_->IsStdConversionEnabled()) {
+    return pdfium::span<const uint8_t>();
+  }
+  const size_t pitch = 3 * static_cast<size_t>(GetWidth());
+  return pdfium::span(converted_rows_).subspan(line * pitch, pitch);
+}
+
+void CPDF_DIB::ConvertRowsInParallel(uint32_t src_pitch) const {
+  // Only for images that GetScanline() translates to 24 bpp from source rows
+  // that are all in memory, with colorspaces that can do so on any thread.
+  if (CFX_ThreadPool::GetConcurrency() < 2 || !color_space_ || color_key_ ||
+      bpc_ * components_ <= 8 || !HasSourceInMemory(src_pitch) ||
+      color_space_->IsStdConversionEnabled() ||
+      !color_space_->CanTranslateConcurrently()) {
+    return;
+  }
+
+  // Smaller images convert quickly enough one row at a time. Converted rows
+  // take 3 bytes per pixel, so limit them like other whole-image buffers.
+  FX_SAFE_SIZE_T size = GetWidth();
+  size *= GetHeight();
+  if (size.ValueOrDefault(0) < kMinParallelConversionPixels) {
+    return;
+  }
+  size *= 3;
+  if (size.ValueOrDefault(kHugeImageSize) >= kHugeImageSize) {
+    return;
+  }
+
+  converted_rows_ = DataVector<uint8_t>(size.ValueOrDie());
+  const size_t pitch = 3 * static_cast<size_t>(GetWidth());
+  auto convert_rows = [this, src_pitch, pitch](size_t begin, size_t end) {
+    DataVector<uint8_t> temp_buffer;
+    for (size_t row = begin; row < end; ++row) {
+      pdfium::span<uint8_t> dest =
+          pdfium::span(converted_rows_).subspan(row * pitch, pitch);
+      pdfium::span<const uint8_t> src = GetSourceLineInMemory(
+          static_cast<int>(row), src_pitch, temp_buffer);
+      if (src.empty()) {
+        std::ranges::fill(dest, 0);
+      } else {
+        TranslateScanline24bpp(dest, src);
+      }
+    }
+  };
+
+  // Converting the first row on its own lets the colorspace set up whatever
+  // it creates on first use before other threads need it.
+  convert_rows(0, 1);
+  const size_t rows = static_cast<size_t>(GetHeight()) - 1;
+  const size_t grain_size =
+      std::max<size_t>(1, kParallelConversionGrainPixels / GetWidth());
+  CFX_ThreadPool::ParallelFor(
+      rows, grain_size, [&convert_rows](size_t begin, size_t end) {
+        convert_rows(begin + 1, end + 1);
+      });
+}
+
 pdfium::span<const uint8_t> CPDF_DIB::GetScanline(int line) const {
   if (bpc_ == 0) {
     return pdfium::span<const uint8_t>();
@@ -1237,27 +1459,24 @@ pdfium::span<const uint8_t> CPDF_DIB::GetScanline(int line) const {
   }
 
   uint32_t src_pitch_value = src_pitch.value();
+  pdfium::span<const uint8_t> converted_line =
+      GetConvertedScanline(line, src_pitch_value);
+  if (!converted_line.empty()) {
+    return converted_line;
+  }
+
   // This is used as the buffer of `pSrcLine` when the stream is truncated,
   // and the remaining bytes count is less than `src_pitch_value`
   DataVector<uint8_t> temp_buffer;
   pdfium::span<const uint8_t> pSrcLine;
 
-  if (cached_bitmap_ && src_pitch_value <= cached_bitmap_->GetPitch()) {
-    if (line >= cached_bitmap_->GetHeight()) {
-      line = cached_bitmap_->GetHeight() - 1;
-    }
-    pSrcLine = cached_bitmap_->GetScanline(line);
-  } else if (decoder_) {
-    pSrcLine = decoder_->GetScanline(line);
-  } else if (stream_acc_->GetSize() > line * src_pitch_value) {
-    pdfium::span<const uint8_t> remaining_bytes =
-        stream_acc_->GetSpan().subspan(line * src_pitch_value);
-    if (remaining_bytes.size() >= src_pitch_value) {
-      pSrcLine = remaining_bytes.first(src_pitch_value);
-    } else {
-      temp_buffer = DataVector<uint8_t>(src_pitch_value);
-      fxcrt::Copy(remaining_bytes, temp_buffer);
-      pSrcLine = temp_buffer;
+  if (HasSourceInMemory(src_pitch_value)) {
+    pSrcLine = GetSourceLineInMemory(line, src_pitch_value, temp_buffer);
+  } else {
+    // Leave lines outside the decode area blank rather than decoding them.
+    if (decode_area_.IsEmpty() ||
+        (line >= decode_area_.top && line < decode_area_.bottom)) {
+      pSrcLine = decoder_->GetScanline(line);
     }
   }
 
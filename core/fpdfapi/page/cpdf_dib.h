@@ -14,6 +14,7 @@
 
 #include "core/fpdfapi/page/cpdf_colorspace.h"
 #include "core/fxcrt/data_vector.h"
+#include "core/fxcrt/fx_coordinates.h"
 #include "core/fxcrt/retain_ptr.h"
 #include "core/fxcrt/span.h"
 #include "core/fxcrt/unowned_ptr.h"
@@ -54,13 +55,18 @@ class CPDF_DIB final : public CFX_DIBBase {
   bool IsJBigImage() const;
 
   bool Load();
+
+  // A non-empty `decode_area` limits which pixels of the image, in the
+  // coordinates of its full size, need to be decoded. Pixels outside of it
+  // may be left blank.
   LoadState StartLoadDIBBase(bool bHasMask,
                              const CPDF_Dictionary* pFormResources,
                              const CPDF_Dictionary* pPageResources,
                              bool bStdCS,
                              CPDF_ColorSpace::Family GroupFamily,
                              bool bLoadMask,
-                             const CFX_Size& max_size_required);
+                             const CFX_Size& max_size_required,
+                             const FX_RECT& decode_area);
   LoadState ContinueLoadDIBBase(PauseIndicatorIface* pPause);
   RetainPtr<CPDF_DIB> DetachMask();
 
@@ -90,13 +96,34 @@ class CPDF_DIB final : public CFX_DIBBase {
   RetainPtr<CFX_DIBitmap> LoadJpxBitmap(uint8_t resolution_levels_to_skip);
   void LoadPalette();
   LoadState CreateDecoder(uint8_t resolution_levels_to_skip);
+  bool CanDownsampleRows() const;
+  // Shrinks the image by `2^levels`, after the decoder was set up to do so.
+  void ScaleDown(uint8_t levels);
   bool CreateDCTDecoder(pdfium::span<const uint8_t> src_span,
-                        const CPDF_Dictionary* pParams);
+                        const CPDF_Dictionary* pParams,
+                        uint8_t resolution_levels_to_skip);
   void TranslateScanline24bpp(pdfium::span<uint8_t> dest_scan,
                               pdfium::span<const uint8_t> src_scan) const;
   bool TranslateScanline24bppDefaultDecode(
       pdfium::span<uint8_t> dest_scan,
       pdfium::span<const uint8_t> src_scan) const;
+  bool TranslateScanline24bppCMYKDecode(
+      pdfium::span<uint8_t> dest_scan,
+      pdfium::span<const uint8_t> src_scan) const;
+  // Returns whether all source rows are in memory, rather than coming from
+  // `decoder_`.
+  bool HasSourceInMemory(uint32_t src_pitch) const;
+  pdfium::span<const uint8_t> GetSourceLineInMemory(
+      int line,
+      uint32_t src_pitch,
+      DataVector<uint8_t>& temp_buffer) const;
+  // Returns `line` from `converted_rows_`, or an empty span if the image is
+  // not converted ahead of time.
+  pdfium::span<const uint8_t> GetConvertedScanline(int line,
+                                                   uint32_t src_pitch) const;
+  // For large images whose source rows are all in memory, converts every row
+  // into `converted_rows_` at once, using the thread pool.
+  void ConvertRowsInParallel(uint32_t src_pitch) const;
   bool ValidateDictParam(const ByteString& filter);
   bool TransMask() const;
   void SetMaskProperties();
@@ -123,8 +150,15 @@ class CPDF_DIB final : public CFX_DIBBase {
   bool color_key_ = false;
   bool has_mask_ = false;
   bool std_cs_ = false;
+  // Shrinks along with the image when it is decoded at a lower resolution.
+  FX_RECT decode_area_;
   std::vector<DIB_COMP_DATA> comp_data_;
+  // For DeviceCMYK images with a Decode array, maps each 8-bit component value
+  // to the byte it decodes to, one run of 256 entries per component.
+  DataVector<uint8_t> cmyk_decode_table_;
   mutable DataVector<uint8_t> line_buf_;
+  mutable DataVector<uint8_t> converted_rows_;
+  mutable bool tried_converting_rows_ = false;
   mutable DataVector<uint8_t> mask_buf_;
   RetainPtr<CFX_DIBitmap> cached_bitmap_;
   // Note: Must not create a cycle between CPDF_DIB instances.
@@ -471,8 +471,8 @@ RetainPtr<CPDF_IccProfile> CPDF_DocPageData::GetIccProfile(
       return it_copied_stream->second;
     }
   }
-  auto pProfile =
-      pdfium::MakeRetain<CPDF_IccProfile>(pAccessor, expected_components);
+  auto pProfile = pdfium::MakeRetain<CPDF_IccProfile>(
+      pAccessor, hash_profile_key.digest, expected_components);
   icc_profile_map_[pProfileStream] = pProfile;
   hash_icc_profile_map_[hash_profile_key] = std::move(pProfileStream);
   return pProfile;
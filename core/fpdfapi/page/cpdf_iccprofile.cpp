@@ -10,6 +10,7 @@
 
 #include "core/fpdfapi/parser/cpdf_stream_acc.h"
 #include "core/fxcodec/icc/icc_transform.h"
+#include "core/fxcodec/icc/icc_transform_cache.h"
 #include "core/fxcrt/span.h"
 
 namespace {
@@ -22,6 +23,7 @@ bool DetectSRGB(pdfium::span<const uint8_t> span) {
 }  // namespace
 
 CPDF_IccProfile::CPDF_IccProfile(RetainPtr<const CPDF_StreamAcc> stream_acc,
+                                 pdfium::span<const uint8_t> digest,
                                  uint32_t expected_components)
     : stream_acc_(std::move(stream_acc)),
       is_srgb_(expected_components == 3 && DetectSRGB(stream_acc_->GetSpan())) {
@@ -30,8 +32,10 @@ CPDF_IccProfile::CPDF_IccProfile(RetainPtr<const CPDF_StreamAcc> stream_acc,
     return;
   }
 
-  auto transform =
-      fxcodec::IccTransform::CreateTransformSRGB(stream_acc_->GetSpan());
+  auto* cache = fxcodec::IccTransformCache::GetInstance();
+  std::shared_ptr<fxcodec::IccTransform> transform =
+      cache ? cache->GetTransform(digest, stream_acc_->GetSpan())
+            : fxcodec::IccTransform::CreateTransformSRGB(stream_acc_->GetSpan());
   if (!transform) {
     return;
   }
@@ -39,15 +39,18 @@ class CPDF_IccProfile final : public Retainable {
   RetainPtr<const CPDF_StreamAcc> GetStreamAcc() const;
 
  private:
+  // `digest` is the digest of the data in `stream_acc`, which identifies the
+  // profile in IccTransformCache.
   CPDF_IccProfile(RetainPtr<const CPDF_StreamAcc> stream_acc,
+                  pdfium::span<const uint8_t> digest,
                   uint32_t expected_components);
   ~CPDF_IccProfile() override;
 
-  // Keeps stream alive for the lifetime of this object, so `transform_` can
-  // safely access the stream data.
+  // Keeps stream alive for the lifetime of this object.
   RetainPtr<const CPDF_StreamAcc> const stream_acc_;
-  // Uses data from `stream_acc_`.
-  std::unique_ptr<fxcodec::IccTransform> transform_;
+  // Does not use data from `stream_acc_`, as it may be shared with profiles
+  // in other documents that have the same data.
+  std::shared_ptr<fxcodec::IccTransform> transform_;
   const bool is_srgb_;
   uint32_t src_components_ = 0;
 };
@@ -174,7 +174,8 @@ bool CPDF_PageImageCache::StartGetCachedBitmap(
     bool bStdCS,
     CPDF_ColorSpace::Family eFamily,
     bool bLoadMask,
-    const CFX_Size& max_size_required) {
+    const CFX_Size& max_size_required,
+    const FX_RECT& decode_area) {
   // A cross-document image may have come from the embedder.
   if (page_->GetDocument() != pImage->GetDocument()) {
     return false;
@@ -190,7 +191,7 @@ bool CPDF_PageImageCache::StartGetCachedBitmap(
   }
   CPDF_DIB::LoadState ret = cur_image_cache_entry_->StartGetCachedBitmap(
       this, pFormResources, pPageResources, bStdCS, eFamily, bLoadMask,
-      max_size_required);
+      max_size_required, decode_area);
   if (ret == CPDF_DIB::LoadState::kContinue) {
     return true;
   }
@@ -272,8 +273,9 @@ CPDF_DIB::LoadState CPDF_PageImageCache::Entry::StartGetCachedBitmap(
     bool bStdCS,
     CPDF_ColorSpace::Family eFamily,
     bool bLoadMask,
-    const CFX_Size& max_size_required) {
-  if (cached_bitmap_ && IsCacheValid(max_size_required)) {
+    const CFX_Size& max_size_required,
+    const FX_RECT& decode_area) {
+  if (cached_bitmap_ && IsCacheValid(max_size_required, decode_area)) {
     cur_bitmap_ = cached_bitmap_;
     cur_mask_ = cached_mask_;
     return CPDF_DIB::LoadState::kSuccess;
@@ -282,9 +284,10 @@ CPDF_DIB::LoadState CPDF_PageImageCache::Entry::StartGetCachedBitmap(
   cur_bitmap_ = image_->CreateNewDIB();
   CPDF_DIB::LoadState ret = cur_bitmap_.AsRaw<CPDF_DIB>()->StartLoadDIBBase(
       true, pFormResources, pPageResources, bStdCS, eFamily, bLoadMask,
-      max_size_required);
+      max_size_required, decode_area);
   cached_set_max_size_required_ =
       (max_size_required.width != 0 && max_size_required.height != 0);
+  cached_decode_area_ = decode_area;
   if (ret == CPDF_DIB::LoadState::kContinue) {
     return CPDF_DIB::LoadState::kContinue;
   }
@@ -345,7 +348,15 @@ void CPDF_PageImageCache::Entry::CalcSize() {
 }
 
 bool CPDF_PageImageCache::Entry::IsCacheValid(
-    const CFX_Size& max_size_required) const {
+    const CFX_Size& max_size_required,
+    const FX_RECT& decode_area) const {
+  if (!cached_decode_area_.IsEmpty() &&
+      (decode_area.IsEmpty() || decode_area.left < cached_decode_area_.left ||
+       decode_area.top < cached_decode_area_.top ||
+       decode_area.right > cached_decode_area_.right ||
+       decode_area.bottom > cached_decode_area_.bottom)) {
+    return false;
+  }
   if (!cached_set_max_size_required_) {
     return true;
   }
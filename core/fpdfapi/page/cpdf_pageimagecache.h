@@ -40,7 +40,8 @@ class CPDF_PageImageCache {
                             bool bStdCS,
                             CPDF_ColorSpace::Family eFamily,
                             bool bLoadMask,
-                            const CFX_Size& max_size_required);
+                            const CFX_Size& max_size_required,
+                            const FX_RECT& decode_area);
 
   bool Continue(PauseIndicatorIface* pPause);
 
@@ -68,7 +69,8 @@ class CPDF_PageImageCache {
         bool bStdCS,
         CPDF_ColorSpace::Family eFamily,
         bool bLoadMask,
-        const CFX_Size& max_size_required);
+        const CFX_Size& max_size_required,
+        const FX_RECT& decode_area);
 
     // Returns whether to Continue() or not.
     bool Continue(PauseIndicatorIface* pPause,
@@ -80,7 +82,8 @@ class CPDF_PageImageCache {
    private:
     void ContinueGetCachedBitmap(CPDF_PageImageCache* pPageImageCache);
     void CalcSize();
-    bool IsCacheValid(const CFX_Size& max_size_required) const;
+    bool IsCacheValid(const CFX_Size& max_size_required,
+                      const FX_RECT& decode_area) const;
 
     uint32_t time_count_ = 0;
     uint32_t matte_color_ = 0;
@@ -91,6 +94,8 @@ class CPDF_PageImageCache {
     RetainPtr<CFX_DIBBase> cached_bitmap_;
     RetainPtr<CFX_DIBBase> cached_mask_;
     bool cached_set_max_size_required_ = false;
+    // Empty when the cached bitmap has all of its pixels decoded.
+    FX_RECT cached_decode_area_;
   };
 
   void ClearImageCacheEntry(const CPDF_Stream* pStream);
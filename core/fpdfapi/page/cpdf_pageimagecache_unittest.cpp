@@ -58,7 +58,7 @@ TEST(CPDFPageImageCache, RenderBug1924) {
     // Render with small scale.
     bool should_continue = page_image_cache->StartGetCachedBitmap(
         image->GetImage(), nullptr, page->GetMutablePageResources(), true,
-        CPDF_ColorSpace::Family::kICCBased, false, {50, 50});
+        CPDF_ColorSpace::Family::kICCBased, false, {50, 50}, FX_RECT());
     while (should_continue) {
       should_continue = page_image_cache->Continue(nullptr);
     }
@@ -68,7 +68,7 @@ TEST(CPDFPageImageCache, RenderBug1924) {
     // And render with large scale.
     should_continue = page_image_cache->StartGetCachedBitmap(
         image->GetImage(), nullptr, page->GetMutablePageResources(), true,
-        CPDF_ColorSpace::Family::kICCBased, false, {100, 100});
+        CPDF_ColorSpace::Family::kICCBased, false, {100, 100}, FX_RECT());
     while (should_continue) {
       should_continue = page_image_cache->Continue(nullptr);
     }
@@ -84,4 +84,60 @@ TEST(CPDFPageImageCache, RenderBug1924) {
   DestroyPageModule();
 }
 
+TEST(CPDFPageImageCache, DecodeArea) {
+  // An image decoded for part of its area can be reused for parts within
+  // that area, but not for the whole image.
+  InitializePageModule();
+  {
+    std::string file_path = PathService::GetTestFilePath("jpx_lzw.pdf");
+    ASSERT_FALSE(file_path.empty());
+    auto document =
+        std::make_unique<CPDF_Document>(std::make_unique<CPDF_DocRenderData>(),
+                                        std::make_unique<CPDF_DocPageData>());
+    ASSERT_EQ(document->LoadDoc(
+                  IFX_SeekableReadStream::CreateFromFilename(file_path.c_str()),
+                  nullptr),
+              CPDF_Parser::SUCCESS);
+
+    RetainPtr<CPDF_Dictionary> page_dict =
+        document->GetMutablePageDictionary(0);
+    ASSERT_TRUE(page_dict);
+    auto page =
+        pdfium::MakeRetain<CPDF_Page>(document.get(), std::move(page_dict));
+    page->AddPageImageCache();
+    page->ParseContent();
+
+    CPDF_PageImageCache* page_image_cache = page->GetPageImageCache();
+    ASSERT_TRUE(page_image_cache);
+
+    CPDF_PageObject* page_obj = page->GetPageObjectByIndex(0);
+    ASSERT_TRUE(page_obj);
+    CPDF_ImageObject* image = page_obj->AsImage();
+    ASSERT_TRUE(image);
+
+    auto get_bitmap = [&](const FX_RECT& decode_area) {
+      bool should_continue = page_image_cache->StartGetCachedBitmap(
+          image->GetImage(), nullptr, page->GetMutablePageResources(), true,
+          CPDF_ColorSpace::Family::kICCBased, false, {0, 0}, decode_area);
+      while (should_continue) {
+        should_continue = page_image_cache->Continue(nullptr);
+      }
+      return page_image_cache->DetachCurBitmap();
+    };
+
+    RetainPtr<CFX_DIBBase> bitmap_part = get_bitmap(FX_RECT(0, 0, 20, 20));
+    ASSERT_TRUE(bitmap_part);
+    EXPECT_EQ(bitmap_part, get_bitmap(FX_RECT(5, 5, 15, 15)));
+
+    RetainPtr<CFX_DIBBase> bitmap_whole = get_bitmap(FX_RECT());
+    ASSERT_TRUE(bitmap_whole);
+    EXPECT_NE(bitmap_part, bitmap_whole);
+    EXPECT_EQ(bitmap_whole, get_bitmap(FX_RECT(0, 0, 20, 20)));
+
+    ASSERT_TRUE(page->AsPDFPage());
+    page->AsPDFPage()->ClearView();
+  }
+  DestroyPageModule();
+}
+
 }  // namespace pdfium
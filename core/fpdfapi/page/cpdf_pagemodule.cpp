@@ -9,6 +9,7 @@
 #include "core/fpdfapi/font/cpdf_fontglobals.h"
 #include "core/fpdfapi/page/cpdf_colorspace.h"
 #include "core/fpdfapi/page/cpdf_streamcontentparser.h"
+#include "core/fxcodec/icc/icc_transform_cache.h"
 
 namespace pdfium {
 
@@ -17,9 +18,11 @@ void InitializePageModule() {
   CPDF_FontGlobals::Create();
   CPDF_FontGlobals::GetInstance()->LoadEmbeddedMaps();
   CPDF_StreamContentParser::InitializeGlobals();
+  fxcodec::IccTransformCache::InitializeGlobals();
 }
 
 void DestroyPageModule() {
+  fxcodec::IccTransformCache::DestroyGlobals();
   CPDF_StreamContentParser::DestroyGlobals();
   CPDF_FontGlobals::Destroy();
   CPDF_ColorSpace::DestroyGlobals();
@@ -82,6 +82,12 @@ class CPDF_PageObjectHolder {
   void ContinueParse(PauseIndicatorIface* pPause);
   ParseState GetParseState() const { return parse_state_; }
 
+  // When set before parsing, the content parser only creates text objects and
+  // the form objects that hold them, for callers that only extract text. It
+  // skips paths, images, shadings and clipping.
+  void SetTextOnly(bool text_only) { text_only_ = text_only; }
+  bool IsTextOnly() const { return text_only_; }
+
   CPDF_Document* GetDocument() const { return document_; }
   RetainPtr<const CPDF_Dictionary> GetDict() const { return dict_; }
   RetainPtr<CPDF_Dictionary> GetMutableDict() { return dict_; }
@@ -158,6 +164,7 @@ class CPDF_PageObjectHolder {
 
  private:
   bool background_alpha_needed_ = false;
+  bool text_only_ = false;
   ParseState parse_state_ = ParseState::kNotParsed;
   RetainPtr<CPDF_Dictionary> const dict_;
   UnownedPtr<CPDF_Document> document_;
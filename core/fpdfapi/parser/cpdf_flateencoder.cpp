@@ -17,10 +17,11 @@
 #include "core/fpdfapi/parser/fpdf_parser_decode.h"
 #include "core/fxcodec/flate/flatemodule.h"
 #include "core/fxcrt/check.h"
-#include "core/fxcrt/numerics/safe_conversions.h"
 
-CPDF_FlateEncoder::CPDF_FlateEncoder(RetainPtr<const CPDF_Stream> pStream,
-                                     bool bFlateEncode)
+CPDF_FlateEncoder::CPDF_FlateEncoder(
+    RetainPtr<const CPDF_Stream> pStream,
+    bool bFlateEncode,
+    const FlateModule::EncodeOptions& options)
     : acc_(pdfium::MakeRetain<CPDF_StreamAcc>(pStream)) {
   acc_->LoadAllDataRaw();
 
@@ -42,11 +43,9 @@ CPDF_FlateEncoder::CPDF_FlateEncoder(RetainPtr<const CPDF_Stream> pStream,
     return;
   }
 
-  data_ = FlateModule::Encode(acc_->GetSpan());
-  CHECK(!GetSpan().empty());
+  // /Length gets set by UpdateLength() once the compressed size is known.
+  pending_options_ = options;
   cloned_dict_ = ToDictionary(pStream->GetDict()->Clone());
-  cloned_dict_->SetNewFor<CPDF_Number>(
-      "Length", pdfium::checked_cast<int>(GetSpan().size()));
   cloned_dict_->SetNewFor<CPDF_Name>("Filter", "FlateDecode");
   cloned_dict_->RemoveFor(pdfium::stream::kDecodeParms);
   DCHECK(!dict_);
@@ -54,6 +53,15 @@ CPDF_FlateEncoder::CPDF_FlateEncoder(RetainPtr<const CPDF_Stream> pStream,
 
 CPDF_FlateEncoder::~CPDF_FlateEncoder() = default;
 
+void CPDF_FlateEncoder::Encode() {
+  if (!pending_options_.has_value()) {
+    return;
+  }
+  data_ = FlateModule::Encode(acc_->GetSpan(), pending_options_.value());
+  pending_options_.reset();
+  CHECK(!GetSpan().empty());
+}
+
 void CPDF_FlateEncoder::UpdateLength(size_t size) {
   if (static_cast<size_t>(GetDict()->GetIntegerFor("Length")) == size) {
     return;
@@ -82,6 +90,7 @@ const CPDF_Dictionary* CPDF_FlateEncoder::GetDict() const {
 }
 
 pdfium::span<const uint8_t> CPDF_FlateEncoder::GetSpan() const {
+  DCHECK(!pending_options_.has_value());
   if (is_owned()) {
     return std::get<DataVector<uint8_t>>(data_);
   }
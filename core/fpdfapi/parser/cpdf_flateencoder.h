@@ -8,8 +8,11 @@
 #define CORE_FPDFAPI_PARSER_CPDF_FLATEENCODER_H_
 
 #include <stdint.h>
+
+#include <optional>
 #include <variant>
 
+#include "core/fxcodec/flate/flatemodule.h"
 #include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/raw_span.h"
 #include "core/fxcrt/retain_ptr.h"
@@ -23,9 +26,17 @@ class IFX_ArchiveStream;
 
 class CPDF_FlateEncoder {
  public:
-  CPDF_FlateEncoder(RetainPtr<const CPDF_Stream> pStream, bool bFlateEncode);
+  // Loads the data of `pStream`. If it needs compressing, that only happens
+  // in Encode().
+  CPDF_FlateEncoder(RetainPtr<const CPDF_Stream> pStream,
+                    bool bFlateEncode,
+                    const FlateModule::EncodeOptions& options);
   ~CPDF_FlateEncoder();
 
+  // Must be called before GetSpan(). Only touches the data owned by this
+  // encoder, so encoders for different streams may run it concurrently.
+  void Encode();
+
   void UpdateLength(size_t size);
   bool WriteDictTo(IFX_ArchiveStream* archive,
                    const CPDF_Encryptor* encryptor) const;
@@ -45,6 +56,9 @@ class CPDF_FlateEncoder {
 
   std::variant<pdfium::raw_span<const uint8_t>, DataVector<uint8_t>> data_;
 
+  // Set until Encode() compresses `acc_` into `data_`.
+  std::optional<FlateModule::EncodeOptions> pending_options_;
+
   // Only one of these two pointers is valid at any time.
   RetainPtr<const CPDF_Dictionary> dict_;
   RetainPtr<CPDF_Dictionary> cloned_dict_;
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <variant>
@@ -176,9 +177,23 @@ WideString CPDF_Stream::GetUnicodeText() const {
 
 bool CPDF_Stream::WriteTo(IFX_ArchiveStream* archive,
                           const CPDF_Encryptor* encryptor) const {
+  std::unique_ptr<CPDF_FlateEncoder> encoder =
+      CreateEncoder(FlateModule::EncodeOptions());
+  encoder->Encode();
+  return WriteEncodedTo(archive, encryptor, *encoder);
+}
+
+std::unique_ptr<CPDF_FlateEncoder> CPDF_Stream::CreateEncoder(
+    const FlateModule::EncodeOptions& options) const {
   const bool is_metadata = IsMetaDataStreamDictionary(GetDict().Get());
-  CPDF_FlateEncoder encoder(pdfium::WrapRetain(this), !is_metadata);
+  return std::make_unique<CPDF_FlateEncoder>(pdfium::WrapRetain(this),
+                                             !is_metadata, options);
+}
 
+bool CPDF_Stream::WriteEncodedTo(IFX_ArchiveStream* archive,
+                                 const CPDF_Encryptor* encryptor,
+                                 CPDF_FlateEncoder& encoder) const {
+  const bool is_metadata = IsMetaDataStreamDictionary(GetDict().Get());
   DataVector<uint8_t> encrypted_data;
   pdfium::span<const uint8_t> data = encoder.GetSpan();
   if (encryptor && !is_metadata) {
@@ -14,10 +14,12 @@
 #include <variant>
 
 #include "core/fpdfapi/parser/cpdf_object.h"
+#include "core/fxcodec/flate/flatemodule.h"
 #include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/fx_string_wrappers.h"
 #include "core/fxcrt/retain_ptr.h"
 
+class CPDF_FlateEncoder;
 class IFX_SeekableReadStream;
 
 class CPDF_Stream final : public CPDF_Object {
@@ -34,6 +36,16 @@ class CPDF_Stream final : public CPDF_Object {
   bool WriteTo(IFX_ArchiveStream* archive,
                const CPDF_Encryptor* encryptor) const override;
 
+  // Splits WriteTo() so that callers can compress several streams at once:
+  // CreateEncoder() prepares the data for writing, the returned encoder's
+  // Encode() compresses it with `options` as needed, and WriteEncodedTo()
+  // writes the result.
+  std::unique_ptr<CPDF_FlateEncoder> CreateEncoder(
+      const FlateModule::EncodeOptions& options) const;
+  bool WriteEncodedTo(IFX_ArchiveStream* archive,
+                      const CPDF_Encryptor* encryptor,
+                      CPDF_FlateEncoder& encoder) const;
+
   size_t GetRawSize() const;
   // Can only be called when stream is memory-based.
   // This is meant to be used by CPDF_StreamAcc only.
@@ -9,6 +9,7 @@
 #include <utility>
 #include <variant>
 
+#include "constants/stream_dict_common.h"
 #include "core/fdrm/fx_crypt.h"
 #include "core/fpdfapi/parser/cpdf_dictionary.h"
 #include "core/fpdfapi/parser/cpdf_stream.h"
@@ -16,6 +17,7 @@
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/compiler_specific.h"
 #include "core/fxcrt/data_vector.h"
+#include "core/fxcrt/numerics/safe_conversions.h"
 
 CPDF_StreamAcc::CPDF_StreamAcc(RetainPtr<const CPDF_Stream> pStream)
     : stream_(std::move(pStream)) {}
@@ -150,6 +152,16 @@ void CPDF_StreamAcc::ProcessFilteredData(uint32_t estimated_size,
     return;
   }
 
+  const ByteString& last_decoder = decoder_array.value().back().first;
+  if (!estimated_size &&
+      (last_decoder == "FlateDecode" || last_decoder == "Fl")) {
+    // The optional decoded length is the size after all the filters. It lets
+    // a trailing Flate filter size its output buffer right away. No other
+    // filter takes a size hint.
+    estimated_size = pdfium::saturated_cast<uint32_t>(
+        stream_->GetDict()->GetIntegerFor(pdfium::stream::kDL));
+  }
+
   std::optional<PDFDataDecodeResult> result = PDF_DataDecode(
       src_span, estimated_size, bImageAcc, decoder_array.value());
   if (!result.has_value()) {
@@ -363,6 +363,33 @@ std::unique_ptr<ScanlineDecoder> CreateFlateDecoder(
                                     Columns);
 }
 
+std::unique_ptr<ScanlineDecoder> CreateLZWDecoder(
+    pdfium::span<const uint8_t> src_span,
+    int width,
+    int height,
+    int nComps,
+    int bpc,
+    const CPDF_Dictionary* pParams) {
+  int predictor = 0;
+  int Colors = 0;
+  int BitsPerComponent = 0;
+  int Columns = 0;
+  bool bEarlyChange = true;
+  if (pParams) {
+    predictor = pParams->GetIntegerFor("Predictor");
+    bEarlyChange = !!pParams->GetIntegerFor("EarlyChange", 1);
+    Colors = pParams->GetIntegerFor("Colors", 1);
+    BitsPerComponent = pParams->GetIntegerFor("BitsPerComponent", 8);
+    Columns = pParams->GetIntegerFor("Columns", 1);
+    if (!CheckFlateDecodeParams(Colors, BitsPerComponent, Columns)) {
+      return nullptr;
+    }
+  }
+  return FlateModule::CreateLZWDecoder(src_span, width, height, nComps, bpc,
+                                       bEarlyChange, predictor, Colors,
+                                       BitsPerComponent, Columns);
+}
+
 DataAndBytesConsumed FlateOrLZWDecode(bool use_lzw,
                                       pdfium::span<const uint8_t> src_span,
                                       const CPDF_Dictionary* pParams,
@@ -471,6 +498,11 @@ std::optional<PDFDataDecodeResult> PDF_DataDecode(
       new_buf = std::move(decode_result.data);
       bytes_consumed = decode_result.bytes_consumed;
     } else if (decoder == "LZWDecode" || decoder == "LZW") {
+      if (bImageAcc && i == nSize - 1) {
+        result.image_encoding = "LZWDecode";
+        result.image_params = std::move(pParam);
+        return result;
+      }
       DataAndBytesConsumed decode_result =
           FlateOrLZWDecode(/*use_lzw=*/true, last_span, pParam, estimated_size);
       new_buf = std::move(decode_result.data);
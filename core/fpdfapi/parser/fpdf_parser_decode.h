@@ -53,6 +53,14 @@ std::unique_ptr<fxcodec::ScanlineDecoder> CreateFlateDecoder(
     int bpc,
     const CPDF_Dictionary* pParams);
 
+std::unique_ptr<fxcodec::ScanlineDecoder> CreateLZWDecoder(
+    pdfium::span<const uint8_t> src_span,
+    int width,
+    int height,
+    int nComps,
+    int bpc,
+    const CPDF_Dictionary* pParams);
+
 fxcodec::DataAndBytesConsumed RunLengthDecode(
     pdfium::span<const uint8_t> src_span);
 
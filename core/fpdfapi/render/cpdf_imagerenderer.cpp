@@ -76,7 +76,8 @@ bool CPDF_ImageRenderer::StartLoadDIBBase() {
           std_cs_, render_status_->GetGroupFamily(),
           render_status_->GetLoadMask(),
           {render_status_->GetRenderDevice()->GetWidth(),
-           render_status_->GetRenderDevice()->GetHeight()})) {
+           render_status_->GetRenderDevice()->GetHeight()},
+          GetVisibleImageArea())) {
     return false;
   }
   mode_ = Mode::kDefault;
@@ -657,6 +658,47 @@ std::optional<FX_RECT> CPDF_ImageRenderer::GetUnitRect() const {
   return image_rect;
 }
 
+FX_RECT CPDF_ImageRenderer::GetVisibleImageArea() const {
+  // Resampling filters let pixels just outside of the clip box affect it.
+  // Leave room for the filters when shrinking (in device pixels) and when
+  // enlarging (in image pixels).
+  constexpr int kDeviceMargin = 2;
+  constexpr int kImageMargin = 2;
+
+  RetainPtr<CPDF_Image> image = image_object_->GetImage();
+  const int width = image->GetPixelWidth();
+  const int height = image->GetPixelHeight();
+  if (width <= 0 || height <= 0 ||
+      image_matrix_.a * image_matrix_.d == image_matrix_.b * image_matrix_.c) {
+    return FX_RECT();
+  }
+
+  FX_RECT clip_box = render_status_->GetRenderDevice()->GetClipBox();
+  clip_box.left -= kDeviceMargin;
+  clip_box.top -= kDeviceMargin;
+  clip_box.right += kDeviceMargin;
+  clip_box.bottom += kDeviceMargin;
+  CFX_FloatRect unit_rect =
+      image_matrix_.GetInverse().TransformRect(CFX_FloatRect(clip_box));
+  unit_rect.Intersect(CFX_FloatRect(0, 0, 1, 1));
+  if (unit_rect.IsEmpty()) {
+    return FX_RECT();
+  }
+
+  // Image rows run from the top of the unit square downwards.
+  FX_RECT area(static_cast<int>(floorf(unit_rect.left * width)) - kImageMargin,
+               static_cast<int>(floorf((1 - unit_rect.top) * height)) -
+                   kImageMargin,
+               static_cast<int>(ceilf(unit_rect.right * width)) + kImageMargin,
+               static_cast<int>(ceilf((1 - unit_rect.bottom) * height)) +
+                   kImageMargin);
+  area.Intersect(0, 0, width, height);
+  if (area == FX_RECT(0, 0, width, height)) {
+    return FX_RECT();
+  }
+  return area;
+}
+
 bool CPDF_ImageRenderer::GetDimensionsFromUnitRect(const FX_RECT& rect,
                                                    int* left,
                                                    int* top,
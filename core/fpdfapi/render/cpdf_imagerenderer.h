@@ -83,6 +83,9 @@ class CPDF_ImageRenderer {
       const FX_RECT& rect) const;
   const CPDF_RenderOptions& GetRenderOptions() const;
   std::optional<FX_RECT> GetUnitRect() const;
+  // Returns the part of the image, in image pixels, that can show up within
+  // the device's clip box, or an empty rect when that is the whole image.
+  FX_RECT GetVisibleImageArea() const;
   bool GetDimensionsFromUnitRect(const FX_RECT& rect,
                                  int* left,
                                  int* top,
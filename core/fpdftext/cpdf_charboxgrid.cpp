@@ -0,0 +1,212 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/cpdf_charboxgrid.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+#include "core/fxcrt/check.h"
+#include "core/fxcrt/numerics/safe_conversions.h"
+
+namespace {
+
+// Cells are about this many times the size of the average char box, so that
+// a point query usually finds a handful of chars in a single cell.
+constexpr double kCellsPerAverageChar = 2;
+
+constexpr size_t kMaxGridDimension = 1024;
+
+// Boxes that span more cells than this, such as those of huge glyphs, are
+// kept out of the grid and tested by every query instead.
+constexpr size_t kMaxCellsPerBox = 64;
+
+bool IsFinite(const CFX_FloatRect& rect) {
+  return isfinite(rect.left) && isfinite(rect.right) &&
+         isfinite(rect.bottom) && isfinite(rect.top);
+}
+
+bool HasNaN(const CFX_FloatRect& rect) {
+  return isnan(rect.left) || isnan(rect.right) || isnan(rect.bottom) ||
+         isnan(rect.top);
+}
+
+size_t GetGridDimension(double extent, double average_box_size) {
+  if (extent <= 0) {
+    return 1;
+  }
+  if (average_box_size <= 0) {
+    return kMaxGridDimension;
+  }
+  const double dimension =
+      ceil(extent / (average_box_size * kCellsPerAverageChar));
+  return static_cast<size_t>(
+      std::clamp(dimension, 1.0, static_cast<double>(kMaxGridDimension)));
+}
+
+// Maps `value` to a cell in [0, `count`). Monotonic in `value`, so boxes that
+// overlap always share a cell.
+size_t GetCell(float value, float origin, double cells_per_unit, size_t count) {
+  const double cell =
+      floor((static_cast<double>(value) - origin) * cells_per_unit);
+  if (!(cell > 0)) {
+    return 0;
+  }
+  if (cell >= static_cast<double>(count - 1)) {
+    return count - 1;
+  }
+  return static_cast<size_t>(cell);
+}
+
+}  // namespace
+
+CPDF_CharBoxGrid::CPDF_CharBoxGrid(pdfium::span<const CFX_FloatRect> boxes)
+    : box_count_(boxes.size()) {
+  // Box indices are stored as uint32_t.
+  CHECK(pdfium::IsValueInRangeForNumericType<uint32_t>(box_count_));
+
+  CFX_FloatRect bounds;
+  size_t finite_count = 0;
+  double total_width = 0;
+  double total_height = 0;
+  for (const CFX_FloatRect& box : boxes) {
+    if (!IsFinite(box)) {
+      continue;
+    }
+    CFX_FloatRect normalized = box;
+    normalized.Normalize();
+    if (finite_count == 0) {
+      bounds = normalized;
+    } else {
+      bounds.Union(normalized);
+    }
+    ++finite_count;
+    total_width += normalized.Width();
+    total_height += normalized.Height();
+  }
+
+  if (finite_count > 0) {
+    const double width = static_cast<double>(bounds.right) - bounds.left;
+    const double height = static_cast<double>(bounds.top) - bounds.bottom;
+    columns_ = GetGridDimension(width, total_width / finite_count);
+    rows_ = GetGridDimension(height, total_height / finite_count);
+
+    // Keep sparse pages from getting many more cells than boxes.
+    const size_t max_cells = 2 * finite_count + 1;
+    if (columns_ * rows_ > max_cells) {
+      const double scale =
+          sqrt(static_cast<double>(max_cells) / (columns_ * rows_));
+      columns_ = std::max<size_t>(1, static_cast<size_t>(columns_ * scale));
+      rows_ = std::max<size_t>(1, static_cast<size_t>(rows_ * scale));
+    }
+    left_ = bounds.left;
+    bottom_ = bounds.bottom;
+    columns_per_unit_ = width > 0 ? columns_ / width : 0;
+    rows_per_unit_ = height > 0 ? rows_ / height : 0;
+  }
+
+  // Count the boxes of each cell first, then fill them in.
+  const size_t cell_count = columns_ * rows_;
+  cell_starts_.resize(cell_count + 1);
+  std::vector<bool> in_grid(box_count_);
+  for (size_t i = 0; i < box_count_; ++i) {
+    if (!IsFinite(boxes[i])) {
+      continue;
+    }
+    CFX_FloatRect normalized = boxes[i];
+    normalized.Normalize();
+    const CellRange range = GetCellRange(normalized);
+    if ((range.last_column - range.first_column + 1) *
+            (range.last_row - range.first_row + 1) >
+        kMaxCellsPerBox) {
+      continue;
+    }
+    in_grid[i] = true;
+    for (size_t row = range.first_row; row <= range.last_row; ++row) {
+      for (size_t column = range.first_column; column <= range.last_column;
+           ++column) {
+        ++cell_starts_[row * columns_ + column + 1];
+      }
+    }
+  }
+  for (size_t i = 0; i < cell_count; ++i) {
+    cell_starts_[i + 1] += cell_starts_[i];
+  }
+
+  cell_boxes_.resize(cell_starts_[cell_count]);
+  std::vector<uint32_t> cell_ends(cell_starts_.begin(),
+                                  cell_starts_.end() - 1);
+  for (size_t i = 0; i < box_count_; ++i) {
+    if (!in_grid[i]) {
+      other_boxes_.push_back(static_cast<uint32_t>(i));
+      continue;
+    }
+    CFX_FloatRect normalized = boxes[i];
+    normalized.Normalize();
+    const CellRange range = GetCellRange(normalized);
+    for (size_t row = range.first_row; row <= range.last_row; ++row) {
+      for (size_t column = range.first_column; column <= range.last_column;
+           ++column) {
+        cell_boxes_[cell_ends[row * columns_ + column]++] =
+            static_cast<uint32_t>(i);
+      }
+    }
+  }
+}
+
+CPDF_CharBoxGrid::~CPDF_CharBoxGrid() = default;
+
+std::vector<size_t> CPDF_CharBoxGrid::GetCandidates(
+    const CFX_FloatRect& rect) const {
+  std::vector<size_t> candidates;
+  if (HasNaN(rect)) {
+    // Comparisons with NaN do not tell which boxes such a rect touches.
+    candidates.resize(box_count_);
+    for (size_t i = 0; i < box_count_; ++i) {
+      candidates[i] = i;
+    }
+    return candidates;
+  }
+
+  CFX_FloatRect normalized = rect;
+  normalized.Normalize();
+  const CellRange range = GetCellRange(normalized);
+  for (size_t row = range.first_row; row <= range.last_row; ++row) {
+    for (size_t column = range.first_column; column <= range.last_column;
+         ++column) {
+      const size_t cell = row * columns_ + column;
+      for (uint32_t i = cell_starts_[cell]; i < cell_starts_[cell + 1]; ++i) {
+        candidates.push_back(cell_boxes_[i]);
+      }
+    }
+  }
+  candidates.insert(candidates.end(), other_boxes_.begin(),
+                    other_boxes_.end());
+  std::ranges::sort(candidates);
+  auto duplicates = std::ranges::unique(candidates);
+  candidates.erase(duplicates.begin(), duplicates.end());
+  return candidates;
+}
+
+size_t CPDF_CharBoxGrid::EstimateMemoryUsage() const {
+  return sizeof(*this) +
+         (cell_starts_.capacity() + cell_boxes_.capacity() +
+          other_boxes_.capacity()) *
+             sizeof(uint32_t);
+}
+
+CPDF_CharBoxGrid::CellRange CPDF_CharBoxGrid::GetCellRange(
+    const CFX_FloatRect& rect) const {
+  return {GetColumn(rect.left), GetColumn(rect.right), GetRow(rect.bottom),
+          GetRow(rect.top)};
+}
+
+size_t CPDF_CharBoxGrid::GetColumn(float x) const {
+  return GetCell(x, left_, columns_per_unit_, columns_);
+}
+
+size_t CPDF_CharBoxGrid::GetRow(float y) const {
+  return GetCell(y, bottom_, rows_per_unit_, rows_);
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FPDFTEXT_CPDF_CHARBOXGRID_H_
+#define CORE_FPDFTEXT_CPDF_CHARBOXGRID_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "core/fxcrt/fx_coordinates.h"
+#include "core/fxcrt/span.h"
+
+// Uniform grid over the char boxes of a text page, to find the chars near a
+// point or rect without testing every char on the page.
+class CPDF_CharBoxGrid {
+ public:
+  // `boxes` need not be normalized.
+  explicit CPDF_CharBoxGrid(pdfium::span<const CFX_FloatRect> boxes);
+  ~CPDF_CharBoxGrid();
+
+  // Returns the indices of the boxes that may intersect or touch `rect`, in
+  // ascending order. Always includes the boxes that do, but may include
+  // others, which callers have to test themselves.
+  std::vector<size_t> GetCandidates(const CFX_FloatRect& rect) const;
+
+  size_t EstimateMemoryUsage() const;
+
+ private:
+  struct CellRange {
+    size_t first_column;
+    size_t last_column;
+    size_t first_row;
+    size_t last_row;
+  };
+
+  // `rect` must be normalized.
+  CellRange GetCellRange(const CFX_FloatRect& rect) const;
+  size_t GetColumn(float x) const;
+  size_t GetRow(float y) const;
+
+  const size_t box_count_;
+  size_t columns_ = 1;
+  size_t rows_ = 1;
+  float left_ = 0;
+  float bottom_ = 0;
+  double columns_per_unit_ = 0;
+  double rows_per_unit_ = 0;
+  // The boxes of cell `i` are `cell_boxes_[cell_starts_[i]]` up to
+  // `cell_boxes_[cell_starts_[i + 1]]`, row by row.
+  std::vector<uint32_t> cell_starts_;
+  std::vector<uint32_t> cell_boxes_;
+  // Boxes that span too many cells or are not finite, which are candidates
+  // for every query.
+  std::vector<uint32_t> other_boxes_;
+};
+
+#endif  // CORE_FPDFTEXT_CPDF_CHARBOXGRID_H_
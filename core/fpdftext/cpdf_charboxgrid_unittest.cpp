@@ -0,0 +1,105 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/cpdf_charboxgrid.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using ::testing::ElementsAre;
+using ::testing::IsSupersetOf;
+
+namespace {
+
+bool Touches(const CFX_FloatRect& box, const CFX_FloatRect& rect) {
+  CFX_FloatRect a = box;
+  CFX_FloatRect b = rect;
+  a.Normalize();
+  b.Normalize();
+  return a.left <= b.right && b.left <= a.right && a.bottom <= b.top &&
+         b.bottom <= a.top;
+}
+
+}  // namespace
+
+TEST(CPDFCharBoxGridTest, Empty) {
+  CPDF_CharBoxGrid grid({});
+  EXPECT_TRUE(grid.GetCandidates(CFX_FloatRect(0, 0, 100, 100)).empty());
+}
+
+TEST(CPDFCharBoxGridTest, Candidates) {
+  // A line of 10 chars, an unnormalized char, and one huge char.
+  std::vector<CFX_FloatRect> boxes;
+  for (int i = 0; i < 10; ++i) {
+    boxes.emplace_back(10 * i, 0, 10 * i + 8, 10);
+  }
+  boxes.emplace_back(200, 110, 190, 100);
+  boxes.emplace_back(0, 0, 1000, 1000);
+  CPDF_CharBoxGrid grid(boxes);
+
+  EXPECT_THAT(grid.GetCandidates(CFX_FloatRect(55, 5, 55, 5)),
+              IsSupersetOf({5u, 11u}));
+  EXPECT_THAT(grid.GetCandidates(CFX_FloatRect(195, 105, 195, 105)),
+              IsSupersetOf({10u, 11u}));
+
+  // Touching counts.
+  EXPECT_THAT(grid.GetCandidates(CFX_FloatRect(98, 10, 120, 20)),
+              IsSupersetOf({9u, 11u}));
+
+  const std::vector<size_t> candidates =
+      grid.GetCandidates(CFX_FloatRect(0, 0, 1000, 1000));
+  EXPECT_THAT(candidates,
+              ElementsAre(0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u));
+}
+
+TEST(CPDFCharBoxGridTest, NonFinite) {
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+  constexpr float kInfinity = std::numeric_limits<float>::infinity();
+  std::vector<CFX_FloatRect> boxes = {
+      CFX_FloatRect(0, 0, 10, 10),
+      CFX_FloatRect(kNaN, 0, 10, 10),
+      CFX_FloatRect(0, 0, kInfinity, 10),
+      CFX_FloatRect(500, 500, 510, 510),
+  };
+  CPDF_CharBoxGrid grid(boxes);
+  EXPECT_THAT(grid.GetCandidates(CFX_FloatRect(505, 505, 505, 505)),
+              IsSupersetOf({1u, 2u, 3u}));
+  EXPECT_THAT(grid.GetCandidates(CFX_FloatRect(-kInfinity, -kInfinity,
+                                               kInfinity, kInfinity)),
+              ElementsAre(0u, 1u, 2u, 3u));
+  EXPECT_THAT(grid.GetCandidates(CFX_FloatRect(kNaN, 0, 0, 0)),
+              ElementsAre(0u, 1u, 2u, 3u));
+}
+
+TEST(CPDFCharBoxGridTest, MatchesBruteForce) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> position(-100, 700);
+  std::uniform_real_distribution<float> size(0, 20);
+  std::vector<CFX_FloatRect> boxes;
+  for (int i = 0; i < 2000; ++i) {
+    const float x = position(rng);
+    const float y = position(rng);
+    boxes.emplace_back(x, y, x + size(rng), y + size(rng));
+  }
+  CPDF_CharBoxGrid grid(boxes);
+
+  for (int i = 0; i < 500; ++i) {
+    const float x = position(rng);
+    const float y = position(rng);
+    const CFX_FloatRect rect(x, y, x + size(rng) * (i % 3),
+                             y + size(rng) * (i % 3));
+    const std::vector<size_t> candidates = grid.GetCandidates(rect);
+    ASSERT_TRUE(std::ranges::is_sorted(candidates));
+    for (size_t j = 0; j < boxes.size(); ++j) {
+      if (Touches(boxes[j], rect)) {
+        ASSERT_TRUE(std::ranges::binary_search(candidates, j));
+      }
+    }
+  }
+}
@@ -0,0 +1,85 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/cpdf_documenttextfind.h"
+
+#include <utility>
+
+#include "core/fpdftext/cpdf_textpage.h"
+#include "core/fxcrt/pauseindicator_iface.h"
+
+CPDF_DocumentTextFind::CPDF_DocumentTextFind(
+    CPDF_TextPageCache::Loader loader,
+    size_t max_cache_bytes,
+    int page_count,
+    const WideString& findwhat,
+    const CPDF_TextPageFind::Options& options,
+    int start_page)
+    : cache_(std::move(loader), max_cache_bytes),
+      page_count_(page_count),
+      findwhat_(findwhat),
+      options_(options),
+      start_page_(start_page) {}
+
+CPDF_DocumentTextFind::~CPDF_DocumentTextFind() = default;
+
+CPDF_DocumentTextFind::Status CPDF_DocumentTextFind::FindNext(
+    PauseIndicatorIface* pause) {
+  return Find(/*forward=*/true, pause);
+}
+
+CPDF_DocumentTextFind::Status CPDF_DocumentTextFind::FindPrev(
+    PauseIndicatorIface* pause) {
+  return Find(/*forward=*/false, pause);
+}
+
+CPDF_DocumentTextFind::Status CPDF_DocumentTextFind::Find(
+    bool forward,
+    PauseIndicatorIface* pause) {
+  if (findwhat_.IsEmpty()) {
+    return Status::kNotFound;
+  }
+
+  bool started_page = false;
+  if (!page_index_.has_value()) {
+    if (start_page_ < 0 || start_page_ >= page_count_) {
+      return Status::kNotFound;
+    }
+    StartPage(start_page_, forward);
+    started_page = true;
+  }
+
+  while (true) {
+    if (page_find_ &&
+        (forward ? page_find_->FindNext() : page_find_->FindPrev())) {
+      match_ = Match{page_index_.value(), page_find_->GetCurOrder(),
+                     page_find_->GetMatchedCount()};
+      return Status::kFound;
+    }
+
+    const int next_page = page_index_.value() + (forward ? 1 : -1);
+    if (next_page < 0 || next_page >= page_count_) {
+      return Status::kNotFound;
+    }
+    if (started_page && pause && pause->NeedToPauseNow()) {
+      return Status::kPaused;
+    }
+    StartPage(next_page, forward);
+    started_page = true;
+  }
+}
+
+void CPDF_DocumentTextFind::StartPage(int page_index, bool forward) {
+  // The cache may release the text page `page_find_` points into.
+  page_find_.reset();
+  page_index_ = page_index;
+  const CPDF_TextPage* text_page = cache_.GetPage(page_index);
+  if (!text_page) {
+    return;
+  }
+
+  page_find_ = CPDF_TextPageFind::Create(
+      text_page, findwhat_, options_,
+      forward ? std::optional<size_t>(0) : std::nullopt);
+}
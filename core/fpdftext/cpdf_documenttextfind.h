@@ -0,0 +1,77 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FPDFTEXT_CPDF_DOCUMENTTEXTFIND_H_
+#define CORE_FPDFTEXT_CPDF_DOCUMENTTEXTFIND_H_
+
+#include <memory>
+#include <optional>
+
+#include "core/fpdftext/cpdf_textpagecache.h"
+#include "core/fpdftext/cpdf_textpagefind.h"
+#include "core/fxcrt/widestring.h"
+
+class PauseIndicatorIface;
+
+// Searches the pages of a document one after another, loading each text page
+// only when the search gets to it. Searches can be paused between pages, and
+// recently searched pages are cached, so that searching back and forth does
+// not load them again.
+class CPDF_DocumentTextFind {
+ public:
+  enum class Status {
+    kNotFound,
+    kFound,
+    kPaused,
+  };
+
+  struct Match {
+    int page_index;
+    int char_index;
+    int char_count;
+  };
+
+  // The search starts at `start_page`: FindNext() finds the first match on
+  // it, and FindPrev() the last.
+  CPDF_DocumentTextFind(CPDF_TextPageCache::Loader loader,
+                        size_t max_cache_bytes,
+                        int page_count,
+                        const WideString& findwhat,
+                        const CPDF_TextPageFind::Options& options,
+                        int start_page);
+  ~CPDF_DocumentTextFind();
+
+  // Find the next or previous match, moving on to the next or previous page
+  // when there are no more matches on the current one. With `pause`, returns
+  // kPaused if it asks to pause before another page gets searched; call again
+  // to continue. At least one page is searched per call.
+  Status FindNext(PauseIndicatorIface* pause);
+  Status FindPrev(PauseIndicatorIface* pause);
+
+  // Returns the last match found, if any.
+  std::optional<Match> GetMatch() const { return match_; }
+
+  const CPDF_TextPageCache& cache() const { return cache_; }
+
+ private:
+  Status Find(bool forward, PauseIndicatorIface* pause);
+
+  // Loads `page_index` and starts searching it from its start or its end.
+  // Leaves `page_find_` null if the page fails to load.
+  void StartPage(int page_index, bool forward);
+
+  CPDF_TextPageCache cache_;
+  const int page_count_;
+  const WideString findwhat_;
+  const CPDF_TextPageFind::Options options_;
+  const int start_page_;
+  // The page being searched, once the search started.
+  std::optional<int> page_index_;
+  // Searches `page_index_`. Points into the text page `cache_` returned
+  // last.
+  std::unique_ptr<CPDF_TextPageFind> page_find_;
+  std::optional<Match> match_;
+};
+
+#endif  // CORE_FPDFTEXT_CPDF_DOCUMENTTEXTFIND_H_
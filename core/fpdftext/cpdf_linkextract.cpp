@@ -6,6 +6,7 @@
 
 #include "core/fpdftext/cpdf_linkextract.h"
 
+#include <stdint.h>
 #include <wchar.h>
 
 #include <vector>
@@ -107,6 +108,44 @@ size_t TrimExternalBracketsFromWebLink(const WideString& str,
   return end;
 }
 
+// Looks for what a word cannot be a link without: an '@' for email addresses,
+// or "http" or "www." for web links, ignoring case. Only the words where it
+// finds one need to be copied and checked.
+class LinkCandidateScanner {
+ public:
+  void Reset() {
+    last_chars_ = 0;
+    found_ = false;
+  }
+
+  void Feed(wchar_t ch) {
+    if (ch == L'@') {
+      found_ = true;
+    }
+    // Keep the last 4 chars, one byte each. No non-ASCII char lowercases to
+    // 'h', 't', 'p' or 'w', so ignoring case only takes lowercasing ASCII.
+    uint32_t byte = static_cast<uint32_t>(ch);
+    if (byte >= 0x80) {
+      byte = 0;
+    } else if (FXSYS_IsUpperASCII(ch)) {
+      byte += 'a' - 'A';
+    }
+    last_chars_ = (last_chars_ << 8) | byte;
+    if (last_chars_ == kHttp || last_chars_ == kWww) {
+      found_ = true;
+    }
+  }
+
+  bool found() const { return found_; }
+
+ private:
+  static constexpr uint32_t kHttp = 'h' << 24 | 't' << 16 | 't' << 8 | 'p';
+  static constexpr uint32_t kWww = 'w' << 24 | 'w' << 16 | 'w' << 8 | '.';
+
+  uint32_t last_chars_ = 0;
+  bool found_ = false;
+};
+
 }  // namespace
 
 CPDF_LinkExtract::CPDF_LinkExtract(const CPDF_TextPage* pTextPage)
@@ -120,9 +159,13 @@ void CPDF_LinkExtract::ExtractLinks() {
   size_t pos = 0;
   bool bAfterHyphen = false;
   bool bLineBreak = false;
+  LinkCandidateScanner scanner;
   const size_t nTotalChar = text_page_->CountChars();
   const WideString page_text = text_page_->GetAllPageText();
   while (pos < nTotalChar) {
+    if (pos < page_text.GetLength()) {
+      scanner.Feed(page_text[pos]);
+    }
     const CPDF_TextPage::CharInfo& char_info = text_page_->GetCharInfo(pos);
     if (char_info.char_type() != CPDF_TextPage::CharType::kGenerated &&
         char_info.unicode() != L' ' && pos != nTotalChar - 1) {
@@ -145,6 +188,15 @@ void CPDF_LinkExtract::ExtractLinks() {
       continue;
     }
 
+    // Removing the line breaks may join up what the scanner looks for, so
+    // words with line breaks always get checked.
+    if (!scanner.found() && !bLineBreak) {
+      scanner.Reset();
+      start = ++pos;
+      continue;
+    }
+    scanner.Reset();
+
     WideString strBeCheck = page_text.Substr(start, nCount);
     if (bLineBreak) {
       strBeCheck.Remove(L'\n');
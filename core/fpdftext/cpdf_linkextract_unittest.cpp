@@ -4,8 +4,20 @@
 
 #include "core/fpdftext/cpdf_linkextract.h"
 
+#include <optional>
 #include <utility>
+#include <vector>
 
+#include "core/fpdfapi/page/cpdf_page.h"
+#include "core/fpdfapi/page/test_with_page_module.h"
+#include "core/fpdfapi/parser/cpdf_dictionary.h"
+#include "core/fpdfapi/parser/cpdf_name.h"
+#include "core/fpdfapi/parser/cpdf_reference.h"
+#include "core/fpdfapi/parser/cpdf_stream.h"
+#include "core/fpdfapi/parser/cpdf_test_document.h"
+#include "core/fpdftext/cpdf_textpage.h"
+#include "core/fxcrt/bytestring.h"
+#include "core/fxcrt/retain_ptr.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 // Class to help test functions in CPDF_LinkExtract class.
@@ -180,3 +192,167 @@ TEST(CPDFLinkExtractTest, CheckWebLink) {
     EXPECT_EQ(it.count, maybe_link.value().count_) << it.input_string;
   }
 }
+
+namespace {
+
+// Extracts links the way CPDF_LinkExtract did before it skipped the words
+// that cannot be links, by checking every word on the page.
+class CPDF_ReferenceLinkExtract final : public CPDF_LinkExtract {
+ public:
+  explicit CPDF_ReferenceLinkExtract(const CPDF_TextPage* text_page)
+      : CPDF_LinkExtract(text_page) {}
+
+  void ExtractLinksFromEveryWord() {
+    link_array_.clear();
+    size_t start = 0;
+    size_t pos = 0;
+    bool bAfterHyphen = false;
+    bool bLineBreak = false;
+    const size_t nTotalChar = text_page_->CountChars();
+    const WideString page_text = text_page_->GetAllPageText();
+    while (pos < nTotalChar) {
+      const CPDF_TextPage::CharInfo& char_info = text_page_->GetCharInfo(pos);
+      if (char_info.char_type() != CPDF_TextPage::CharType::kGenerated &&
+          char_info.unicode() != L' ' && pos != nTotalChar - 1) {
+        bAfterHyphen =
+            (char_info.char_type() == CPDF_TextPage::CharType::kHyphen ||
+             (char_info.char_type() == CPDF_TextPage::CharType::kNormal &&
+              char_info.unicode() == L'-'));
+        ++pos;
+        continue;
+      }
+
+      size_t nCount = pos - start;
+      if (pos == nTotalChar - 1) {
+        ++nCount;
+      } else if (bAfterHyphen && (char_info.unicode() == L'\n' ||
+                                  char_info.unicode() == L'\r')) {
+        bLineBreak = true;
+        ++pos;
+        continue;
+      }
+
+      WideString strBeCheck = page_text.Substr(start, nCount);
+      if (bLineBreak) {
+        strBeCheck.Remove(L'\n');
+        strBeCheck.Remove(L'\r');
+        bLineBreak = false;
+      }
+      strBeCheck.Replace(L"\xfffe", L"-");
+
+      if (strBeCheck.GetLength() > 5) {
+        while (strBeCheck.GetLength() > 0) {
+          wchar_t ch = strBeCheck.Back();
+          if (ch != L')' && ch != L',' && ch != L'>' && ch != L'.') {
+            break;
+          }
+          strBeCheck = strBeCheck.First(strBeCheck.GetLength() - 1);
+          nCount--;
+        }
+        if (nCount > 5) {
+          auto maybe_link = CheckWebLink(strBeCheck);
+          if (maybe_link.has_value()) {
+            maybe_link.value().start_ += start;
+            link_array_.push_back(maybe_link.value());
+          } else if (CheckMailLink(&strBeCheck)) {
+            link_array_.push_back(Link{{start, nCount}, strBeCheck});
+          }
+        }
+      }
+      start = ++pos;
+    }
+  }
+};
+
+class CPDFLinkExtractPageTest : public TestWithPageModule {
+ protected:
+  // Returns a page that shows each of `lines` in Helvetica, one below the
+  // other.
+  static RetainPtr<CPDF_Page> CreatePage(CPDF_Document* doc,
+                                         const std::vector<ByteString>& lines) {
+    RetainPtr<CPDF_Dictionary> page_dict = doc->CreateNewPage(0);
+    auto font_dict = page_dict->SetNewFor<CPDF_Dictionary>("Resources")
+                         ->SetNewFor<CPDF_Dictionary>("Font")
+                         ->SetNewFor<CPDF_Dictionary>("F1");
+    font_dict->SetNewFor<CPDF_Name>("Type", "Font");
+    font_dict->SetNewFor<CPDF_Name>("Subtype", "Type1");
+    font_dict->SetNewFor<CPDF_Name>("BaseFont", "Helvetica");
+
+    ByteString content = "BT /F1 4 Tf 10 780 Td ";
+    for (const ByteString& line : lines) {
+      content += "(" + line + ") Tj 0 -5 Td ";
+    }
+    content += "ET";
+    auto stream = doc->NewIndirect<CPDF_Stream>(content.unsigned_span());
+    page_dict->SetNewFor<CPDF_Reference>("Contents", doc, stream->GetObjNum());
+
+    auto page = pdfium::MakeRetain<CPDF_Page>(doc, page_dict);
+    page->ParseContent();
+    return page;
+  }
+
+  // Checks that CPDF_LinkExtract finds the same links in `lines` as checking
+  // every word does, and returns their URLs.
+  std::vector<WideString> ExtractLinks(const std::vector<ByteString>& lines) {
+    CPDF_TestDocument doc;
+    doc.CreateNewDoc();
+    RetainPtr<CPDF_Page> page = CreatePage(&doc, lines);
+    CPDF_TextPage text_page(page.Get(), /*rtl=*/false);
+
+    CPDF_LinkExtract extract(&text_page);
+    extract.ExtractLinks();
+    CPDF_ReferenceLinkExtract reference(&text_page);
+    reference.ExtractLinksFromEveryWord();
+
+    std::vector<WideString> urls;
+    EXPECT_EQ(reference.CountLinks(), extract.CountLinks());
+    for (size_t i = 0; i < extract.CountLinks(); ++i) {
+      urls.push_back(extract.GetURL(i));
+      if (i >= reference.CountLinks()) {
+        continue;
+      }
+      EXPECT_EQ(reference.GetURL(i), extract.GetURL(i));
+      std::optional<CPDF_LinkExtract::Range> range = extract.GetTextRange(i);
+      std::optional<CPDF_LinkExtract::Range> reference_range =
+          reference.GetTextRange(i);
+      EXPECT_TRUE(range.has_value());
+      EXPECT_TRUE(reference_range.has_value());
+      if (range.has_value() && reference_range.has_value()) {
+        EXPECT_EQ(reference_range->start_, range->start_);
+        EXPECT_EQ(reference_range->count_, range->count_);
+      }
+    }
+    return urls;
+  }
+};
+
+}  // namespace
+
+TEST_F(CPDFLinkExtractPageTest, MixedCaseMarkers) {
+  std::vector<WideString> urls = ExtractLinks(
+      {"Visit HTTP://Example.COM/Path or HtTpS://example.net today,",
+       "and WWW.Example.ORG, or wWw.example.info."});
+  ASSERT_EQ(4u, urls.size());
+  EXPECT_EQ(L"HTTP://Example.COM/Path", urls[0]);
+  EXPECT_EQ(L"HtTpS://example.net", urls[1]);
+  EXPECT_EQ(L"http://WWW.Example.ORG", urls[2]);
+  EXPECT_EQ(L"http://wWw.example.info", urls[3]);
+}
+
+TEST_F(CPDFLinkExtractPageTest, MarkerAfterHyphenatedLineBreak) {
+  std::vector<WideString> urls = ExtractLinks(
+      {"Mail the-", "team@example.com or ht-", "tp://example.com/split or",
+       "www-", ".example.org now."});
+  ASSERT_FALSE(urls.empty());
+  EXPECT_EQ(L"mailto:the-team@example.com", urls[0]);
+}
+
+TEST_F(CPDFLinkExtractPageTest, LongPageWithoutLinks) {
+  std::vector<ByteString> lines;
+  for (int i = 0; i < 150; ++i) {
+    lines.push_back(
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+        "eiusmod tempor incididunt ut labore et dolore magna aliqua. Wh-");
+  }
+  EXPECT_TRUE(ExtractLinks(lines).empty());
+}
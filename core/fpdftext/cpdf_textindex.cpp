@@ -0,0 +1,276 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/cpdf_textindex.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "core/fxcrt/byteorder.h"
+#include "core/fxcrt/bytestring.h"
+#include "core/fxcrt/fx_extension.h"
+#include "core/fxcrt/fx_safe_types.h"
+#include "core/fxcrt/span_util.h"
+
+namespace {
+
+// "PTIX" when read as little-endian.
+constexpr uint32_t kSerializedMagic = 0x58495450;
+// Version 1 left words without char indices out of the word indices, so its
+// phrases could span them.
+constexpr uint32_t kSerializedVersion = 2;
+
+// Bytes per serialized posting.
+constexpr size_t kPostingSize = 16;
+
+// Scripts that are written without spaces between words.
+bool IsSpacelessScriptChar(wchar_t c) {
+  return (c >= 0x3040 && c <= 0x30FF) ||  // Hiragana and Katakana.
+         (c >= 0x3400 && c <= 0x4DBF) ||  // CJK Unified Ideographs Ext. A.
+         (c >= 0x4E00 && c <= 0x9FFF) ||  // CJK Unified Ideographs.
+         (c >= 0xF900 && c <= 0xFAFF);    // CJK Compatibility Ideographs.
+}
+
+// Calls `callback` with the start and length of each word in `text`.
+template <typename Callback>
+void ForEachWord(WideStringView text, const Callback& callback) {
+  std::optional<size_t> word_start;
+  for (size_t i = 0; i < text.GetLength(); ++i) {
+    const wchar_t c = text[i];
+    const bool spaceless = IsSpacelessScriptChar(c);
+    if (word_start.has_value() && (spaceless || !FXSYS_iswalnum(c))) {
+      callback(word_start.value(), i - word_start.value());
+      word_start.reset();
+    }
+    if (spaceless) {
+      callback(i, 1);
+    } else if (!word_start.has_value() && FXSYS_iswalnum(c)) {
+      word_start = i;
+    }
+  }
+  if (word_start.has_value()) {
+    callback(word_start.value(), text.GetLength() - word_start.value());
+  }
+}
+
+// Matches how CPDF_TextPageFind compares text when not matching case. Both
+// only lowercase, as CPDF_TextPage has already applied
+// GetUnicodeNormalization() to page text, e.g. to split up ligatures. Neither
+// normalizes queries beyond that.
+WideString NormalizeWord(WideStringView word) {
+  WideString result(word);
+  result.MakeLower();
+  return result;
+}
+
+void AppendUInt32(uint32_t value, DataVector<uint8_t>& output) {
+  output.resize(output.size() + 4);
+  fxcrt::PutUInt32LSBFirst(value, pdfium::span(output).last<4>());
+}
+
+// Reads what AppendUInt32() and friends wrote, failing once data runs out.
+class SerializedReader {
+ public:
+  explicit SerializedReader(pdfium::span<const uint8_t> data) : data_(data) {}
+
+  std::optional<uint32_t> ReadUInt32() {
+    if (data_.size() < 4) {
+      return std::nullopt;
+    }
+    uint32_t value = fxcrt::GetUInt32LSBFirst(data_.first<4>());
+    data_ = data_.subspan<4>();
+    return value;
+  }
+
+  std::optional<pdfium::span<const uint8_t>> ReadBytes(size_t size) {
+    if (data_.size() < size) {
+      return std::nullopt;
+    }
+    pdfium::span<const uint8_t> bytes = data_.first(size);
+    data_ = data_.subspan(size);
+    return bytes;
+  }
+
+  size_t remaining() const { return data_.size(); }
+
+ private:
+  pdfium::span<const uint8_t> data_;
+};
+
+}  // namespace
+
+// static
+std::unique_ptr<CPDF_TextIndex> CPDF_TextIndex::Deserialize(
+    pdfium::span<const uint8_t> data) {
+  SerializedReader reader(data);
+  if (reader.ReadUInt32() != kSerializedMagic ||
+      reader.ReadUInt32() != kSerializedVersion) {
+    return nullptr;
+  }
+
+  std::optional<uint32_t> page_count = reader.ReadUInt32();
+  std::optional<uint32_t> word_count = reader.ReadUInt32();
+  if (!page_count.has_value() || !word_count.has_value() ||
+      page_count.value() > std::numeric_limits<int>::max()) {
+    return nullptr;
+  }
+
+  auto index = std::make_unique<CPDF_TextIndex>();
+  index->page_count_ = static_cast<int>(page_count.value());
+  for (uint32_t i = 0; i < word_count.value(); ++i) {
+    std::optional<uint32_t> word_size = reader.ReadUInt32();
+    if (!word_size.has_value() || word_size.value() == 0) {
+      return nullptr;
+    }
+    std::optional<pdfium::span<const uint8_t>> word_bytes =
+        reader.ReadBytes(word_size.value());
+    std::optional<uint32_t> posting_count = reader.ReadUInt32();
+    if (!word_bytes.has_value() || !posting_count.has_value() ||
+        posting_count.value() == 0 ||
+        posting_count.value() > reader.remaining() / kPostingSize) {
+      return nullptr;
+    }
+
+    auto [it, inserted] = index->postings_.try_emplace(
+        WideString::FromUTF8(ByteStringView(word_bytes.value())));
+    if (!inserted) {
+      return nullptr;
+    }
+
+    std::vector<Posting>& postings = it->second;
+    postings.reserve(posting_count.value());
+    for (uint32_t j = 0; j < posting_count.value(); ++j) {
+      Posting posting;
+      posting.page_index = reader.ReadUInt32().value();
+      posting.word_index = reader.ReadUInt32().value();
+      posting.char_index = reader.ReadUInt32().value();
+      posting.char_count = reader.ReadUInt32().value();
+      FX_SAFE_INT32 char_end = posting.char_index;
+      char_end += posting.char_count;
+      if (posting.page_index >= page_count.value() ||
+          posting.char_count == 0 || !char_end.IsValid()) {
+        return nullptr;
+      }
+      // Find() relies on the order.
+      if (!postings.empty() &&
+          std::pair(postings.back().page_index, postings.back().word_index) >=
+              std::pair(posting.page_index, posting.word_index)) {
+        return nullptr;
+      }
+      postings.push_back(posting);
+    }
+  }
+  if (reader.remaining() != 0) {
+    return nullptr;
+  }
+  return index;
+}
+
+CPDF_TextIndex::CPDF_TextIndex() = default;
+
+CPDF_TextIndex::~CPDF_TextIndex() = default;
+
+void CPDF_TextIndex::AddPage(WideStringView text,
+                             pdfium::span<const int> char_indices) {
+  const uint32_t page_index = page_count_++;
+  uint32_t word_index = 0;
+  ForEachWord(text, [&](size_t start, size_t length) {
+    // Count words that get left out too, so phrases do not span them.
+    const uint32_t this_word_index = word_index++;
+    const size_t end = start + length - 1;
+    if (end >= char_indices.size()) {
+      return;
+    }
+
+    const int first_char = char_indices[start];
+    const int last_char = char_indices[end];
+    if (first_char < 0 || last_char < first_char) {
+      return;
+    }
+
+    postings_[NormalizeWord(text.Substr(start, length))].push_back(
+        {page_index, this_word_index, static_cast<uint32_t>(first_char),
+         static_cast<uint32_t>(last_char - first_char + 1)});
+  });
+}
+
+std::vector<CPDF_TextIndex::Hit> CPDF_TextIndex::Find(
+    WideStringView query) const {
+  std::vector<const std::vector<Posting>*> word_postings;
+  bool all_found = true;
+  ForEachWord(query, [&](size_t start, size_t length) {
+    auto it = postings_.find(NormalizeWord(query.Substr(start, length)));
+    if (it == postings_.end()) {
+      all_found = false;
+      return;
+    }
+    word_postings.push_back(&it->second);
+  });
+
+  std::vector<Hit> hits;
+  if (!all_found || word_postings.empty()) {
+    return hits;
+  }
+
+  // Returns the posting on `page_index` at `word_index`, if any.
+  auto find_posting = [](const std::vector<Posting>& postings,
+                         uint32_t page_index,
+                         uint32_t word_index) -> const Posting* {
+    auto it = std::ranges::lower_bound(
+        postings, std::pair(page_index, word_index), std::less<>(),
+        [](const Posting& posting) {
+          return std::pair(posting.page_index, posting.word_index);
+        });
+    if (it == postings.end() || it->page_index != page_index ||
+        it->word_index != word_index) {
+      return nullptr;
+    }
+    return &*it;
+  };
+
+  for (const Posting& first : *word_postings.front()) {
+    const Posting* last = &first;
+    for (size_t i = 1; i < word_postings.size() && last; ++i) {
+      last = find_posting(*word_postings[i], first.page_index,
+                          first.word_index + static_cast<uint32_t>(i));
+    }
+    if (!last) {
+      continue;
+    }
+
+    const uint32_t char_end = last->char_index + last->char_count;
+    if (char_end <= first.char_index) {
+      continue;
+    }
+    hits.push_back({static_cast<int>(first.page_index),
+                    static_cast<int>(first.char_index),
+                    static_cast<int>(char_end - first.char_index)});
+  }
+  return hits;
+}
+
+DataVector<uint8_t> CPDF_TextIndex::Serialize() const {
+  DataVector<uint8_t> result;
+  AppendUInt32(kSerializedMagic, result);
+  AppendUInt32(kSerializedVersion, result);
+  AppendUInt32(page_count_, result);
+  AppendUInt32(static_cast<uint32_t>(postings_.size()), result);
+  for (const auto& [word, postings] : postings_) {
+    const ByteString word_bytes = word.ToUTF8();
+    AppendUInt32(static_cast<uint32_t>(word_bytes.GetLength()), result);
+    result.insert(result.end(), word_bytes.unsigned_span().begin(),
+                  word_bytes.unsigned_span().end());
+    AppendUInt32(static_cast<uint32_t>(postings.size()), result);
+    for (const Posting& posting : postings) {
+      AppendUInt32(posting.page_index, result);
+      AppendUInt32(posting.word_index, result);
+      AppendUInt32(posting.char_index, result);
+      AppendUInt32(posting.char_count, result);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,68 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FPDFTEXT_CPDF_TEXTINDEX_H_
+#define CORE_FPDFTEXT_CPDF_TEXTINDEX_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "core/fxcrt/data_vector.h"
+#include "core/fxcrt/span.h"
+#include "core/fxcrt/widestring.h"
+
+// Inverted index over the words of a document's pages, so that a search need
+// not load and scan every page. Words are lowercased runs of letters and
+// digits, except that CJK ideographs and kana, which are written without
+// spaces, are words of their own. Pages get added in order, so the index can
+// be built a few pages at a time, and saved to reuse later.
+class CPDF_TextIndex {
+ public:
+  struct Hit {
+    int page_index;
+    // The same char indices as CPDF_TextPage uses.
+    int char_index;
+    int char_count;
+  };
+
+  // Returns nullptr if `data` is not the result of Serialize().
+  static std::unique_ptr<CPDF_TextIndex> Deserialize(
+      pdfium::span<const uint8_t> data);
+
+  CPDF_TextIndex();
+  ~CPDF_TextIndex();
+
+  // Adds `text` as the page after the last one added, starting at page 0.
+  // `char_indices` has the char index of each char in `text`, as returned by
+  // CPDF_TextPage::GetCharIndicesOfText().
+  void AddPage(WideStringView text, pdfium::span<const int> char_indices);
+
+  // Returns where the words of `query` occur in a row on the same page,
+  // ignoring case, ordered by page and char index.
+  std::vector<Hit> Find(WideStringView query) const;
+
+  DataVector<uint8_t> Serialize() const;
+
+  int page_count() const { return page_count_; }
+
+ private:
+  // One occurrence of a word.
+  struct Posting {
+    uint32_t page_index;
+    // Counts the words on the page before this one, including those without
+    // postings.
+    uint32_t word_index;
+    uint32_t char_index;
+    uint32_t char_count;
+  };
+
+  int page_count_ = 0;
+  // Postings are ordered by page and word index, as pages are added in order.
+  std::map<WideString, std::vector<Posting>> postings_;
+};
+
+#endif  // CORE_FPDFTEXT_CPDF_TEXTINDEX_H_
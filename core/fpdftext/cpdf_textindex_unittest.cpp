@@ -0,0 +1,196 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/cpdf_textindex.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "core/fxcrt/data_vector.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Returns char indices for `text` as if each char of it were a char on the
+// page, offset by `offset`.
+std::vector<int> SequentialCharIndices(WideStringView text, int offset) {
+  std::vector<int> result(text.GetLength());
+  for (size_t i = 0; i < result.size(); ++i) {
+    result[i] = static_cast<int>(i) + offset;
+  }
+  return result;
+}
+
+void AddPage(CPDF_TextIndex& index, WideStringView text) {
+  index.AddPage(text, SequentialCharIndices(text, 0));
+}
+
+}  // namespace
+
+TEST(CPDFTextIndexTest, FindWords) {
+  CPDF_TextIndex index;
+  AddPage(index, L"Hello, world!\r\nGoodbye, world!");
+  AddPage(index, L"hello again");
+  EXPECT_EQ(2, index.page_count());
+
+  std::vector<CPDF_TextIndex::Hit> hits = index.Find(L"WORLD");
+  ASSERT_EQ(2u, hits.size());
+  EXPECT_EQ(0, hits[0].page_index);
+  EXPECT_EQ(7, hits[0].char_index);
+  EXPECT_EQ(5, hits[0].char_count);
+  EXPECT_EQ(0, hits[1].page_index);
+  EXPECT_EQ(24, hits[1].char_index);
+  EXPECT_EQ(5, hits[1].char_count);
+
+  hits = index.Find(L"hello");
+  ASSERT_EQ(2u, hits.size());
+  EXPECT_EQ(0, hits[0].page_index);
+  EXPECT_EQ(0, hits[0].char_index);
+  EXPECT_EQ(1, hits[1].page_index);
+  EXPECT_EQ(0, hits[1].char_index);
+
+  EXPECT_TRUE(index.Find(L"hell").empty());
+  EXPECT_TRUE(index.Find(L"").empty());
+  EXPECT_TRUE(index.Find(L", !").empty());
+}
+
+TEST(CPDFTextIndexTest, FindPhrases) {
+  CPDF_TextIndex index;
+  AddPage(index, L"Hello, world!\r\nGoodbye, world!");
+  AddPage(index, L"world hello");
+
+  // Punctuation and line breaks between the words do not matter.
+  std::vector<CPDF_TextIndex::Hit> hits = index.Find(L"hello world");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(0, hits[0].page_index);
+  EXPECT_EQ(0, hits[0].char_index);
+  EXPECT_EQ(12, hits[0].char_count);
+
+  hits = index.Find(L"world goodbye");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(0, hits[0].page_index);
+  EXPECT_EQ(7, hits[0].char_index);
+  EXPECT_EQ(15, hits[0].char_count);
+
+  // Phrases do not span pages.
+  EXPECT_TRUE(index.Find(L"world world").empty());
+  EXPECT_TRUE(index.Find(L"hello missing").empty());
+}
+
+TEST(CPDFTextIndexTest, CharIndices) {
+  CPDF_TextIndex index;
+  // The generated line break is not a char on the page.
+  const std::vector<int> char_indices = {10, 11, -1, -1, 12, 13};
+  index.AddPage(L"ab\r\ncd", char_indices);
+
+  std::vector<CPDF_TextIndex::Hit> hits = index.Find(L"ab cd");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(10, hits[0].char_index);
+  EXPECT_EQ(4, hits[0].char_count);
+
+  // Words without char indices are left out.
+  CPDF_TextIndex short_index;
+  short_index.AddPage(L"ab cd", std::vector<int>{0, 1});
+  EXPECT_EQ(1u, short_index.Find(L"ab").size());
+  EXPECT_TRUE(short_index.Find(L"cd").empty());
+}
+
+TEST(CPDFTextIndexTest, PhrasesAroundLeftOutWords) {
+  CPDF_TextIndex index;
+  // "gen" is made of generated chars, so it is left out.
+  const std::vector<int> char_indices = {0, 1, -1, -1, -1, -1, -1, 2, 3};
+  index.AddPage(L"ab gen cd", char_indices);
+
+  EXPECT_TRUE(index.Find(L"gen").empty());
+  EXPECT_TRUE(index.Find(L"ab cd").empty());
+  EXPECT_TRUE(index.Find(L"ab gen cd").empty());
+
+  std::vector<CPDF_TextIndex::Hit> hits = index.Find(L"cd");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(2, hits[0].char_index);
+  EXPECT_EQ(2, hits[0].char_count);
+
+  // Saving and loading keeps the gap.
+  std::unique_ptr<CPDF_TextIndex> loaded =
+      CPDF_TextIndex::Deserialize(index.Serialize());
+  ASSERT_TRUE(loaded);
+  EXPECT_TRUE(loaded->Find(L"ab cd").empty());
+  EXPECT_EQ(1u, loaded->Find(L"cd").size());
+}
+
+TEST(CPDFTextIndexTest, SpacelessScripts) {
+  CPDF_TextIndex index;
+  AddPage(index, L"\x6771\x4eac\x90fd abc\x3068\x3046");
+
+  // Each ideograph is a word, so any run of them can be found.
+  std::vector<CPDF_TextIndex::Hit> hits = index.Find(L"\x4eac\x90fd");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(1, hits[0].char_index);
+  EXPECT_EQ(2, hits[0].char_count);
+
+  hits = index.Find(L"abc\x3068");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(4, hits[0].char_index);
+  EXPECT_EQ(4, hits[0].char_count);
+}
+
+TEST(CPDFTextIndexTest, SerializeRoundTrip) {
+  CPDF_TextIndex index;
+  AddPage(index, L"Hello, world!");
+  AddPage(index, L"");
+  AddPage(index, L"caf\xe9 world");
+
+  DataVector<uint8_t> data = index.Serialize();
+  std::unique_ptr<CPDF_TextIndex> loaded = CPDF_TextIndex::Deserialize(data);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(3, loaded->page_count());
+  EXPECT_EQ(data, loaded->Serialize());
+
+  std::vector<CPDF_TextIndex::Hit> hits = loaded->Find(L"CAF\xc9 WORLD");
+  ASSERT_EQ(1u, hits.size());
+  EXPECT_EQ(2, hits[0].page_index);
+  EXPECT_EQ(0, hits[0].char_index);
+  EXPECT_EQ(10, hits[0].char_count);
+
+  // Loaded indices can keep growing.
+  AddPage(*loaded, L"world");
+  EXPECT_EQ(3u, loaded->Find(L"world").size());
+}
+
+TEST(CPDFTextIndexTest, DeserializeInvalid) {
+  EXPECT_FALSE(CPDF_TextIndex::Deserialize({}));
+
+  CPDF_TextIndex index;
+  AddPage(index, L"Hello, world!");
+  const DataVector<uint8_t> data = index.Serialize();
+
+  // Every truncation fails.
+  for (size_t size = 0; size < data.size(); ++size) {
+    EXPECT_FALSE(
+        CPDF_TextIndex::Deserialize(pdfium::span(data).first(size)))
+        << size;
+  }
+
+  DataVector<uint8_t> trailing = data;
+  trailing.push_back(0);
+  EXPECT_FALSE(CPDF_TextIndex::Deserialize(trailing));
+
+  DataVector<uint8_t> bad_magic = data;
+  bad_magic[0] ^= 1;
+  EXPECT_FALSE(CPDF_TextIndex::Deserialize(bad_magic));
+
+  // Other versions fail, including earlier ones.
+  for (uint8_t version : {1, 3}) {
+    DataVector<uint8_t> bad_version = data;
+    bad_version[4] = version;
+    EXPECT_FALSE(CPDF_TextIndex::Deserialize(bad_version)) << version;
+  }
+
+  // Postings must be on pages the index has.
+  DataVector<uint8_t> no_pages = data;
+  no_pages[8] = 0;
+  EXPECT_FALSE(CPDF_TextIndex::Deserialize(no_pages));
+}
@@ -11,6 +11,8 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -23,7 +25,8 @@
 #include "core/fpdfapi/page/cpdf_textobject.h"
 #include "core/fpdfapi/parser/cpdf_dictionary.h"
 #include "core/fpdfapi/parser/cpdf_string.h"
-#include "core/fpdftext/unicodenormalizationdata.h"
+#include "core/fpdftext/cpdf_charboxgrid.h"
+#include "core/fpdftext/unicodenormalization.h"
 #include "core/fxcrt/check.h"
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/compiler_specific.h"
@@ -32,6 +35,7 @@
 #include "core/fxcrt/fx_extension.h"
 #include "core/fxcrt/fx_unicode.h"
 #include "core/fxcrt/notreached.h"
+#include "core/fxcrt/numerics/safe_conversions.h"
 #include "core/fxcrt/span.h"
 #include "core/fxcrt/stl_util.h"
 
@@ -39,10 +43,14 @@ namespace {
 
 constexpr float kDefaultFontSize = 1.0f;
 constexpr float kSizeEpsilon = 0.01f;
-constexpr std::array<pdfium::span<const uint16_t>, 3>
-    kUnicodeDataNormalizationMaps = {{kUnicodeDataNormalizationMap2,
-                                      kUnicodeDataNormalizationMap3,
-                                      kUnicodeDataNormalizationMap4}};
+
+// Pages with fewer chars than this are searched by position without a
+// CPDF_CharBoxGrid, as testing every char is about as fast.
+constexpr size_t kMinCharsForGrid = 128;
+
+// Relative padding for position queries on the CPDF_CharBoxGrid, so that it
+// finds every char the float math of the exact tests may accept.
+constexpr float kRoundingPadding = 1e-5f;
 
 float NormalizeThreshold(float threshold, int t1, int t2, int t3) {
   DCHECK(t1 < t2);
@@ -98,28 +106,6 @@ float CalculateBaseSpaceAdjustment(const CPDF_TextObject* pTextObj,
   return 0.0f;
 }
 
-DataVector<wchar_t> GetUnicodeNormalization(wchar_t wch) {
-  wch = wch & 0xFFFF;
-  wchar_t wFind = kUnicodeDataNormalization[wch];
-  if (!wFind) {
-    return DataVector<wchar_t>(1, wch);
-  }
-  if (wFind >= 0x8000) {
-    return DataVector<wchar_t>(1,
-                               kUnicodeDataNormalizationMap1[wFind - 0x8000]);
-  }
-  wch = wFind & 0x0FFF;
-  wFind >>= 12;
-  auto pMap = kUnicodeDataNormalizationMaps[wFind - 2].subspan(
-      static_cast<size_t>(wch));
-  if (wFind == 4) {
-    wFind = pMap.front();
-    pMap = pMap.subspan<1u>();
-  }
-  const auto range = pMap.first(static_cast<size_t>(wFind));
-  return DataVector<wchar_t>(range.begin(), range.end());
-}
-
 float MaskPercentFilled(const std::vector<bool>& mask,
                         int32_t start,
                         int32_t end) {
@@ -345,24 +331,18 @@ CPDF_TextPage::TransformedTextObject::TransformedTextObject(
 
 CPDF_TextPage::TransformedTextObject::~TransformedTextObject() = default;
 
-CPDF_TextPage::CharInfo::CharInfo() = default;
-
 CPDF_TextPage::CharInfo::CharInfo(CharType char_type,
                                   uint32_t char_code,
                                   wchar_t unicode,
                                   CFX_PointF origin,
                                   CFX_FloatRect char_box,
-                                  CFX_Matrix matrix,
-                                  CPDF_TextObject* text_object)
-    : char_type_(char_type),
-      unicode_(unicode),
-      char_code_(char_code),
+                                  const SharedCharInfo* shared)
+    : shared_(shared),
       origin_(origin),
       char_box_(char_box),
-      matrix_(matrix),
-      text_object_(text_object) {
-  loose_char_box_ = GetLooseBounds(*this);
-}
+      unicode_(unicode),
+      char_code_(char_code),
+      char_type_(char_type) {}
 
 CPDF_TextPage::CharInfo::CharInfo(const CharInfo&) = default;
 
@@ -373,6 +353,14 @@ CPDF_TextPage::CPDF_TextPage(const CPDF_Page* pPage, bool rtl)
   Init();
 }
 
+CPDF_TextPage::CPDF_TextPage(RetainPtr<const CPDF_Page> pPage, bool rtl)
+    : retained_page_(std::move(pPage)),
+      page_(retained_page_.Get()),
+      rtl_(rtl),
+      display_matrix_(page_->GetDisplayMatrix()) {
+  Init();
+}
+
 CPDF_TextPage::~CPDF_TextPage() = default;
 
 void CPDF_TextPage::Init() {
@@ -430,6 +418,16 @@ int CPDF_TextPage::TextIndexFromCharIndex(int char_index) const {
   return -1;
 }
 
+DataVector<int> CPDF_TextPage::GetCharIndicesOfText() const {
+  DataVector<int> result;
+  for (const auto& info : char_indices_) {
+    for (int i = 0; i < info.count; ++i) {
+      result.push_back(info.index + i);
+    }
+  }
+  return result;
+}
+
 std::vector<CFX_FloatRect> CPDF_TextPage::GetRectArray(int start,
                                                        int count) const {
   std::vector<CFX_FloatRect> rects;
@@ -482,18 +480,34 @@ std::vector<CFX_FloatRect> CPDF_TextPage::GetRectArray(int start,
 
 int CPDF_TextPage::GetIndexAtPos(const CFX_PointF& point,
                                  const CFX_SizeF& tolerance) const {
-  int pos;
+  const bool use_tolerance = !(tolerance.width <= 0 && tolerance.height <= 0);
+  std::optional<std::vector<size_t>> candidates;
+  if (const CPDF_CharBoxGrid* grid = GetCharBoxGrid()) {
+    // Chars within the tolerance, padded for rounding in the tests below.
+    const float half_width =
+        use_tolerance ? std::max(tolerance.width / 2, 0.0f) : 0.0f;
+    const float half_height =
+        use_tolerance ? std::max(tolerance.height / 2, 0.0f) : 0.0f;
+    const float dx =
+        half_width + kRoundingPadding * (1 + fabsf(point.x) + half_width);
+    const float dy =
+        half_height + kRoundingPadding * (1 + fabsf(point.y) + half_height);
+    candidates = grid->GetCandidates(CFX_FloatRect(
+        point.x - dx, point.y - dy, point.x + dx, point.y + dy));
+  }
+
   int NearPos = -1;
   double xdif = 5000;
   double ydif = 5000;
-  const int nCount = CountChars();
-  for (pos = 0; pos < nCount; ++pos) {
+  const size_t count = candidates ? candidates->size() : char_list_.size();
+  for (size_t i = 0; i < count; ++i) {
+    const size_t pos = candidates ? (*candidates)[i] : i;
     const CFX_FloatRect& orig_charrect = char_list_[pos].char_box();
     if (orig_charrect.Contains(point)) {
-      break;
+      return pdfium::checked_cast<int>(pos);
     }
 
-    if (tolerance.width <= 0 && tolerance.height <= 0) {
+    if (!use_tolerance) {
       continue;
     }
 
@@ -514,50 +528,83 @@ int CPDF_TextPage::GetIndexAtPos(const CFX_PointF& point,
     if (curYdif + curXdif < xdif + ydif) {
       ydif = curYdif;
       xdif = curXdif;
-      NearPos = pos;
+      NearPos = pdfium::checked_cast<int>(pos);
     }
   }
-  return pos < nCount ? pos : NearPos;
+  return NearPos;
 }
 
 WideString CPDF_TextPage::GetTextByPredicate(
     const std::function<bool(const CharInfo&)>& predicate) const {
+  std::vector<size_t> indices;
+  for (size_t i = 0; i < char_list_.size(); ++i) {
+    if (predicate(char_list_[i])) {
+      indices.push_back(i);
+    }
+  }
+  return GetTextOfChars(indices);
+}
+
+WideString CPDF_TextPage::GetTextOfChars(
+    const std::vector<size_t>& indices) const {
   float posy = 0;
   bool IsContainPreChar = false;
   bool IsAddLineFeed = false;
   WideString strText;
-  for (const auto& charinfo : char_list_) {
-    if (predicate(charinfo)) {
-      if (fabs(posy - charinfo.origin().y) > 0 && !IsContainPreChar &&
-          IsAddLineFeed) {
-        posy = charinfo.origin().y;
-        if (!strText.IsEmpty()) {
-          strText += L"\r\n";
-        }
-      }
-      IsContainPreChar = true;
-      IsAddLineFeed = false;
-      if (charinfo.unicode()) {
-        strText += charinfo.unicode();
-      }
-    } else if (charinfo.unicode() == L' ') {
-      if (IsContainPreChar) {
+  size_t next = 0;
+  for (size_t index : indices) {
+    if (index > next) {
+      // Of the chars in between, a space right after a selected char is kept,
+      // and any other char that is not a space starts a new line.
+      size_t skipped = next;
+      if (IsContainPreChar && char_list_[skipped].unicode() == L' ') {
         strText += L' ';
-        IsContainPreChar = false;
         IsAddLineFeed = false;
+        ++skipped;
       }
-    } else {
       IsContainPreChar = false;
-      IsAddLineFeed = true;
+      for (; skipped < index; ++skipped) {
+        if (char_list_[skipped].unicode() != L' ') {
+          IsAddLineFeed = true;
+          break;
+        }
+      }
     }
+    const CharInfo& charinfo = char_list_[index];
+    if (fabs(posy - charinfo.origin().y) > 0 && !IsContainPreChar &&
+        IsAddLineFeed) {
+      posy = charinfo.origin().y;
+      if (!strText.IsEmpty()) {
+        strText += L"\r\n";
+      }
+    }
+    IsContainPreChar = true;
+    IsAddLineFeed = false;
+    if (charinfo.unicode()) {
+      strText += charinfo.unicode();
+    }
+    next = index + 1;
+  }
+  if (IsContainPreChar && next < char_list_.size() &&
+      char_list_[next].unicode() == L' ') {
+    strText += L' ';
   }
   return strText;
 }
 
 WideString CPDF_TextPage::GetTextByRect(const CFX_FloatRect& rect) const {
-  return GetTextByPredicate([&rect](const CharInfo& charinfo) {
-    return IsRectIntersect(rect, charinfo.char_box());
+  const CPDF_CharBoxGrid* grid = GetCharBoxGrid();
+  if (!grid) {
+    return GetTextByPredicate([&rect](const CharInfo& charinfo) {
+      return IsRectIntersect(rect, charinfo.char_box());
+    });
+  }
+
+  std::vector<size_t> indices = grid->GetCandidates(rect);
+  std::erase_if(indices, [this, &rect](size_t index) {
+    return !IsRectIntersect(rect, char_list_[index].char_box());
   });
+  return GetTextOfChars(indices);
 }
 
 WideString CPDF_TextPage::GetTextByObject(
@@ -584,7 +631,7 @@ float CPDF_TextPage::GetCharFontSize(size_t index) const {
 
 CFX_FloatRect CPDF_TextPage::GetCharLooseBounds(size_t index) const {
   CHECK_LT(index, char_list_.size());
-  return char_list_[index].loose_char_box();
+  return GetLooseBounds(char_list_[index]);
 }
 
 WideString CPDF_TextPage::GetPageText(int start, int count) const {
@@ -651,6 +698,128 @@ bool CPDF_TextPage::GetRect(int rectIndex, CFX_FloatRect* pRect) const {
   return true;
 }
 
+size_t CPDF_TextPage::EstimateMemoryUsage() const {
+  size_t page_content_size = 0;
+  if (retained_page_) {
+    // The text objects mostly hold a char code and a position per char.
+    page_content_size =
+        char_list_.size() * (sizeof(uint32_t) + sizeof(float)) +
+        shared_char_infos_.size() * sizeof(CPDF_TextObject);
+  }
+  return sizeof(*this) + page_content_size +
+         char_indices_.size() * sizeof(TextPageCharSegment) +
+         shared_char_infos_.size() * sizeof(SharedCharInfo) +
+         char_list_.size() * sizeof(CharInfo) + text_buf_.GetSize() +
+         sel_rects_.size() * sizeof(CFX_FloatRect) +
+         mTextObjects.size() * sizeof(TransformedTextObject) +
+         text_lines_.size() * sizeof(TextLine) +
+         text_blocks_.size() * sizeof(TextBlock) +
+         (char_box_grid_ ? char_box_grid_->EstimateMemoryUsage() : 0);
+}
+
+const CPDF_CharBoxGrid* CPDF_TextPage::GetCharBoxGrid() const {
+  if (char_list_.size() < kMinCharsForGrid) {
+    return nullptr;
+  }
+  if (!char_box_grid_) {
+    std::vector<CFX_FloatRect> boxes;
+    boxes.reserve(char_list_.size());
+    for (const CharInfo& charinfo : char_list_) {
+      boxes.push_back(charinfo.char_box());
+    }
+    char_box_grid_ = std::make_unique<CPDF_CharBoxGrid>(boxes);
+  }
+  return char_box_grid_.get();
+}
+
+const std::vector<CPDF_TextPage::TextLine>& CPDF_TextPage::GetTextLines()
+    const {
+  ComputeLayoutIfNeeded();
+  return text_lines_;
+}
+
+const std::vector<CPDF_TextPage::TextBlock>& CPDF_TextPage::GetTextBlocks()
+    const {
+  ComputeLayoutIfNeeded();
+  return text_blocks_;
+}
+
+void CPDF_TextPage::ComputeLayoutIfNeeded() const {
+  if (computed_layout_) {
+    return;
+  }
+  computed_layout_ = true;
+
+  // Lines are the runs of chars between the generated line breaks.
+  const int char_count = CountChars();
+  int line_start = 0;
+  for (int i = 0; i <= char_count; ++i) {
+    if (i < char_count) {
+      const CharInfo& charinfo = char_list_[i];
+      if (charinfo.char_type() != CharType::kGenerated ||
+          (charinfo.unicode() != L'\r' && charinfo.unicode() != L'\n')) {
+        continue;
+      }
+    }
+    std::optional<TextLine> line;
+    for (int j = line_start; j < i; ++j) {
+      const CharInfo& charinfo = char_list_[j];
+      if (charinfo.char_type() == CharType::kGenerated ||
+          charinfo.char_box().Width() < kSizeEpsilon ||
+          charinfo.char_box().Height() < kSizeEpsilon) {
+        continue;
+      }
+      CFX_FloatRect char_box = charinfo.char_box();
+      char_box.Normalize();
+      if (!line.has_value()) {
+        line = TextLine{line_start, i - line_start, char_box,
+                        charinfo.origin(), charinfo.origin(), 0};
+      } else {
+        line->bounds.Union(char_box);
+        line->baseline_end = charinfo.origin();
+      }
+    }
+    if (line.has_value()) {
+      text_lines_.push_back(line.value());
+    }
+    line_start = i + 1;
+  }
+
+  // Group consecutive lines into blocks. A line starts a new block when the
+  // gap to the previous line exceeds half the thickness of either line, or
+  // when the two lines do not overlap along the text direction.
+  const bool vertical = textline_dir_ == TextOrientation::kVertical;
+  for (size_t i = 0; i < text_lines_.size(); ++i) {
+    TextLine& line = text_lines_[i];
+    bool new_block = text_blocks_.empty();
+    if (!new_block) {
+      const CFX_FloatRect& prev = text_lines_[i - 1].bounds;
+      const CFX_FloatRect& cur = line.bounds;
+      float gap;
+      float thickness;
+      bool overlaps;
+      if (vertical) {
+        gap = std::max(cur.left - prev.right, prev.left - cur.right);
+        thickness = std::max(prev.Width(), cur.Width());
+        overlaps = cur.bottom <= prev.top && prev.bottom <= cur.top;
+      } else {
+        gap = std::max(cur.bottom - prev.top, prev.bottom - cur.top);
+        thickness = std::max(prev.Height(), cur.Height());
+        overlaps = cur.left <= prev.right && prev.left <= cur.right;
+      }
+      new_block = gap > thickness / 2 || !overlaps;
+    }
+    if (new_block) {
+      text_blocks_.push_back(
+          TextBlock{pdfium::checked_cast<int>(i), 0, line.bounds});
+    } else {
+      text_blocks_.back().bounds.Union(line.bounds);
+    }
+    ++text_blocks_.back().line_count;
+    line.block_index = pdfium::checked_cast<int>(text_blocks_.size() - 1);
+  }
+}
+
 CPDF_TextPage::TextOrientation CPDF_TextPage::FindTextlineFlowOrientation()
     const {
   const int32_t nPageWidth = static_cast<int32_t>(page_->GetPageWidth());
@@ -790,18 +959,18 @@ void CPDF_TextPage::AddCharInfoByLRDirection(wchar_t wChar,
     return;
   }
 
-  DataVector<wchar_t> normalized;
-  if (wChar >= 0xFB00 && wChar <= 0xFB06) {
-    normalized = GetUnicodeNormalization(wChar);
-  }
-  if (normalized.empty()) {
+  // Only the Latin ligatures get split up.
+  if (wChar < 0xFB00 || wChar > 0xFB06) {
     text_buf_.AppendChar(wChar);
     char_list_.push_back(info);
     return;
   }
+  std::array<wchar_t, kMaxUnicodeNormalizationLength> normalized;
+  const size_t normalized_length = GetUnicodeNormalization(wChar, normalized);
   CharInfo modified_info = info;
   modified_info.set_char_type(CharType::kPiece);
-  for (wchar_t normalized_char : normalized) {
+  for (wchar_t normalized_char :
+       pdfium::span(normalized).first(normalized_length)) {
     modified_info.set_unicode(normalized_char);
     text_buf_.AppendChar(normalized_char);
     char_list_.push_back(modified_info);
@@ -817,15 +986,11 @@ void CPDF_TextPage::AddCharInfoByRLDirection(wchar_t wChar,
 
   CharInfo modified_info = info;
   wChar = pdfium::unicode::GetMirrorChar(wChar);
-  DataVector<wchar_t> normalized = GetUnicodeNormalization(wChar);
-  if (normalized.empty()) {
-    modified_info.set_unicode(wChar);
-    text_buf_.AppendChar(wChar);
-    char_list_.push_back(modified_info);
-    return;
-  }
+  std::array<wchar_t, kMaxUnicodeNormalizationLength> normalized;
+  const size_t normalized_length = GetUnicodeNormalization(wChar, normalized);
   modified_info.set_char_type(CharType::kPiece);
-  for (wchar_t normalized_char : normalized) {
+  for (wchar_t normalized_char :
+       pdfium::span(normalized).first(normalized_length)) {
     modified_info.set_unicode(normalized_char);
     text_buf_.AppendChar(normalized_char);
     char_list_.push_back(modified_info);
@@ -1046,7 +1211,8 @@ void CPDF_TextPage::ProcessMarkedContent(const TransformedTextObject& obj) {
     temp_text_buf_.AppendChar(wChar);
     temp_char_list_.push_back(
         CharInfo(CharType::kPiece, CPDF_Font::kInvalidCharCode, wChar,
-                 pTextObj->GetPos(), char_box, matrix, pTextObj));
+                 pTextObj->GetPos(), char_box,
+                 GetSharedCharInfo(matrix, pTextObj)));
   }
 }
 
@@ -1403,8 +1569,8 @@ void CPDF_TextPage::ProcessTextObjectItems(CPDF_TextObject* text_object,
         CFX_PointF origin = matrix.Transform(item.origin_);
         temp_char_list_.push_back(CharInfo(
             CharType::kGenerated, CPDF_Font::kInvalidCharCode, L' ', origin,
-            CFX_FloatRect(origin.x, origin.y, origin.x, origin.y), form_matrix,
-            text_object));
+            CFX_FloatRect(origin.x, origin.y, origin.x, origin.y),
+            GetSharedCharInfo(form_matrix, text_object)));
       }
       if (item.char_code_ == CPDF_Font::kInvalidCharCode) {
         continue;
@@ -1435,8 +1601,8 @@ void CPDF_TextPage::ProcessTextObjectItems(CPDF_TextObject* text_object,
     char_box = matrix.TransformRect(char_box);
 
     CharInfo charinfo(char_type, item.char_code_, 0,
-                      matrix.Transform(item.origin_), char_box, matrix,
-                      text_object);
+                      matrix.Transform(item.origin_), char_box,
+                      GetSharedCharInfo(matrix, text_object));
     if (unicode.IsEmpty()) {
       temp_char_list_.push_back(charinfo);
       temp_text_buf_.AppendChar(0xfffe);
@@ -1582,5 +1748,26 @@ std::optional<CPDF_TextPage::CharInfo> CPDF_TextPage::GenerateCharInfo(
                     pPrevCharInfo->origin().y);
   return CharInfo(CharType::kGenerated, CPDF_Font::kInvalidCharCode, unicode,
                   origin, CFX_FloatRect(origin.x, origin.y, origin.x, origin.y),
-                  form_matrix, /*text_object=*/nullptr);
+                  GetSharedCharInfo(form_matrix, /*text_object=*/nullptr));
+}
+
+const CPDF_TextPage::SharedCharInfo* CPDF_TextPage::GetSharedCharInfo(
+    const CFX_Matrix& matrix,
+    CPDF_TextObject* text_object) {
+  // Consecutive chars nearly always share one of the last few entries, such as
+  // the chars of a text object and the spaces generated between them.
+  static constexpr size_t kEntriesToSearch = 4;
+  const size_t search_count =
+      std::min(shared_char_infos_.size(), kEntriesToSearch);
+  for (size_t i = 1; i <= search_count; ++i) {
+    const SharedCharInfo& shared =
+        shared_char_infos_[shared_char_infos_.size() - i];
+    if (shared.text_object == text_object && shared.matrix == matrix) {
+      return &shared;
+    }
+  }
+  SharedCharInfo& shared = shared_char_infos_.emplace_back();
+  shared.matrix = matrix;
+  shared.text_object = text_object;
+  return &shared;
 }
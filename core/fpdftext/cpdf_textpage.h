@@ -11,6 +11,7 @@
 
 #include <deque>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -18,10 +19,12 @@
 #include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/fx_coordinates.h"
 #include "core/fxcrt/fx_memory_wrappers.h"
+#include "core/fxcrt/retain_ptr.h"
 #include "core/fxcrt/unowned_ptr.h"
 #include "core/fxcrt/widestring.h"
 #include "core/fxcrt/widetext_buffer.h"
 
+class CPDF_CharBoxGrid;
 class CPDF_FormObject;
 class CPDF_Page;
 class CPDF_TextObject;
@@ -43,16 +46,21 @@ class CPDF_TextPage {
     kPiece,
   };
 
+  // State that runs of chars share, usually the chars of one text object,
+  // so that each CharInfo need not keep its own copy.
+  struct SharedCharInfo {
+    CFX_Matrix matrix;
+    UnownedPtr<CPDF_TextObject> text_object;
+  };
+
   class CharInfo {
    public:
-    CharInfo();
     CharInfo(CharType char_type,
              uint32_t char_code,
              wchar_t unicode,
              CFX_PointF origin,
              CFX_FloatRect char_box,
-             CFX_Matrix matrix,
-             CPDF_TextObject* text_object);
+             const SharedCharInfo* shared);
     CharInfo(const CharInfo&);
     ~CharInfo();
 
@@ -67,29 +75,54 @@ class CPDF_TextPage {
     const CFX_PointF& origin() const { return origin_; }
 
     const CFX_FloatRect& char_box() const { return char_box_; }
-    const CFX_FloatRect& loose_char_box() const { return loose_char_box_; }
 
-    const CFX_Matrix& matrix() const { return matrix_; }
+    const CFX_Matrix& matrix() const { return shared_->matrix; }
 
-    const CPDF_TextObject* text_object() const { return text_object_; }
-    CPDF_TextObject* text_object() { return text_object_; }
+    const CPDF_TextObject* text_object() const { return shared_->text_object; }
+    CPDF_TextObject* text_object() { return shared_->text_object; }
 
    private:
-    CharType char_type_ = CharType::kNormal;
-    wchar_t unicode_ = 0;  // Above `char_code_` to potentially pack tighter.
-    uint32_t char_code_ = 0;
+    // Ordered to pack tightly, as dense pages have many thousands of chars.
+    UnownedPtr<const SharedCharInfo> shared_;
     CFX_PointF origin_;
     CFX_FloatRect char_box_;
-    CFX_FloatRect loose_char_box_;
-    CFX_Matrix matrix_;
-    UnownedPtr<CPDF_TextObject> text_object_;
+    wchar_t unicode_ = 0;
+    uint32_t char_code_ = 0;
+    CharType char_type_ = CharType::kNormal;
+  };
+
+  // A line of text, as the line breaks in the page text separate them.
+  struct TextLine {
+    // The chars of the line, not counting the line break.
+    int char_index;
+    int char_count;
+    // Union of the boxes of the chars.
+    CFX_FloatRect bounds;
+    // Origins of the first and last chars, which the baseline runs through.
+    CFX_PointF baseline_start;
+    CFX_PointF baseline_end;
+    // The block in GetTextBlocks() that the line belongs to.
+    int block_index;
+  };
+
+  // Consecutive lines that are close together and overlap along the lines,
+  // such as the lines of a paragraph.
+  struct TextBlock {
+    int line_index;
+    int line_count;
+    CFX_FloatRect bounds;
   };
 
   CPDF_TextPage(const CPDF_Page* pPage, bool rtl);
+  // Same as above, and keeps `pPage` alive for as long as the text page.
+  CPDF_TextPage(RetainPtr<const CPDF_Page> pPage, bool rtl);
   ~CPDF_TextPage();
 
   int CharIndexFromTextIndex(int text_index) const;
   int TextIndexFromCharIndex(int char_index) const;
+  // Returns the char index of each char in GetAllPageText(), in one pass
+  // rather than one CharIndexFromTextIndex() call per char.
+  DataVector<int> GetCharIndicesOfText() const;
   size_t size() const { return char_list_.size(); }
   int CountChars() const;
 
@@ -97,6 +130,7 @@ class CPDF_TextPage {
   const CharInfo& GetCharInfo(size_t index) const;
   CharInfo& GetCharInfo(size_t index);
   float GetCharFontSize(size_t index) const;
+  // Computed on demand, as few callers need it.
   CFX_FloatRect GetCharLooseBounds(size_t index) const;
 
   std::vector<CFX_FloatRect> GetRectArray(int start, int count) const;
@@ -113,6 +147,16 @@ class CPDF_TextPage {
   int CountRects(int start, int nCount);
   bool GetRect(int rectIndex, CFX_FloatRect* pRect) const;
 
+  // Estimates the memory this text page holds on to, in bytes, including the
+  // page content it keeps alive, if any.
+  size_t EstimateMemoryUsage() const;
+
+  // Return the lines and blocks of the page, in reading order, which is the
+  // order of the page text. Lines without any chars with a box are left out.
+  // Computed on first use.
+  const std::vector<TextLine>& GetTextLines() const;
+  const std::vector<TextBlock>& GetTextBlocks() const;
+
  private:
   enum class TextOrientation {
     kUnknown,
@@ -158,6 +202,8 @@ class CPDF_TextPage {
                               const CFX_Matrix& form_matrix,
                               const CFX_Matrix& matrix);
   const CharInfo* GetPrevCharInfo() const;
+  const SharedCharInfo* GetSharedCharInfo(const CFX_Matrix& matrix,
+                                          CPDF_TextObject* text_object);
   std::optional<CharInfo> GenerateCharInfo(wchar_t unicode,
                                            const CFX_Matrix& form_matrix);
   bool IsSameAsPreTextObject(CPDF_TextObject* pTextObj,
@@ -180,9 +226,21 @@ class CPDF_TextPage {
   void SwapTempTextBuf(size_t iCharListStartAppend, size_t iBufStartAppend);
   WideString GetTextByPredicate(
       const std::function<bool(const CharInfo&)>& predicate) const;
-
+  // Returns the text of the chars at `indices`, which must be in ascending
+  // order, as GetTextByPredicate() would for a predicate matching just them.
+  WideString GetTextOfChars(const std::vector<size_t>& indices) const;
+  // Returns nullptr for pages with few chars, where testing every char is
+  // cheap enough. Built on first use.
+  const CPDF_CharBoxGrid* GetCharBoxGrid() const;
+  void ComputeLayoutIfNeeded() const;
+
+  // Must outlive `page_` and the text objects `char_list_` points to.
+  RetainPtr<const CPDF_Page> const retained_page_;
   UnownedPtr<const CPDF_Page> const page_;
   DataVector<TextPageCharSegment> char_indices_;
+  // Must outlive the CharInfos pointing into it. A deque, so that growing it
+  // does not move existing entries.
+  std::deque<SharedCharInfo> shared_char_infos_;
   std::deque<CharInfo> char_list_;
   std::deque<CharInfo> temp_char_list_;
   WideTextBuffer text_buf_;
@@ -195,6 +253,10 @@ class CPDF_TextPage {
   std::vector<TransformedTextObject> mTextObjects;
   TextOrientation textline_dir_ = TextOrientation::kUnknown;
   CFX_FloatRect curline_rect_;
+  mutable bool computed_layout_ = false;
+  mutable std::vector<TextLine> text_lines_;
+  mutable std::vector<TextBlock> text_blocks_;
+  mutable std::unique_ptr<CPDF_CharBoxGrid> char_box_grid_;
 };
 
 #endif  // CORE_FPDFTEXT_CPDF_TEXTPAGE_H_
@@ -0,0 +1,44 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/cpdf_textpagecache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "core/fpdftext/cpdf_textpage.h"
+
+CPDF_TextPageCache::Entry::Entry(int page_index,
+                                 std::unique_ptr<CPDF_TextPage> text_page)
+    : page_index(page_index),
+      text_page(std::move(text_page)),
+      size(this->text_page->EstimateMemoryUsage()) {}
+
+CPDF_TextPageCache::Entry::~Entry() = default;
+
+CPDF_TextPageCache::CPDF_TextPageCache(Loader loader, size_t max_bytes)
+    : loader_(std::move(loader)), max_bytes_(max_bytes) {}
+
+CPDF_TextPageCache::~CPDF_TextPageCache() = default;
+
+const CPDF_TextPage* CPDF_TextPageCache::GetPage(int page_index) {
+  auto it = std::ranges::find(entries_, page_index, &Entry::page_index);
+  if (it != entries_.end()) {
+    entries_.splice(entries_.begin(), entries_, it);
+    return entries_.front().text_page.get();
+  }
+
+  std::unique_ptr<CPDF_TextPage> text_page = loader_(page_index);
+  if (!text_page) {
+    return nullptr;
+  }
+
+  entries_.emplace_front(page_index, std::move(text_page));
+  cached_bytes_ += entries_.front().size;
+  while (cached_bytes_ > max_bytes_ && entries_.size() > 1) {
+    cached_bytes_ -= entries_.back().size;
+    entries_.pop_back();
+  }
+  return entries_.front().text_page.get();
+}
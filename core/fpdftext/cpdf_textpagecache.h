@@ -0,0 +1,52 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FPDFTEXT_CPDF_TEXTPAGECACHE_H_
+#define CORE_FPDFTEXT_CPDF_TEXTPAGECACHE_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <list>
+#include <memory>
+
+class CPDF_TextPage;
+
+// Least recently used (LRU) cache of the text pages of a document, kept
+// within a budget of bytes as estimated by
+// CPDF_TextPage::EstimateMemoryUsage(). The page returned last is kept even
+// if it alone exceeds the budget.
+class CPDF_TextPageCache {
+ public:
+  // Returns the text page for `page_index`, or nullptr if it fails to load.
+  using Loader = std::function<std::unique_ptr<CPDF_TextPage>(int page_index)>;
+
+  CPDF_TextPageCache(Loader loader, size_t max_bytes);
+  ~CPDF_TextPageCache();
+
+  // Returns the text page for `page_index`, loading it unless it is cached,
+  // or nullptr if it fails to load. The page stays valid until the next call.
+  const CPDF_TextPage* GetPage(int page_index);
+
+  size_t cached_bytes() const { return cached_bytes_; }
+  size_t cached_page_count() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    Entry(int page_index, std::unique_ptr<CPDF_TextPage> text_page);
+    ~Entry();
+
+    const int page_index;
+    const std::unique_ptr<CPDF_TextPage> text_page;
+    const size_t size;
+  };
+
+  const Loader loader_;
+  const size_t max_bytes_;
+  size_t cached_bytes_ = 0;
+  // Most recently used entries at the front.
+  std::list<Entry> entries_;
+};
+
+#endif  // CORE_FPDFTEXT_CPDF_TEXTPAGECACHE_H_
@@ -0,0 +1,67 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/unicodenormalization.h"
+
+#include <stdint.h>
+
+#include <array>
+
+#include "core/fpdftext/unicodenormalizationdata.h"
+#include "core/fxcrt/check_op.h"
+
+namespace {
+
+constexpr size_t kBlockSize = 64;
+
+constexpr std::array<pdfium::span<const uint16_t>, 3>
+    kUnicodeDataNormalizationMaps = {{kUnicodeDataNormalizationMap2,
+                                      kUnicodeDataNormalizationMap3,
+                                      kUnicodeDataNormalizationMap4}};
+
+uint16_t GetNormalizationEntry(wchar_t wch) {
+  const size_t code_point = static_cast<size_t>(wch);
+  if (code_point < 0x100) {
+    // Latin-1 blocks come first, so they need no index lookup.
+    return kUnicodeDataNormalizationBlocks[code_point];
+  }
+  if (code_point > 0xFFFF) {
+    return 0;
+  }
+  const size_t block = kUnicodeDataNormalizationIndex[code_point / kBlockSize];
+  return kUnicodeDataNormalizationBlocks[block * kBlockSize +
+                                         code_point % kBlockSize];
+}
+
+}  // namespace
+
+size_t GetUnicodeNormalization(
+    wchar_t wch,
+    pdfium::span<wchar_t, kMaxUnicodeNormalizationLength> buffer) {
+  // ASCII chars have no normalization.
+  const uint16_t entry = wch < 0x80 ? 0 : GetNormalizationEntry(wch);
+  if (!entry) {
+    buffer[0] = wch;
+    return 1;
+  }
+  if (entry >= 0x8000) {
+    buffer[0] = kUnicodeDataNormalizationMap1[entry - 0x8000];
+    return 1;
+  }
+
+  // The top 4 bits have the length, 2 or 3, or are 4 if the length comes
+  // first in the map.
+  size_t length = entry >> 12;
+  auto map = kUnicodeDataNormalizationMaps[length - 2].subspan(
+      static_cast<size_t>(entry & 0x0FFF));
+  if (length == 4) {
+    length = map.front();
+    map = map.subspan<1u>();
+  }
+  CHECK_LE(length, buffer.size());
+  for (size_t i = 0; i < length; ++i) {
+    buffer[i] = map[i];
+  }
+  return length;
+}
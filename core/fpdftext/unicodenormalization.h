@@ -0,0 +1,21 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FPDFTEXT_UNICODENORMALIZATION_H_
+#define CORE_FPDFTEXT_UNICODENORMALIZATION_H_
+
+#include <stddef.h>
+
+#include "core/fxcrt/span.h"
+
+// The most chars that any char normalizes to.
+inline constexpr size_t kMaxUnicodeNormalizationLength = 18;
+
+// Writes the chars that `wch` normalizes to into `buffer`, and returns how
+// many there are. Chars without a normalization normalize to themselves.
+size_t GetUnicodeNormalization(
+    wchar_t wch,
+    pdfium::span<wchar_t, kMaxUnicodeNormalizationLength> buffer);
+
+#endif  // CORE_FPDFTEXT_UNICODENORMALIZATION_H_
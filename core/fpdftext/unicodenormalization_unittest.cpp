@@ -0,0 +1,51 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fpdftext/unicodenormalization.h"
+
+#include <array>
+#include <string>
+
+#include "build/build_config.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+std::wstring Normalize(wchar_t wch) {
+  std::array<wchar_t, kMaxUnicodeNormalizationLength> buffer;
+  const size_t length = GetUnicodeNormalization(wch, buffer);
+  return std::wstring(buffer.data(), length);
+}
+
+}  // namespace
+
+TEST(UnicodeNormalizationTest, Unchanged) {
+  EXPECT_EQ(L"A", Normalize(L'A'));
+  EXPECT_EQ(L" ", Normalize(L' '));
+  EXPECT_EQ(L"\x0627", Normalize(L'\x0627'));
+  EXPECT_EQ(L"\x4e00", Normalize(L'\x4e00'));
+#if defined(WCHAR_T_IS_32_BIT)
+  EXPECT_EQ(L"\U0001F600", Normalize(L'\U0001F600'));
+#endif
+}
+
+TEST(UnicodeNormalizationTest, SingleChar) {
+  EXPECT_EQ(L"a", Normalize(L'\x00aa'));
+  EXPECT_EQ(L"A", Normalize(L'\x00c5'));
+  EXPECT_EQ(L"A", Normalize(L'\xff21'));
+  EXPECT_EQ(L"\x0627", Normalize(L'\xfe8d'));
+}
+
+TEST(UnicodeNormalizationTest, MultipleChars) {
+  EXPECT_EQ(L"1/2", Normalize(L'\x00bd'));
+  EXPECT_EQ(L"fi", Normalize(L'\xfb01'));
+  EXPECT_EQ(L"ffi", Normalize(L'\xfb03'));
+  EXPECT_EQ(L"\x30a2\x30d1\x30fc\x30c8", Normalize(L'\x3300'));
+
+  // The longest normalization.
+  const std::wstring longest = Normalize(L'\xfdfa');
+  EXPECT_EQ(kMaxUnicodeNormalizationLength, longest.size());
+  EXPECT_EQ(L"\x0635\x0644\x0649 \x0627\x0644\x0644\x0647 ",
+            longest.substr(0, 9));
+}
@@ -11,7 +11,13 @@
 
 #include <array>
 
-extern const std::array<uint16_t, 65536> kUnicodeDataNormalization;
+// Two-stage lookup table of the normalization entry of each char up to
+// U+FFFF. kUnicodeDataNormalizationIndex has the block of 64 entries in
+// kUnicodeDataNormalizationBlocks for each 64 chars, so that the many runs of
+// chars without a normalization, such as the CJK ideographs, share a block.
+// The blocks for U+0000 to U+00FF come first and in order.
+extern const std::array<uint16_t, 1024> kUnicodeDataNormalizationIndex;
+extern const std::array<uint16_t, 27712> kUnicodeDataNormalizationBlocks;
 extern const std::array<uint16_t, 5376> kUnicodeDataNormalizationMap1;
 extern const std::array<uint16_t, 1724> kUnicodeDataNormalizationMap2;
 extern const std::array<uint16_t, 1164> kUnicodeDataNormalizationMap3;
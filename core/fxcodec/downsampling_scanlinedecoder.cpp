@@ -0,0 +1,117 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/downsampling_scanlinedecoder.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "core/fxcrt/check_op.h"
+#include "core/fxge/calculate_pitch.h"
+
+namespace fxcodec {
+
+namespace {
+
+int ScaleDown(int size, int scale) {
+  return (size + scale - 1) / scale;
+}
+
+}  // namespace
+
+// static
+bool DownsamplingScanlineDecoder::CanDownsample(const ScanlineDecoder& source) {
+  return source.GetBPC() == 8 && source.CountComps() > 0 &&
+         source.GetWidth() > 0 && source.GetHeight() > 0;
+}
+
+DownsamplingScanlineDecoder::DownsamplingScanlineDecoder(
+    std::unique_ptr<ScanlineDecoder> source,
+    uint8_t levels)
+    : ScanlineDecoder(source->GetWidth(),
+                      source->GetHeight(),
+                      ScaleDown(source->GetWidth(), 1 << levels),
+                      ScaleDown(source->GetHeight(), 1 << levels),
+                      source->CountComps(),
+                      /*nBpc=*/8,
+                      fxge::CalculatePitch8OrDie(
+                          8,
+                          source->CountComps(),
+                          ScaleDown(source->GetWidth(), 1 << levels))),
+      source_(std::move(source)),
+      scale_(1 << levels),
+      sums_(pitch_),
+      scanline_(pitch_) {
+  CHECK(CanDownsample(*source_));
+  // Keeps the sums of `scale_` x `scale_` blocks within 32 bits.
+  CHECK_LE(levels, kMaxLevels);
+}
+
+DownsamplingScanlineDecoder::~DownsamplingScanlineDecoder() {
+  // Span in superclass can't outlive our buffer.
+  last_scanline_ = pdfium::span<uint8_t>();
+}
+
+bool DownsamplingScanlineDecoder::Rewind() {
+  // `source_` rewinds itself once asked for an earlier line.
+  return true;
+}
+
+pdfium::span<uint8_t> DownsamplingScanlineDecoder::GetNextLine() {
+  const int src_top = next_line_ * scale_;
+  const int src_bottom = std::min(src_top + scale_, orig_height_);
+  if (src_top >= src_bottom) {
+    std::ranges::fill(scanline_, 0);
+    return scanline_;
+  }
+
+  std::ranges::fill(sums_, 0);
+  for (int y = src_top; y < src_bottom; ++y) {
+    // Like CPDF_DIB, treat rows the source fails to decode as blank.
+    pdfium::span<const uint8_t> src = source_->GetScanline(y);
+    if (!src.empty()) {
+      AccumulateRow(src);
+    }
+  }
+
+  const size_t comps = comps_;
+  const uint32_t rows = src_bottom - src_top;
+  for (int x = 0; x < output_width_; ++x) {
+    const uint32_t count =
+        rows * std::min(scale_, orig_width_ - x * scale_);
+    const size_t offset = x * comps;
+    for (size_t c = 0; c < comps; ++c) {
+      scanline_[offset + c] =
+          static_cast<uint8_t>((sums_[offset + c] + count / 2) / count);
+    }
+  }
+  return scanline_;
+}
+
+void DownsamplingScanlineDecoder::SkipNextLines(int count) {
+  // Nothing to do, as GetNextLine() asks `source_` for the rows it needs, and
+  // `source_` skips the ones in between.
+}
+
+uint32_t DownsamplingScanlineDecoder::GetSrcOffset() {
+  return source_->GetSrcOffset();
+}
+
+void DownsamplingScanlineDecoder::AccumulateRow(
+    pdfium::span<const uint8_t> src) {
+  const size_t comps = comps_;
+  src = src.first(static_cast<size_t>(orig_width_) * comps);
+  size_t src_index = 0;
+  for (int x = 0; x < output_width_; ++x) {
+    const int cols = std::min(scale_, orig_width_ - x * scale_);
+    pdfium::span<uint32_t> sums = pdfium::span(sums_).subspan(x * comps, comps);
+    for (int i = 0; i < cols; ++i) {
+      for (size_t c = 0; c < comps; ++c) {
+        sums[c] += src[src_index++];
+      }
+    }
+  }
+}
+
+}  // namespace fxcodec
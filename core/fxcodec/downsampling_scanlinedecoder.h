@@ -0,0 +1,55 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FXCODEC_DOWNSAMPLING_SCANLINEDECODER_H_
+#define CORE_FXCODEC_DOWNSAMPLING_SCANLINEDECODER_H_
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "core/fxcodec/scanlinedecoder.h"
+#include "core/fxcrt/data_vector.h"
+#include "core/fxcrt/span.h"
+
+namespace fxcodec {
+
+// Shrinks the rows of another decoder with 8 bits per component by a power of
+// two as they are decoded, averaging each square block of pixels into one.
+// Only a single row of the shrunk image is held at a time, so callers can
+// convert and stretch a huge image without it ever existing at full size.
+class DownsamplingScanlineDecoder final : public ScanlineDecoder {
+ public:
+  static constexpr uint8_t kMaxLevels = 8;
+
+  // Returns whether `source` can be shrunk.
+  static bool CanDownsample(const ScanlineDecoder& source);
+
+  // The output is `2^levels` times smaller in each direction, rounding up.
+  // `levels` must be at most `kMaxLevels`.
+  DownsamplingScanlineDecoder(std::unique_ptr<ScanlineDecoder> source,
+                              uint8_t levels);
+  ~DownsamplingScanlineDecoder() override;
+
+  // ScanlineDecoder:
+  [[nodiscard]] bool Rewind() override;
+  pdfium::span<uint8_t> GetNextLine() override;
+  void SkipNextLines(int count) override;
+  uint32_t GetSrcOffset() override;
+
+ private:
+  // Adds `src` to `sums_`, summing each run of `scale_` pixels.
+  void AccumulateRow(pdfium::span<const uint8_t> src);
+
+  const std::unique_ptr<ScanlineDecoder> source_;
+  const int scale_;
+  DataVector<uint32_t> sums_;
+  DataVector<uint8_t> scanline_;
+};
+
+}  // namespace fxcodec
+
+using DownsamplingScanlineDecoder = fxcodec::DownsamplingScanlineDecoder;
+
+#endif  // CORE_FXCODEC_DOWNSAMPLING_SCANLINEDECODER_H_
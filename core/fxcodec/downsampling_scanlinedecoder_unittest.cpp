@@ -0,0 +1,159 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/downsampling_scanlinedecoder.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "core/fxcrt/data_vector.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using testing::ElementsAre;
+using testing::ElementsAreArray;
+
+namespace {
+
+// Returns the value of component `c` of the pixel at (`x`, `y`).
+uint8_t PixelValue(int x, int y, int c) {
+  return static_cast<uint8_t>(x * 7 + y * 13 + c * 50);
+}
+
+// Decodes rows of `PixelValue()`, and records which rows were asked for.
+class FakeDecoder final : public ScanlineDecoder {
+ public:
+  FakeDecoder(int width, int height, int comps)
+      : ScanlineDecoder(width, height, width, height, comps, 8, width * comps),
+        scanline_(pitch_) {}
+  ~FakeDecoder() override {
+    // Span in superclass can't outlive our buffer.
+    last_scanline_ = pdfium::span<uint8_t>();
+  }
+
+  // ScanlineDecoder:
+  bool Rewind() override {
+    ++rewinds;
+    return true;
+  }
+  pdfium::span<uint8_t> GetNextLine() override {
+    decoded_rows.push_back(next_line_);
+    for (int x = 0; x < orig_width_; ++x) {
+      for (int c = 0; c < comps_; ++c) {
+        scanline_[x * comps_ + c] = PixelValue(x, next_line_, c);
+      }
+    }
+    return scanline_;
+  }
+  void SkipNextLines(int count) override {
+    for (int i = 0; i < count; ++i) {
+      skipped_rows.push_back(next_line_ + i);
+    }
+  }
+  uint32_t GetSrcOffset() override { return 123; }
+
+  int rewinds = 0;
+  std::vector<int> decoded_rows;
+  std::vector<int> skipped_rows;
+
+ private:
+  DataVector<uint8_t> scanline_;
+};
+
+// Returns the rounded average of `PixelValue()` over the block of pixels
+// within the `width` x `height` image that maps to (`x`, `y`) at `scale`.
+uint8_t BlockAverage(int x,
+                     int y,
+                     int c,
+                     int scale,
+                     int width,
+                     int height) {
+  uint32_t sum = 0;
+  uint32_t count = 0;
+  for (int src_y = y * scale; src_y < height && src_y < (y + 1) * scale;
+       ++src_y) {
+    for (int src_x = x * scale; src_x < width && src_x < (x + 1) * scale;
+         ++src_x) {
+      sum += PixelValue(src_x, src_y, c);
+      ++count;
+    }
+  }
+  return static_cast<uint8_t>((sum + count / 2) / count);
+}
+
+}  // namespace
+
+TEST(DownsamplingScanlineDecoder, Average) {
+  for (int comps : {1, 3, 4}) {
+    for (uint8_t levels : {1, 2, 3}) {
+      for (int width : {1, 8, 21}) {
+        for (int height : {1, 8, 19}) {
+          SCOPED_TRACE(testing::Message() << comps << " " << int{levels} << " "
+                                          << width << " " << height);
+          auto source = std::make_unique<FakeDecoder>(width, height, comps);
+          ASSERT_TRUE(DownsamplingScanlineDecoder::CanDownsample(*source));
+          DownsamplingScanlineDecoder decoder(std::move(source), levels);
+          const int scale = 1 << levels;
+          const int out_width = (width + scale - 1) / scale;
+          const int out_height = (height + scale - 1) / scale;
+          EXPECT_EQ(out_width, decoder.GetWidth());
+          EXPECT_EQ(out_height, decoder.GetHeight());
+          EXPECT_EQ(comps, decoder.CountComps());
+          EXPECT_EQ(8, decoder.GetBPC());
+          EXPECT_EQ(123u, decoder.GetSrcOffset());
+          for (int y = 0; y < out_height; ++y) {
+            std::vector<uint8_t> expected;
+            for (int x = 0; x < out_width; ++x) {
+              for (int c = 0; c < comps; ++c) {
+                expected.push_back(
+                    BlockAverage(x, y, c, scale, width, height));
+              }
+            }
+            EXPECT_THAT(decoder.GetScanline(y), ElementsAreArray(expected))
+                << y;
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(DownsamplingScanlineDecoder, SkipAndRewind) {
+  auto source = std::make_unique<FakeDecoder>(4, 16, 1);
+  FakeDecoder* source_ptr = source.get();
+  DownsamplingScanlineDecoder decoder(std::move(source), 2);
+  ASSERT_EQ(4, decoder.GetHeight());
+
+  // Skipping output rows lets the source skip the rows behind them.
+  EXPECT_THAT(decoder.GetScanline(2),
+              ElementsAre(BlockAverage(0, 2, 0, 4, 4, 16)));
+  EXPECT_THAT(source_ptr->skipped_rows, ElementsAre(0, 1, 2, 3, 4, 5, 6, 7));
+  EXPECT_THAT(source_ptr->decoded_rows, ElementsAre(8, 9, 10, 11));
+
+  // Going back starts over from the first row of the source.
+  source_ptr->decoded_rows.clear();
+  const int rewinds = source_ptr->rewinds;
+  EXPECT_THAT(decoder.GetScanline(0),
+              ElementsAre(BlockAverage(0, 0, 0, 4, 4, 16)));
+  EXPECT_EQ(rewinds + 1, source_ptr->rewinds);
+  EXPECT_THAT(source_ptr->decoded_rows, ElementsAre(0, 1, 2, 3));
+}
+
+TEST(DownsamplingScanlineDecoder, CanDownsample) {
+  EXPECT_TRUE(
+      DownsamplingScanlineDecoder::CanDownsample(FakeDecoder(10, 10, 3)));
+
+  class OneBitDecoder final : public ScanlineDecoder {
+   public:
+    OneBitDecoder() : ScanlineDecoder(10, 10, 10, 10, 1, 1, 2) {}
+
+    // ScanlineDecoder:
+    bool Rewind() override { return true; }
+    pdfium::span<uint8_t> GetNextLine() override { return {}; }
+    uint32_t GetSrcOffset() override { return 0; }
+  };
+  EXPECT_FALSE(DownsamplingScanlineDecoder::CanDownsample(OneBitDecoder()));
+}
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -17,6 +18,7 @@
 #include "build/build_config.h"
 #include "core/fxcodec/scanlinedecoder.h"
 #include "core/fxcrt/binary_buffer.h"
+#include "core/fxcrt/byteorder.h"
 #include "core/fxcrt/check.h"
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/compiler_specific.h"
@@ -81,20 +83,20 @@ int FindBit(pdfium::span<const uint8_t> data_buf,
   const int max_byte = (max_pos + 7) / 8;
   int byte_pos = start_pos / 8;
 
-  // Try reading in bigger chunks in case there are long runs to be skipped.
-  static constexpr int kBulkReadSize = 8;
-  if (max_byte >= kBulkReadSize && byte_pos < max_byte - kBulkReadSize) {
-    static constexpr uint8_t skip_block_0[kBulkReadSize] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    static constexpr uint8_t skip_block_1[kBulkReadSize] = {
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
-    const uint8_t* skip_block = bit ? skip_block_0 : skip_block_1;
-    while (byte_pos < max_byte - kBulkReadSize &&
-           UNSAFE_TODO(
-               memcmp(data_buf.subspan(static_cast<size_t>(byte_pos)).data(),
-                      skip_block, kBulkReadSize)) == 0) {
-      byte_pos += kBulkReadSize;
+  // Read 64 bits at a time, since runs tend to be long.
+  const uint32_t word_xor = bit ? 0 : 0xffffffff;
+  while (byte_pos + 8 <= max_byte) {
+    pdfium::span<const uint8_t> words =
+        data_buf.subspan(static_cast<size_t>(byte_pos), 8u);
+    const uint64_t data =
+        static_cast<uint64_t>(fxcrt::GetUInt32MSBFirst(words.first<4u>()) ^
+                              word_xor)
+            << 32 |
+        (fxcrt::GetUInt32MSBFirst(words.last<4u>()) ^ word_xor);
+    if (data) {
+      return std::min(byte_pos * 8 + std::countl_zero(data), max_pos);
     }
+    byte_pos += 8;
   }
 
   while (byte_pos < max_byte) {
@@ -136,24 +138,20 @@ void FaxFillBits(uint8_t* dest_buf, int columns, int startpos, int endpos) {
   if (startpos >= endpos) {
     return;
   }
-  int first_byte = startpos / 8;
-  int last_byte = (endpos - 1) / 8;
-  if (first_byte == last_byte) {
-    for (int i = startpos % 8; i <= (endpos - 1) % 8; ++i) {
-      UNSAFE_TODO(dest_buf[first_byte] -= 1 << (7 - i));
+  // The runs of a row never overlap, so this only ever clears set bits.
+  const int first_byte = startpos / 8;
+  const int last_byte = (endpos - 1) / 8;
+  const uint8_t first_mask = 0xff >> (startpos % 8);
+  const uint8_t last_mask = 0xff << (7 - (endpos - 1) % 8);
+  UNSAFE_TODO({
+    if (first_byte == last_byte) {
+      dest_buf[first_byte] &= ~(first_mask & last_mask);
+      return;
     }
-    return;
-  }
-  for (int i = startpos % 8; i < 8; ++i) {
-    UNSAFE_TODO(dest_buf[first_byte] -= 1 << (7 - i));
-  }
-  for (int i = 0; i <= (endpos - 1) % 8; ++i) {
-    UNSAFE_TODO(dest_buf[last_byte] -= 1 << (7 - i));
-  }
-  if (last_byte > first_byte + 1) {
-    UNSAFE_TODO(
-        FXSYS_memset(dest_buf + first_byte + 1, 0, last_byte - first_byte - 1));
-  }
+    dest_buf[first_byte] &= ~first_mask;
+    FXSYS_memset(dest_buf + first_byte + 1, 0, last_byte - first_byte - 1);
+    dest_buf[last_byte] &= ~last_mask;
+  });
 }
 
 inline bool NextBit(const uint8_t* src_buf, int* bitpos) {
@@ -161,7 +159,7 @@ inline bool NextBit(const uint8_t* src_buf, int* bitpos) {
   return !!UNSAFE_TODO((src_buf[pos / 8] & (1 << (7 - pos % 8))));
 }
 
-const uint8_t kFaxBlackRunIns[] = {
+constexpr uint8_t kFaxBlackRunIns[] = {
     0,          2,          0x02,       3,          0,          0x03,
     2,          0,          2,          0x02,       1,          0,
     0x03,       4,          0,          2,          0x02,       6,
@@ -218,7 +216,7 @@ const uint8_t kFaxBlackRunIns[] = {
     1088 / 256, 0x76,       1152 % 256, 1152 / 256, 0x77,       1216 % 256,
     1216 / 256, 0xff};
 
-const uint8_t kFaxWhiteRunIns[] = {
+constexpr uint8_t kFaxWhiteRunIns[] = {
     0,          0,          0,          6,          0x07,       2,
     0,          0x08,       3,          0,          0x0B,       4,
     0,          0x0C,       5,          0,          0x0E,       6,
@@ -276,38 +274,145 @@ const uint8_t kFaxWhiteRunIns[] = {
     0xff,
 };
 
-int FaxGetRun(pdfium::span<const uint8_t> ins_array,
-              const uint8_t* src_buf,
-              int* bitpos,
-              int bitsize) {
-  uint32_t code = 0;
-  int ins_off = 0;
-  while (true) {
-    uint8_t ins = ins_array[ins_off++];
-    if (ins == 0xff) {
-      return -1;
-    }
+// Returns the number of bits a code in `ins_array` may have.
+template <size_t N>
+constexpr int GetFaxRunCodeBits(const uint8_t (&ins_array)[N]) {
+  int bits = 0;
+  for (size_t i = 0; ins_array[i] != 0xff; i += 1 + ins_array[i] * 3) {
+    ++bits;
+  }
+  return bits;
+}
 
-    if (*bitpos >= bitsize) {
-      return -1;
+// Expands `ins_array`, which lists the codes by their length, into a table
+// indexed by the next `kCodeBits` bits of input. Each entry holds the run
+// length in the low 12 bits and the code length in the high 4 bits, or is 0
+// if no code matches.
+template <int kCodeBits, size_t N>
+constexpr std::array<uint16_t, 1 << kCodeBits> BuildFaxRunTable(
+    const uint8_t (&ins_array)[N]) {
+  std::array<uint16_t, 1 << kCodeBits> table = {};
+  size_t i = 0;
+  for (int bits = 1; ins_array[i] != 0xff; ++bits) {
+    const int count = ins_array[i++];
+    for (int j = 0; j < count; ++j, i += 3) {
+      const int shift = kCodeBits - bits;
+      const int run = ins_array[i + 1] + ins_array[i + 2] * 256;
+      for (int k = ins_array[i] << shift; k < (ins_array[i] + 1) << shift;
+           ++k) {
+        table[k] = static_cast<uint16_t>(bits << 12 | run);
+      }
     }
+  }
+  return table;
+}
 
-    code <<= 1;
-    UNSAFE_TODO({
-      if (src_buf[*bitpos / 8] & (1 << (7 - *bitpos % 8))) {
-        ++code;
-      }
-    });
-    ++(*bitpos);
-    int next_off = ins_off + ins * 3;
-    for (; ins_off < next_off; ins_off += 3) {
-      if (ins_array[ins_off] == code) {
-        return ins_array[ins_off + 1] + ins_array[ins_off + 2] * 256;
+constexpr int kFaxWhiteCodeBits = GetFaxRunCodeBits(kFaxWhiteRunIns);
+constexpr int kFaxBlackCodeBits = GetFaxRunCodeBits(kFaxBlackRunIns);
+constexpr auto kFaxWhiteRunTable =
+    BuildFaxRunTable<kFaxWhiteCodeBits>(kFaxWhiteRunIns);
+constexpr auto kFaxBlackRunTable =
+    BuildFaxRunTable<kFaxBlackCodeBits>(kFaxBlackRunIns);
+
+// Returns the 24 bits starting at `bitpos` in the low bits, with bits past
+// `bitsize` reading as 0.
+uint32_t PeekBits(const uint8_t* src_buf, int bitpos, int bitsize) {
+  const int byte_pos = bitpos / 8;
+  uint32_t bits = 0;
+  if (byte_pos + 4 <= bitsize / 8) {
+    // SAFETY: `bitsize` is within the bounds of `src_buf`.
+    bits = fxcrt::GetUInt32MSBFirst(
+        UNSAFE_TODO(pdfium::span<const uint8_t, 4>(src_buf + byte_pos, 4u)));
+  } else {
+    for (int i = byte_pos; i < byte_pos + 4; ++i) {
+      bits <<= 8;
+      if (i < bitsize / 8) {
+        bits |= UNSAFE_TODO(src_buf[i]);
       }
     }
   }
+  return (bits << (bitpos % 8)) >> 8;
 }
 
+// Reads one run length code, using the lookup table for the color. Returns -1
+// if there is no valid code, leaving `bitpos` where reading the code one bit
+// at a time would have given up.
+template <int kCodeBits>
+int FaxGetRunFromTable(const std::array<uint16_t, 1 << kCodeBits>& table,
+                       const uint8_t* src_buf,
+                       int* bitpos,
+                       int bitsize) {
+  if (*bitpos >= bitsize) {
+    return -1;
+  }
+  const uint16_t entry =
+      table[PeekBits(src_buf, *bitpos, bitsize) >> (24 - kCodeBits)];
+  const int code_bits = entry >> 12;
+  if (code_bits == 0) {
+    *bitpos = std::min(*bitpos + kCodeBits, bitsize);
+    return -1;
+  }
+  if (code_bits > bitsize - *bitpos) {
+    *bitpos = bitsize;
+    return -1;
+  }
+  *bitpos += code_bits;
+  return entry & 0xfff;
+}
+
+int FaxGetRun(bool white, const uint8_t* src_buf, int* bitpos, int bitsize) {
+  return white ? FaxGetRunFromTable<kFaxWhiteCodeBits>(kFaxWhiteRunTable,
+                                                       src_buf, bitpos, bitsize)
+               : FaxGetRunFromTable<kFaxBlackCodeBits>(
+                     kFaxBlackRunTable, src_buf, bitpos, bitsize);
+}
+
+// The 2D coding modes, see ITU-T T.4 section 4.2.1.3.
+enum class FaxMode : uint8_t {
+  kPass,
+  kHorizontal,
+  kVertical,
+  kExtension,
+  kEndOfLine,
+};
+
+struct FaxModeCode {
+  FaxMode mode;
+  uint8_t bits;
+  int8_t delta;  // For kVertical.
+};
+
+constexpr int kFaxModeCodeBits = 7;
+
+constexpr std::array<FaxModeCode, 1 << kFaxModeCodeBits> BuildFaxModeTable() {
+  constexpr struct {
+    uint8_t code;
+    FaxModeCode mode_code;
+  } kCodes[] = {
+      {0x01, {FaxMode::kVertical, 1, 0}},
+      {0x03, {FaxMode::kVertical, 3, 1}},
+      {0x02, {FaxMode::kVertical, 3, -1}},
+      {0x01, {FaxMode::kHorizontal, 3, 0}},
+      {0x01, {FaxMode::kPass, 4, 0}},
+      {0x03, {FaxMode::kVertical, 6, 2}},
+      {0x02, {FaxMode::kVertical, 6, -2}},
+      {0x03, {FaxMode::kVertical, 7, 3}},
+      {0x02, {FaxMode::kVertical, 7, -3}},
+      {0x01, {FaxMode::kExtension, 7, 0}},
+      {0x00, {FaxMode::kEndOfLine, 7, 0}},
+  };
+  std::array<FaxModeCode, 1 << kFaxModeCodeBits> table = {};
+  for (const auto& code : kCodes) {
+    const int shift = kFaxModeCodeBits - code.mode_code.bits;
+    for (int i = code.code << shift; i < (code.code + 1) << shift; ++i) {
+      table[i] = code.mode_code;
+    }
+  }
+  return table;
+}
+
+constexpr auto kFaxModeTable = BuildFaxModeTable();
+
 void FaxG4GetRow(const uint8_t* src_buf,
                  int bitsize,
                  int* bitpos,
@@ -327,29 +432,31 @@ void FaxG4GetRow(const uint8_t* src_buf,
     int b2;
     FaxG4FindB1B2(ref_buf, columns, a0, a0color, &b1, &b2);
 
-    int v_delta = 0;
-    if (!NextBit(src_buf, bitpos)) {
-      if (*bitpos >= bitsize) {
-        return;
-      }
+    const FaxModeCode mode_code =
+        kFaxModeTable[PeekBits(src_buf, *bitpos, bitsize) >>
+                      (24 - kFaxModeCodeBits)];
+    if (mode_code.bits > bitsize - *bitpos) {
+      *bitpos = bitsize;
+      return;
+    }
+    *bitpos += mode_code.bits;
 
-      bool bit1 = NextBit(src_buf, bitpos);
-      if (*bitpos >= bitsize) {
-        return;
-      }
+    switch (mode_code.mode) {
+      case FaxMode::kPass:
+        if (!a0color) {
+          FaxFillBits(dest_buf, columns, a0, b2);
+        }
 
-      bool bit2 = NextBit(src_buf, bitpos);
-      if (bit1) {
-        v_delta = bit2 ? 1 : -1;
-      } else if (bit2) {
+        if (b2 >= columns) {
+          return;
+        }
+
+        a0 = b2;
+        continue;
+      case FaxMode::kHorizontal: {
         int run_len1 = 0;
         while (true) {
-          int run = FaxGetRun(
-              a0color ? pdfium::span<const uint8_t, pdfium::dynamic_extent>(
-                            kFaxWhiteRunIns)
-                      : pdfium::span<const uint8_t, pdfium::dynamic_extent>(
-                            kFaxBlackRunIns),
-              src_buf, bitpos, bitsize);
+          int run = FaxGetRun(a0color, src_buf, bitpos, bitsize);
           run_len1 += run;
           if (run < 64) {
             break;
@@ -369,12 +476,7 @@ void FaxG4GetRow(const uint8_t* src_buf,
 
         int run_len2 = 0;
         while (true) {
-          int run = FaxGetRun(
-              a0color ? pdfium::span<const uint8_t, pdfium::dynamic_extent>(
-                            kFaxBlackRunIns)
-                      : pdfium::span<const uint8_t, pdfium::dynamic_extent>(
-                            kFaxWhiteRunIns),
-              src_buf, bitpos, bitsize);
+          int run = FaxGetRun(!a0color, src_buf, bitpos, bitsize);
           run_len2 += run;
           if (run < 64) {
             break;
@@ -394,57 +496,18 @@ void FaxG4GetRow(const uint8_t* src_buf,
         }
 
         return;
-      } else {
-        if (*bitpos >= bitsize) {
-          return;
-        }
-
-        if (NextBit(src_buf, bitpos)) {
-          if (!a0color) {
-            FaxFillBits(dest_buf, columns, a0, b2);
-          }
-
-          if (b2 >= columns) {
-            return;
-          }
-
-          a0 = b2;
-          continue;
-        }
-
-        if (*bitpos >= bitsize) {
-          return;
-        }
-
-        bool next_bit1 = NextBit(src_buf, bitpos);
-        if (*bitpos >= bitsize) {
-          return;
-        }
-
-        bool next_bit2 = NextBit(src_buf, bitpos);
-        if (next_bit1) {
-          v_delta = next_bit2 ? 2 : -2;
-        } else if (next_bit2) {
-          if (*bitpos >= bitsize) {
-            return;
-          }
-
-          v_delta = NextBit(src_buf, bitpos) ? 3 : -3;
-        } else {
-          if (*bitpos >= bitsize) {
-            return;
-          }
-
-          if (NextBit(src_buf, bitpos)) {
-            *bitpos += 3;
-            continue;
-          }
-          *bitpos += 5;
-          return;
-        }
       }
+      case FaxMode::kVertical:
+        break;
+      case FaxMode::kExtension:
+        *bitpos += 3;
+        continue;
+      case FaxMode::kEndOfLine:
+        *bitpos += 5;
+        return;
     }
-    a1 = b1 + v_delta;
+
+    a1 = b1 + mode_code.delta;
     if (!a0color) {
       FaxFillBits(dest_buf, columns, a0, a1);
     }
@@ -490,12 +553,7 @@ void FaxGet1DLine(const uint8_t* src_buf,
 
     int run_len = 0;
     while (true) {
-      int run =
-          FaxGetRun(color ? pdfium::span<const uint8_t, pdfium::dynamic_extent>(
-                                kFaxWhiteRunIns)
-                          : pdfium::span<const uint8_t, pdfium::dynamic_extent>(
-                                kFaxBlackRunIns),
-                    src_buf, bitpos, bitsize);
+      int run = FaxGetRun(color, src_buf, bitpos, bitsize);
       if (run < 0) {
         while (*bitpos < bitsize) {
           if (NextBit(src_buf, bitpos)) {
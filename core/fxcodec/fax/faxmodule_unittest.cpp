@@ -0,0 +1,1128 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/fax/faxmodule.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/fxcodec/scanlinedecoder.h"
+#include "core/fxcrt/check.h"
+#include "core/fxcrt/compiler_specific.h"
+#include "core/fxcrt/fx_memcpy_wrappers.h"
+#include "core/fxcrt/fx_memory.h"
+#include "core/fxcrt/span.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/utils/benchmark_timer.h"
+
+namespace {
+
+// Codes and lengths of the terminating codes for runs of 0 to 63 pixels, and
+// of the makeup codes for runs of 64 to 2560 pixels, from ITU-T T.4.
+constexpr uint8_t kWhiteTerminating[64][2] = {
+    {0x35, 8}, {0x07, 6}, {0x07, 4}, {0x08, 4}, {0x0b, 4}, {0x0c, 4},
+    {0x0e, 4}, {0x0f, 4}, {0x13, 5}, {0x14, 5}, {0x07, 5}, {0x08, 5},
+    {0x08, 6}, {0x03, 6}, {0x34, 6}, {0x35, 6}, {0x2a, 6}, {0x2b, 6},
+    {0x27, 7}, {0x0c, 7}, {0x08, 7}, {0x17, 7}, {0x03, 7}, {0x04, 7},
+    {0x28, 7}, {0x2b, 7}, {0x13, 7}, {0x24, 7}, {0x18, 7}, {0x02, 8},
+    {0x03, 8}, {0x1a, 8}, {0x1b, 8}, {0x12, 8}, {0x13, 8}, {0x14, 8},
+    {0x15, 8}, {0x16, 8}, {0x17, 8}, {0x28, 8}, {0x29, 8}, {0x2a, 8},
+    {0x2b, 8}, {0x2c, 8}, {0x2d, 8}, {0x04, 8}, {0x05, 8}, {0x0a, 8},
+    {0x0b, 8}, {0x52, 8}, {0x53, 8}, {0x54, 8}, {0x55, 8}, {0x24, 8},
+    {0x25, 8}, {0x58, 8}, {0x59, 8}, {0x5a, 8}, {0x5b, 8}, {0x4a, 8},
+    {0x4b, 8}, {0x32, 8}, {0x33, 8}, {0x34, 8},
+};
+
+constexpr uint8_t kBlackTerminating[64][2] = {
+    {0x37, 10}, {0x02, 3},  {0x03, 2},  {0x02, 2},  {0x03, 3},  {0x03, 4},
+    {0x02, 4},  {0x03, 5},  {0x05, 6},  {0x04, 6},  {0x04, 7},  {0x05, 7},
+    {0x07, 7},  {0x04, 8},  {0x07, 8},  {0x18, 9},  {0x17, 10}, {0x18, 10},
+    {0x08, 10}, {0x67, 11}, {0x68, 11}, {0x6c, 11}, {0x37, 11}, {0x28, 11},
+    {0x17, 11}, {0x18, 11}, {0xca, 12}, {0xcb, 12}, {0xcc, 12}, {0xcd, 12},
+    {0x68, 12}, {0x69, 12}, {0x6a, 12}, {0x6b, 12}, {0xd2, 12}, {0xd3, 12},
+    {0xd4, 12}, {0xd5, 12}, {0xd6, 12}, {0xd7, 12}, {0x6c, 12}, {0x6d, 12},
+    {0xda, 12}, {0xdb, 12}, {0x54, 12}, {0x55, 12}, {0x56, 12}, {0x57, 12},
+    {0x64, 12}, {0x65, 12}, {0x52, 12}, {0x53, 12}, {0x24, 12}, {0x37, 12},
+    {0x38, 12}, {0x27, 12}, {0x28, 12}, {0x58, 12}, {0x59, 12}, {0x2b, 12},
+    {0x2c, 12}, {0x5a, 12}, {0x66, 12}, {0x67, 12},
+};
+
+constexpr uint8_t kWhiteMakeup[40][2] = {
+    {0x1b, 5},  {0x12, 5},  {0x17, 6},  {0x37, 7},  {0x36, 8},  {0x37, 8},
+    {0x64, 8},  {0x65, 8},  {0x68, 8},  {0x67, 8},  {0xcc, 9},  {0xcd, 9},
+    {0xd2, 9},  {0xd3, 9},  {0xd4, 9},  {0xd5, 9},  {0xd6, 9},  {0xd7, 9},
+    {0xd8, 9},  {0xd9, 9},  {0xda, 9},  {0xdb, 9},  {0x98, 9},  {0x99, 9},
+    {0x9a, 9},  {0x18, 6},  {0x9b, 9},  {0x08, 11}, {0x0c, 11}, {0x0d, 11},
+    {0x12, 12}, {0x13, 12}, {0x14, 12}, {0x15, 12}, {0x16, 12}, {0x17, 12},
+    {0x1c, 12}, {0x1d, 12}, {0x1e, 12}, {0x1f, 12},
+};
+
+constexpr uint8_t kBlackMakeup[40][2] = {
+    {0x0f, 10}, {0xc8, 12}, {0xc9, 12}, {0x5b, 12}, {0x33, 12}, {0x34, 12},
+    {0x35, 12}, {0x6c, 13}, {0x6d, 13}, {0x4a, 13}, {0x4b, 13}, {0x4c, 13},
+    {0x4d, 13}, {0x72, 13}, {0x73, 13}, {0x74, 13}, {0x75, 13}, {0x76, 13},
+    {0x77, 13}, {0x52, 13}, {0x53, 13}, {0x54, 13}, {0x55, 13}, {0x5a, 13},
+    {0x5b, 13}, {0x64, 13}, {0x65, 13}, {0x08, 11}, {0x0c, 11}, {0x0d, 11},
+    {0x12, 12}, {0x13, 12}, {0x14, 12}, {0x15, 12}, {0x16, 12}, {0x17, 12},
+    {0x1c, 12}, {0x1d, 12}, {0x1e, 12}, {0x1f, 12},
+};
+
+// The decoder as it was before it used lookup tables, reading codes one bit at
+// a time. The current decoder must produce the same rows and consume the same
+// bits, including on invalid and truncated data.
+namespace reference {
+
+constexpr std::array<const uint8_t, 256> kOneLeadPos = {{
+    8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+}};
+
+int FindBit(pdfium::span<const uint8_t> data_buf,
+            int max_pos,
+            int start_pos,
+            bool bit) {
+  DCHECK(start_pos >= 0);
+  if (start_pos >= max_pos) {
+    return max_pos;
+  }
+
+  const uint8_t bit_xor = bit ? 0x00 : 0xff;
+  int bit_offset = start_pos % 8;
+  if (bit_offset) {
+    const int byte_pos = start_pos / 8;
+    uint8_t data = (data_buf[byte_pos] ^ bit_xor) & (0xff >> bit_offset);
+    if (data) {
+      return byte_pos * 8 + kOneLeadPos[data];
+    }
+    start_pos += 7;
+  }
+
+  const int max_byte = (max_pos + 7) / 8;
+  int byte_pos = start_pos / 8;
+
+  // Try reading in bigger chunks in case there are long runs to be skipped.
+  static constexpr int kBulkReadSize = 8;
+  if (max_byte >= kBulkReadSize && byte_pos < max_byte - kBulkReadSize) {
+    static constexpr uint8_t skip_block_0[kBulkReadSize] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    static constexpr uint8_t skip_block_1[kBulkReadSize] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    const uint8_t* skip_block = bit ? skip_block_0 : skip_block_1;
+    while (byte_pos < max_byte - kBulkReadSize &&
+           UNSAFE_TODO(
+               memcmp(data_buf.subspan(static_cast<size_t>(byte_pos)).data(),
+                      skip_block, kBulkReadSize)) == 0) {
+      byte_pos += kBulkReadSize;
+    }
+  }
+
+  while (byte_pos < max_byte) {
+    uint8_t data = data_buf[byte_pos] ^ bit_xor;
+    if (data) {
+      return std::min(byte_pos * 8 + kOneLeadPos[data], max_pos);
+    }
+    ++byte_pos;
+  }
+  return max_pos;
+}
+
+void FaxG4FindB1B2(pdfium::span<const uint8_t> ref_buf,
+                   int columns,
+                   int a0,
+                   bool a0color,
+                   int* b1,
+                   int* b2) {
+  bool first_bit = a0 < 0 || (ref_buf[a0 / 8] & (1 << (7 - a0 % 8))) != 0;
+  *b1 = FindBit(ref_buf, columns, a0 + 1, !first_bit);
+  if (*b1 >= columns) {
+    *b1 = *b2 = columns;
+    return;
+  }
+  if (first_bit == !a0color) {
+    *b1 = FindBit(ref_buf, columns, *b1 + 1, first_bit);
+    first_bit = !first_bit;
+  }
+  if (*b1 >= columns) {
+    *b1 = *b2 = columns;
+    return;
+  }
+  *b2 = FindBit(ref_buf, columns, *b1 + 1, first_bit);
+}
+
+void FaxFillBits(uint8_t* dest_buf, int columns, int startpos, int endpos) {
+  startpos = std::max(startpos, 0);
+  endpos = std::clamp(endpos, 0, columns);
+  if (startpos >= endpos) {
+    return;
+  }
+  int first_byte = startpos / 8;
+  int last_byte = (endpos - 1) / 8;
+  if (first_byte == last_byte) {
+    for (int i = startpos % 8; i <= (endpos - 1) % 8; ++i) {
+      UNSAFE_TODO(dest_buf[first_byte] -= 1 << (7 - i));
+    }
+    return;
+  }
+  for (int i = startpos % 8; i < 8; ++i) {
+    UNSAFE_TODO(dest_buf[first_byte] -= 1 << (7 - i));
+  }
+  for (int i = 0; i <= (endpos - 1) % 8; ++i) {
+    UNSAFE_TODO(dest_buf[last_byte] -= 1 << (7 - i));
+  }
+  if (last_byte > first_byte + 1) {
+    UNSAFE_TODO(
+        FXSYS_memset(dest_buf + first_byte + 1, 0, last_byte - first_byte - 1));
+  }
+}
+
+inline bool NextBit(const uint8_t* src_buf, int* bitpos) {
+  int pos = (*bitpos)++;
+  return !!UNSAFE_TODO((src_buf[pos / 8] & (1 << (7 - pos % 8))));
+}
+
+const uint8_t kFaxBlackRunIns[] = {
+    0,          2,          0x02,       3,          0,          0x03,
+    2,          0,          2,          0x02,       1,          0,
+    0x03,       4,          0,          2,          0x02,       6,
+    0,          0x03,       5,          0,          1,          0x03,
+    7,          0,          2,          0x04,       9,          0,
+    0x05,       8,          0,          3,          0x04,       10,
+    0,          0x05,       11,         0,          0x07,       12,
+    0,          2,          0x04,       13,         0,          0x07,
+    14,         0,          1,          0x18,       15,         0,
+    5,          0x08,       18,         0,          0x0f,       64,
+    0,          0x17,       16,         0,          0x18,       17,
+    0,          0x37,       0,          0,          10,         0x08,
+    0x00,       0x07,       0x0c,       0x40,       0x07,       0x0d,
+    0x80,       0x07,       0x17,       24,         0,          0x18,
+    25,         0,          0x28,       23,         0,          0x37,
+    22,         0,          0x67,       19,         0,          0x68,
+    20,         0,          0x6c,       21,         0,          54,
+    0x12,       1984 % 256, 1984 / 256, 0x13,       2048 % 256, 2048 / 256,
+    0x14,       2112 % 256, 2112 / 256, 0x15,       2176 % 256, 2176 / 256,
+    0x16,       2240 % 256, 2240 / 256, 0x17,       2304 % 256, 2304 / 256,
+    0x1c,       2368 % 256, 2368 / 256, 0x1d,       2432 % 256, 2432 / 256,
+    0x1e,       2496 % 256, 2496 / 256, 0x1f,       2560 % 256, 2560 / 256,
+    0x24,       52,         0,          0x27,       55,         0,
+    0x28,       56,         0,          0x2b,       59,         0,
+    0x2c,       60,         0,          0x33,       320 % 256,  320 / 256,
+    0x34,       384 % 256,  384 / 256,  0x35,       448 % 256,  448 / 256,
+    0x37,       53,         0,          0x38,       54,         0,
+    0x52,       50,         0,          0x53,       51,         0,
+    0x54,       44,         0,          0x55,       45,         0,
+    0x56,       46,         0,          0x57,       47,         0,
+    0x58,       57,         0,          0x59,       58,         0,
+    0x5a,       61,         0,          0x5b,       256 % 256,  256 / 256,
+    0x64,       48,         0,          0x65,       49,         0,
+    0x66,       62,         0,          0x67,       63,         0,
+    0x68,       30,         0,          0x69,       31,         0,
+    0x6a,       32,         0,          0x6b,       33,         0,
+    0x6c,       40,         0,          0x6d,       41,         0,
+    0xc8,       128,        0,          0xc9,       192,        0,
+    0xca,       26,         0,          0xcb,       27,         0,
+    0xcc,       28,         0,          0xcd,       29,         0,
+    0xd2,       34,         0,          0xd3,       35,         0,
+    0xd4,       36,         0,          0xd5,       37,         0,
+    0xd6,       38,         0,          0xd7,       39,         0,
+    0xda,       42,         0,          0xdb,       43,         0,
+    20,         0x4a,       640 % 256,  640 / 256,  0x4b,       704 % 256,
+    704 / 256,  0x4c,       768 % 256,  768 / 256,  0x4d,       832 % 256,
+    832 / 256,  0x52,       1280 % 256, 1280 / 256, 0x53,       1344 % 256,
+    1344 / 256, 0x54,       1408 % 256, 1408 / 256, 0x55,       1472 % 256,
+    1472 / 256, 0x5a,       1536 % 256, 1536 / 256, 0x5b,       1600 % 256,
+    1600 / 256, 0x64,       1664 % 256, 1664 / 256, 0x65,       1728 % 256,
+    1728 / 256, 0x6c,       512 % 256,  512 / 256,  0x6d,       576 % 256,
+    576 / 256,  0x72,       896 % 256,  896 / 256,  0x73,       960 % 256,
+    960 / 256,  0x74,       1024 % 256, 1024 / 256, 0x75,       1088 % 256,
+    1088 / 256, 0x76,       1152 % 256, 1152 / 256, 0x77,       1216 % 256,
+    1216 / 256, 0xff};
+
+const uint8_t kFaxWhiteRunIns[] = {
+    0,          0,          0,          6,          0x07,       2,
+    0,          0x08,       3,          0,          0x0B,       4,
+    0,          0x0C,       5,          0,          0x0E,       6,
+    0,          0x0F,       7,          0,          6,          0x07,
+    10,         0,          0x08,       11,         0,          0x12,
+    128,        0,          0x13,       8,          0,          0x14,
+    9,          0,          0x1b,       64,         0,          9,
+    0x03,       13,         0,          0x07,       1,          0,
+    0x08,       12,         0,          0x17,       192,        0,
+    0x18,       1664 % 256, 1664 / 256, 0x2a,       16,         0,
+    0x2B,       17,         0,          0x34,       14,         0,
+    0x35,       15,         0,          12,         0x03,       22,
+    0,          0x04,       23,         0,          0x08,       20,
+    0,          0x0c,       19,         0,          0x13,       26,
+    0,          0x17,       21,         0,          0x18,       28,
+    0,          0x24,       27,         0,          0x27,       18,
+    0,          0x28,       24,         0,          0x2B,       25,
+    0,          0x37,       256 % 256,  256 / 256,  42,         0x02,
+    29,         0,          0x03,       30,         0,          0x04,
+    45,         0,          0x05,       46,         0,          0x0a,
+    47,         0,          0x0b,       48,         0,          0x12,
+    33,         0,          0x13,       34,         0,          0x14,
+    35,         0,          0x15,       36,         0,          0x16,
+    37,         0,          0x17,       38,         0,          0x1a,
+    31,         0,          0x1b,       32,         0,          0x24,
+    53,         0,          0x25,       54,         0,          0x28,
+    39,         0,          0x29,       40,         0,          0x2a,
+    41,         0,          0x2b,       42,         0,          0x2c,
+    43,         0,          0x2d,       44,         0,          0x32,
+    61,         0,          0x33,       62,         0,          0x34,
+    63,         0,          0x35,       0,          0,          0x36,
+    320 % 256,  320 / 256,  0x37,       384 % 256,  384 / 256,  0x4a,
+    59,         0,          0x4b,       60,         0,          0x52,
+    49,         0,          0x53,       50,         0,          0x54,
+    51,         0,          0x55,       52,         0,          0x58,
+    55,         0,          0x59,       56,         0,          0x5a,
+    57,         0,          0x5b,       58,         0,          0x64,
+    448 % 256,  448 / 256,  0x65,       512 % 256,  512 / 256,  0x67,
+    640 % 256,  640 / 256,  0x68,       576 % 256,  576 / 256,  16,
+    0x98,       1472 % 256, 1472 / 256, 0x99,       1536 % 256, 1536 / 256,
+    0x9a,       1600 % 256, 1600 / 256, 0x9b,       1728 % 256, 1728 / 256,
+    0xcc,       704 % 256,  704 / 256,  0xcd,       768 % 256,  768 / 256,
+    0xd2,       832 % 256,  832 / 256,  0xd3,       896 % 256,  896 / 256,
+    0xd4,       960 % 256,  960 / 256,  0xd5,       1024 % 256, 1024 / 256,
+    0xd6,       1088 % 256, 1088 / 256, 0xd7,       1152 % 256, 1152 / 256,
+    0xd8,       1216 % 256, 1216 / 256, 0xd9,       1280 % 256, 1280 / 256,
+    0xda,       1344 % 256, 1344 / 256, 0xdb,       1408 % 256, 1408 / 256,
+    0,          3,          0x08,       1792 % 256, 1792 / 256, 0x0c,
+    1856 % 256, 1856 / 256, 0x0d,       1920 % 256, 1920 / 256, 10,
+    0x12,       1984 % 256, 1984 / 256, 0x13,       2048 % 256, 2048 / 256,
+    0x14,       2112 % 256, 2112 / 256, 0x15,       2176 % 256, 2176 / 256,
+    0x16,       2240 % 256, 2240 / 256, 0x17,       2304 % 256, 2304 / 256,
+    0x1c,       2368 % 256, 2368 / 256, 0x1d,       2432 % 256, 2432 / 256,
+    0x1e,       2496 % 256, 2496 / 256, 0x1f,       2560 % 256, 2560 / 256,
+    0xff,
+};
+
+int FaxGetRun(pdfium::span<const uint8_t> ins_array,
+              const uint8_t* src_buf,
+              int* bitpos,
+              int bitsize) {
+  uint32_t code = 0;
+  int ins_off = 0;
+  while (true) {
+    uint8_t ins = ins_array[ins_off++];
+    if (ins == 0xff) {
+      return -1;
+    }
+
+    if (*bitpos >= bitsize) {
+      return -1;
+    }
+
+    code <<= 1;
+    UNSAFE_TODO({
+      if (src_buf[*bitpos / 8] & (1 << (7 - *bitpos % 8))) {
+        ++code;
+      }
+    });
+    ++(*bitpos);
+    int next_off = ins_off + ins * 3;
+    for (; ins_off < next_off; ins_off += 3) {
+      if (ins_array[ins_off] == code) {
+        return ins_array[ins_off + 1] + ins_array[ins_off + 2] * 256;
+      }
+    }
+  }
+}
+
+void FaxG4GetRow(const uint8_t* src_buf,
+                 int bitsize,
+                 int* bitpos,
+                 uint8_t* dest_buf,
+                 pdfium::span<const uint8_t> ref_buf,
+                 int columns) {
+  int a0 = -1;
+  bool a0color = true;
+  while (true) {
+    if (*bitpos >= bitsize) {
+      return;
+    }
+
+    int a1;
+    int a2;
+    int b1;
+    int b2;
+    FaxG4FindB1B2(ref_buf, columns, a0, a0color, &b1, &b2);
+
+    int v_delta = 0;
+    if (!NextBit(src_buf, bitpos)) {
+      if (*bitpos >= bitsize) {
+        return;
+      }
+
+      bool bit1 = NextBit(src_buf, bitpos);
+      if (*bitpos >= bitsize) {
+        return;
+      }
+
+      bool bit2 = NextBit(src_buf, bitpos);
+      if (bit1) {
+        v_delta = bit2 ? 1 : -1;
+      } else if (bit2) {
+        int run_len1 = 0;
+        while (true) {
+          int run = FaxGetRun(
+              a0color ? pdfium::span<const uint8_t, pdfium::dynamic_extent>(
+                            kFaxWhiteRunIns)
+                      : pdfium::span<const uint8_t, pdfium::dynamic_extent>(
+                            kFaxBlackRunIns),
+              src_buf, bitpos, bitsize);
+          run_len1 += run;
+          if (run < 64) {
+            break;
+          }
+        }
+        if (a0 < 0) {
+          ++run_len1;
+        }
+        if (run_len1 < 0) {
+          return;
+        }
+
+        a1 = a0 + run_len1;
+        if (!a0color) {
+          FaxFillBits(dest_buf, columns, a0, a1);
+        }
+
+        int run_len2 = 0;
+        while (true) {
+          int run = FaxGetRun(
+              a0color ? pdfium::span<const uint8_t, pdfium::dynamic_extent>(
+                            kFaxBlackRunIns)
+                      : pdfium::span<const uint8_t, pdfium::dynamic_extent>(
+                            kFaxWhiteRunIns),
+              src_buf, bitpos, bitsize);
+          run_len2 += run;
+          if (run < 64) {
+            break;
+          }
+        }
+        if (run_len2 < 0) {
+          return;
+        }
+        a2 = a1 + run_len2;
+        if (a0color) {
+          FaxFillBits(dest_buf, columns, a1, a2);
+        }
+
+        a0 = a2;
+        if (a0 < columns) {
+          continue;
+        }
+
+        return;
+      } else {
+        if (*bitpos >= bitsize) {
+          return;
+        }
+
+        if (NextBit(src_buf, bitpos)) {
+          if (!a0color) {
+            FaxFillBits(dest_buf, columns, a0, b2);
+          }
+
+          if (b2 >= columns) {
+            return;
+          }
+
+          a0 = b2;
+          continue;
+        }
+
+        if (*bitpos >= bitsize) {
+          return;
+        }
+
+        bool next_bit1 = NextBit(src_buf, bitpos);
+        if (*bitpos >= bitsize) {
+          return;
+        }
+
+        bool next_bit2 = NextBit(src_buf, bitpos);
+        if (next_bit1) {
+          v_delta = next_bit2 ? 2 : -2;
+        } else if (next_bit2) {
+          if (*bitpos >= bitsize) {
+            return;
+          }
+
+          v_delta = NextBit(src_buf, bitpos) ? 3 : -3;
+        } else {
+          if (*bitpos >= bitsize) {
+            return;
+          }
+
+          if (NextBit(src_buf, bitpos)) {
+            *bitpos += 3;
+            continue;
+          }
+          *bitpos += 5;
+          return;
+        }
+      }
+    }
+    a1 = b1 + v_delta;
+    if (!a0color) {
+      FaxFillBits(dest_buf, columns, a0, a1);
+    }
+
+    if (a1 >= columns) {
+      return;
+    }
+
+    // The position of picture element must be monotonic increasing.
+    if (a0 >= a1) {
+      return;
+    }
+
+    a0 = a1;
+    a0color = !a0color;
+  }
+}
+
+void FaxSkipEOL(const uint8_t* src_buf, int bitsize, int* bitpos) {
+  int startbit = *bitpos;
+  while (*bitpos < bitsize) {
+    if (!NextBit(src_buf, bitpos)) {
+      continue;
+    }
+    if (*bitpos - startbit <= 11) {
+      *bitpos = startbit;
+    }
+    return;
+  }
+}
+
+void FaxGet1DLine(const uint8_t* src_buf,
+                  int bitsize,
+                  int* bitpos,
+                  uint8_t* dest_buf,
+                  int columns) {
+  bool color = true;
+  int startpos = 0;
+  while (true) {
+    if (*bitpos >= bitsize) {
+      return;
+    }
+
+    int run_len = 0;
+    while (true) {
+      int run =
+          FaxGetRun(color ? pdfium::span<const uint8_t, pdfium::dynamic_extent>(
+                                kFaxWhiteRunIns)
+                          : pdfium::span<const uint8_t, pdfium::dynamic_extent>(
+                                kFaxBlackRunIns),
+                    src_buf, bitpos, bitsize);
+      if (run < 0) {
+        while (*bitpos < bitsize) {
+          if (NextBit(src_buf, bitpos)) {
+            return;
+          }
+        }
+        return;
+      }
+      run_len += run;
+      if (run < 64) {
+        break;
+      }
+    }
+    if (!color) {
+      FaxFillBits(dest_buf, columns, startpos, startpos + run_len);
+    }
+
+    startpos += run_len;
+    if (startpos >= columns) {
+      break;
+    }
+
+    color = !color;
+  }
+}
+
+struct Options {
+  int k;
+  bool end_of_line;
+  bool encoded_byte_align;
+  bool black_is_1;
+};
+
+// Same as FaxDecoder::GetNextLine() used to be, for rows `width` pixels wide.
+class Decoder {
+ public:
+  Decoder(pdfium::span<const uint8_t> src_span, int width, Options options)
+      : src_span_(src_span),
+        width_(width),
+        options_(options),
+        byte_align_(options.encoded_byte_align),
+        scanline_buf_((width + 31) / 32 * 4),
+        ref_buf_(scanline_buf_.size(), 0xff) {}
+
+  // Returns an empty span at the end of the data.
+  pdfium::span<const uint8_t> GetNextLine() {
+    const int bitsize = static_cast<int>(src_span_.size() * 8);
+    FaxSkipEOL(src_span_.data(), bitsize, &bitpos_);
+    if (bitpos_ >= bitsize) {
+      return {};
+    }
+
+    std::ranges::fill(scanline_buf_, 0xff);
+    if (options_.k < 0) {
+      FaxG4GetRow(src_span_.data(), bitsize, &bitpos_, scanline_buf_.data(),
+                  ref_buf_, width_);
+      ref_buf_ = scanline_buf_;
+    } else if (options_.k == 0) {
+      FaxGet1DLine(src_span_.data(), bitsize, &bitpos_, scanline_buf_.data(),
+                   width_);
+    } else {
+      if (NextBit(src_span_.data(), &bitpos_)) {
+        FaxGet1DLine(src_span_.data(), bitsize, &bitpos_,
+                     scanline_buf_.data(), width_);
+      } else {
+        FaxG4GetRow(src_span_.data(), bitsize, &bitpos_, scanline_buf_.data(),
+                    ref_buf_, width_);
+      }
+      ref_buf_ = scanline_buf_;
+    }
+    if (options_.end_of_line) {
+      FaxSkipEOL(src_span_.data(), bitsize, &bitpos_);
+    }
+
+    if (byte_align_ && bitpos_ < bitsize) {
+      int bitpos0 = bitpos_;
+      int bitpos1 = FxAlignToBoundary<8>(bitpos_);
+      while (byte_align_ && bitpos0 < bitpos1) {
+        int bit = src_span_[bitpos0 / 8] & (1 << (7 - bitpos0 % 8));
+        if (bit != 0) {
+          byte_align_ = false;
+        } else {
+          ++bitpos0;
+        }
+      }
+      if (byte_align_) {
+        bitpos_ = bitpos1;
+      }
+    }
+    if (options_.black_is_1) {
+      for (uint8_t& byte : scanline_buf_) {
+        byte = ~byte;
+      }
+    }
+    return scanline_buf_;
+  }
+
+  uint32_t GetSrcOffset() const {
+    return static_cast<uint32_t>(
+        std::min<size_t>((bitpos_ + 7) / 8, src_span_.size()));
+  }
+
+ private:
+  const pdfium::span<const uint8_t> src_span_;
+  const int width_;
+  const Options options_;
+  bool byte_align_;
+  int bitpos_ = 0;
+  std::vector<uint8_t> scanline_buf_;
+  std::vector<uint8_t> ref_buf_;
+};
+
+// Same as FaxModule::FaxG4Decode() used to be.
+int FaxG4Decode(pdfium::span<const uint8_t> src_span,
+                int starting_bitpos,
+                int width,
+                int height,
+                int pitch,
+                uint8_t* dest_buf) {
+  const int bitsize = static_cast<int>(src_span.size() * 8);
+  std::vector<uint8_t> ref_buf(pitch, 0xff);
+  int bitpos = starting_bitpos;
+  for (int row = 0; row < height; ++row) {
+    uint8_t* line_buf = UNSAFE_TODO(dest_buf + row * pitch);
+    UNSAFE_TODO(FXSYS_memset(line_buf, 0xff, pitch));
+    FaxG4GetRow(src_span.data(), bitsize, &bitpos, line_buf, ref_buf, width);
+    UNSAFE_TODO(FXSYS_memcpy(ref_buf.data(), line_buf, pitch));
+  }
+  return bitpos;
+}
+
+}  // namespace reference
+
+// Deterministic filler so that failures are reproducible.
+class TestData {
+ public:
+  uint32_t Next() {
+    state_ = state_ * 1103515245 + 12345;
+    return state_ >> 8;
+  }
+
+ private:
+  uint32_t state_ = 1;
+};
+
+// A 1 bpp image where set bits are white, like the decoder output with
+// BlackIs1 false.
+struct TestImage {
+  TestImage(int width, int height)
+      : width(width),
+        height(height),
+        pitch((width + 31) / 32 * 4),
+        pixels(pitch * height, 0xff) {}
+
+  bool IsWhite(int x, int y) const {
+    return x < 0 || (pixels[y * pitch + x / 8] & (0x80 >> (x % 8)));
+  }
+
+  void SetBlack(int x, int y) {
+    pixels[y * pitch + x / 8] &= ~(0x80 >> (x % 8));
+  }
+
+  pdfium::span<const uint8_t> GetRow(int y) const {
+    return pdfium::span(pixels).subspan(static_cast<size_t>(y * pitch),
+                                        static_cast<size_t>(pitch));
+  }
+
+  const int width;
+  const int height;
+  const int pitch;
+  std::vector<uint8_t> pixels;
+};
+
+// Lines of text-like marks with long white runs in between, roughly like a
+// scanned page.
+TestImage CreateScannedPage(int width, int height, TestData& data) {
+  TestImage image(width, height);
+  for (int line_top = 10; line_top + 30 < height; line_top += 40) {
+    int x = 20 + data.Next() % 40;
+    while (x + 30 < width - 20) {
+      const int glyph_width = 4 + data.Next() % 20;
+      const int glyph_top = line_top + data.Next() % 8;
+      const int glyph_bottom = line_top + 20 + data.Next() % 10;
+      for (int y = glyph_top; y < glyph_bottom; ++y) {
+        for (int gx = x; gx < x + glyph_width; ++gx) {
+          if (data.Next() % 5 != 0) {
+            image.SetBlack(gx, y);
+          }
+        }
+      }
+      x += glyph_width + 2 + data.Next() % (data.Next() % 8 ? 6 : 60);
+    }
+  }
+  return image;
+}
+
+// Encodes images the way ITU-T T.4 and T.6 describe, to produce input for
+// the decoder that does not depend on its implementation.
+class TestFaxEncoder {
+ public:
+  void Encode1DRow(const TestImage& image, int y) {
+    bool white = true;
+    int a0 = 0;
+    while (a0 < image.width) {
+      const int a1 = NextChange(image, y, a0, white);
+      EncodeRun(a1 - a0, white);
+      a0 = a1;
+      white = !white;
+    }
+  }
+
+  // Encodes row `y` relative to row `y` - 1, or to a white row for row 0.
+  void Encode2DRow(const TestImage& image, int y) {
+    int a0 = -1;
+    bool white = true;
+    while (a0 < image.width) {
+      const int a1 = NextChange(image, y, a0 + 1, white);
+      int b1 = image.width;
+      int b2 = image.width;
+      if (y > 0) {
+        // The first change to the color opposite of `white` right of a0.
+        b1 = a0 + 1;
+        while (b1 < image.width &&
+               (image.IsWhite(b1, y - 1) == white ||
+                image.IsWhite(b1, y - 1) == image.IsWhite(b1 - 1, y - 1))) {
+          ++b1;
+        }
+        b2 = NextChange(image, y - 1, b1, !white);
+      }
+      if (b2 < a1) {
+        AddBits(0x1, 4);
+        a0 = b2;
+      } else if (a1 - b1 >= -3 && a1 - b1 <= 3) {
+        static constexpr uint8_t kVerticalCodes[7][2] = {
+            {0x02, 7}, {0x02, 6}, {0x02, 3}, {0x01, 1},
+            {0x03, 3}, {0x03, 6}, {0x03, 7},
+        };
+        const uint8_t* code = kVerticalCodes[a1 - b1 + 3];
+        AddBits(code[0], code[1]);
+        a0 = a1;
+        white = !white;
+      } else {
+        const int a2 = NextChange(image, y, a1, !white);
+        AddBits(0x1, 3);
+        EncodeRun(a1 - std::max(a0, 0), white);
+        EncodeRun(a2 - a1, !white);
+        a0 = a2;
+      }
+    }
+  }
+
+  void AddBits(uint32_t code, int bits) {
+    for (int i = bits - 1; i >= 0; --i) {
+      if (bit_count_ % 8 == 0) {
+        data_.push_back(0);
+      }
+      if (code & (1 << i)) {
+        data_.back() |= 0x80 >> (bit_count_ % 8);
+      }
+      ++bit_count_;
+    }
+  }
+
+  const std::vector<uint8_t>& data() const { return data_; }
+  int bit_count() const { return bit_count_; }
+
+ private:
+  // Returns the first column from `x` on that is not `white`.
+  static int NextChange(const TestImage& image, int y, int x, bool white) {
+    x = std::max(x, 0);
+    while (x < image.width && image.IsWhite(x, y) == white) {
+      ++x;
+    }
+    return x;
+  }
+
+  void EncodeRun(int run, bool white) {
+    while (run >= 2560) {
+      AddBits(0x1f, 12);
+      run -= 2560;
+    }
+    if (run >= 64) {
+      const uint8_t* code = white ? kWhiteMakeup[run / 64 - 1]
+                                  : kBlackMakeup[run / 64 - 1];
+      AddBits(code[0], code[1]);
+      run %= 64;
+    }
+    const uint8_t* code =
+        white ? kWhiteTerminating[run] : kBlackTerminating[run];
+    AddBits(code[0], code[1]);
+  }
+
+  std::vector<uint8_t> data_;
+  int bit_count_ = 0;
+};
+
+// Encodes `image` with K = `k` in the PDF sense: negative for pure 2D coding
+// (Group 4), 0 for pure 1D coding, and positive for mixed coding with a tag
+// bit before each row. With `end_of_line`, each row starts with an EOL code.
+// With `byte_align`, each row starts on a byte boundary. If `row_ends` is not
+// null, it receives the bit position where each row ends.
+std::vector<uint8_t> EncodeImage(const TestImage& image,
+                                 int k,
+                                 bool end_of_line = false,
+                                 bool byte_align = false,
+                                 std::vector<int>* row_ends = nullptr) {
+  TestFaxEncoder encoder;
+  for (int y = 0; y < image.height; ++y) {
+    if (byte_align) {
+      // Fill bits, so that the row or its EOL code ends on a byte boundary.
+      const int code_bits = end_of_line ? 12 : 0;
+      encoder.AddBits(0, (64 - (encoder.bit_count() + code_bits) % 8) % 8);
+    }
+    if (end_of_line) {
+      encoder.AddBits(0x001, 12);
+    }
+    if (k < 0) {
+      encoder.Encode2DRow(image, y);
+    } else if (k == 0) {
+      encoder.Encode1DRow(image, y);
+    } else if (y % k == 0) {
+      encoder.AddBits(1, 1);
+      encoder.Encode1DRow(image, y);
+    } else {
+      encoder.AddBits(0, 1);
+      encoder.Encode2DRow(image, y);
+    }
+    if (row_ends) {
+      row_ends->push_back(encoder.bit_count());
+    }
+  }
+  return encoder.data();
+}
+
+// Rows of short black marks, each followed by a white row, so that the white
+// rows are coded mostly in pass mode.
+TestImage CreatePassModeImage(int width, int height, TestData& data) {
+  TestImage image(width, height);
+  for (int y = 0; y < height; y += 2) {
+    for (int x = static_cast<int>(data.Next() % 8); x < width;
+         x += 2 + static_cast<int>(data.Next() % 12)) {
+      for (int end = std::min(x + 1 + static_cast<int>(data.Next() % 3), width);
+           x < end; ++x) {
+        image.SetBlack(x, y);
+      }
+    }
+  }
+  return image;
+}
+
+// Decodes `encoded` with both the current and the reference decoder, and
+// expects the same rows and source offsets from both.
+void ExpectSameAsReference(pdfium::span<const uint8_t> encoded,
+                           int width,
+                           int height,
+                           const reference::Options& options) {
+  std::unique_ptr<fxcodec::ScanlineDecoder> decoder =
+      fxcodec::FaxModule::CreateDecoder(
+          encoded, width, height, options.k, options.end_of_line,
+          options.encoded_byte_align, options.black_is_1, /*Columns=*/0,
+          /*Rows=*/0);
+  ASSERT_TRUE(decoder);
+  reference::Decoder reference_decoder(encoded, width, options);
+  for (int y = 0; y < height; ++y) {
+    SCOPED_TRACE(y);
+    pdfium::span<const uint8_t> expected = reference_decoder.GetNextLine();
+    pdfium::span<const uint8_t> actual = decoder->GetScanline(y);
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_TRUE(std::ranges::equal(expected, actual));
+    ASSERT_EQ(reference_decoder.GetSrcOffset(), decoder->GetSrcOffset());
+  }
+
+  if (options.k >= 0 || options.end_of_line || options.encoded_byte_align ||
+      options.black_is_1) {
+    return;
+  }
+  const int pitch = (width + 31) / 32 * 4;
+  for (int starting_bitpos : {0, 3}) {
+    SCOPED_TRACE(starting_bitpos);
+    std::vector<uint8_t> expected(pitch * height);
+    std::vector<uint8_t> actual(pitch * height);
+    EXPECT_EQ(reference::FaxG4Decode(encoded, starting_bitpos, width, height,
+                                     pitch, expected.data()),
+              fxcodec::FaxModule::FaxG4Decode(encoded, starting_bitpos, width,
+                                              height, pitch, actual.data()));
+    EXPECT_EQ(expected, actual);
+  }
+}
+
+void ExpectRowEq(pdfium::span<const uint8_t> expected,
+                 pdfium::span<const uint8_t> actual,
+                 int width) {
+  ASSERT_GE(actual.size(), static_cast<size_t>((width + 7) / 8));
+  for (int x = 0; x < width; ++x) {
+    ASSERT_EQ(!!(expected[x / 8] & (0x80 >> (x % 8))),
+              !!(actual[x / 8] & (0x80 >> (x % 8))))
+        << "at column " << x;
+  }
+}
+
+}  // namespace
+
+TEST(FaxModule, DecodeRoundTrip) {
+  TestData data;
+  for (int width : {1, 7, 64, 100, 1728, 2600, 5000}) {
+    TestImage image(width, 30);
+    for (int y = 0; y < image.height; ++y) {
+      // Runs of all lengths, including ones that need several makeup codes.
+      int x = 0;
+      bool white = data.Next() % 2;
+      while (x < width) {
+        int run = data.Next() % 4 ? 1 + data.Next() % 70
+                                  : 1 + data.Next() % (2 * width);
+        for (int end = std::min(x + run, width); x < end; ++x) {
+          if (!white) {
+            image.SetBlack(x, y);
+          }
+        }
+        white = !white;
+      }
+    }
+    for (int k : {-1, 0, 4}) {
+      SCOPED_TRACE(testing::Message() << width << " " << k);
+      const std::vector<uint8_t> encoded = EncodeImage(image, k);
+      std::unique_ptr<fxcodec::ScanlineDecoder> decoder =
+          fxcodec::FaxModule::CreateDecoder(
+              encoded, width, image.height, k, /*EndOfLine=*/false,
+              /*EncodedByteAlign=*/false, /*BlackIs1=*/false, /*Columns=*/0,
+              /*Rows=*/0);
+      ASSERT_TRUE(decoder);
+      for (int y = 0; y < image.height; ++y) {
+        SCOPED_TRACE(y);
+        ExpectRowEq(image.GetRow(y), decoder->GetScanline(y), width);
+      }
+      if (k < 0) {
+        std::vector<uint8_t> decoded(image.pixels.size());
+        const int bitpos = fxcodec::FaxModule::FaxG4Decode(
+            encoded, 0, width, image.height, image.pitch, decoded.data());
+        EXPECT_EQ(static_cast<int>(encoded.size()), (bitpos + 7) / 8);
+        for (int y = 0; y < image.height; ++y) {
+          SCOPED_TRACE(y);
+          ExpectRowEq(image.GetRow(y),
+                      pdfium::span(decoded).subspan(
+                          static_cast<size_t>(y * image.pitch)),
+                      width);
+        }
+      }
+    }
+  }
+}
+
+TEST(FaxModule, DecodeTruncated) {
+  TestData data;
+  TestImage image = CreateScannedPage(300, 100, data);
+  std::vector<int> row_ends;
+  const std::vector<uint8_t> encoded =
+      EncodeImage(image, -1, /*end_of_line=*/false, /*byte_align=*/false,
+                  &row_ends);
+  for (size_t size = 0; size < encoded.size(); size += 7) {
+    SCOPED_TRACE(size);
+    // Must not read past the end of the data, and must decode the rows that
+    // are complete before the cut off point.
+    std::vector<uint8_t> truncated(encoded.begin(), encoded.begin() + size);
+    std::vector<uint8_t> decoded(image.pixels.size());
+    const int bitpos = fxcodec::FaxModule::FaxG4Decode(
+        truncated, 0, image.width, image.height, image.pitch, decoded.data());
+    EXPECT_LE(bitpos, static_cast<int>(size * 8 + 5));
+    for (int y = 0; y < image.height &&
+                    row_ends[y] <= static_cast<int>(size * 8);
+         ++y) {
+      SCOPED_TRACE(y);
+      ExpectRowEq(image.GetRow(y),
+                  pdfium::span(decoded).subspan(
+                      static_cast<size_t>(y * image.pitch)),
+                  image.width);
+    }
+  }
+}
+
+TEST(FaxModule, MatchesReferenceDecoder) {
+  TestData data;
+  const TestImage scanned_page = CreateScannedPage(500, 60, data);
+  const TestImage pass_mode_image = CreatePassModeImage(300, 40, data);
+  // Long runs, including ones that need several makeup codes.
+  TestImage long_run_image(6000, 8);
+  for (int y = 0; y < long_run_image.height; ++y) {
+    for (int x = y * 300; x < y * 300 + 2600 + y * 97; ++x) {
+      long_run_image.SetBlack(x, y);
+    }
+  }
+
+  for (const TestImage* image : std::to_array<const TestImage*>(
+           {&scanned_page, &pass_mode_image, &long_run_image})) {
+    for (int k : {-1, 0, 3}) {
+      for (bool end_of_line : {false, true}) {
+        for (bool byte_align : {false, true}) {
+          SCOPED_TRACE(testing::Message()
+                       << image->width << " " << k << " " << end_of_line
+                       << " " << byte_align);
+          const std::vector<uint8_t> encoded =
+              EncodeImage(*image, k, end_of_line, byte_align);
+          for (bool black_is_1 : {false, true}) {
+            const reference::Options options = {k, end_of_line, byte_align,
+                                                black_is_1};
+            ExpectSameAsReference(encoded, image->width, image->height,
+                                  options);
+          }
+
+          // EOL codes and fill bits must not change the decoded rows.
+          std::unique_ptr<fxcodec::ScanlineDecoder> decoder =
+              fxcodec::FaxModule::CreateDecoder(
+                  encoded, image->width, image->height, k, end_of_line,
+                  byte_align, /*BlackIs1=*/false, /*Columns=*/0, /*Rows=*/0);
+          ASSERT_TRUE(decoder);
+          for (int y = 0; y < image->height; ++y) {
+            SCOPED_TRACE(y);
+            ExpectRowEq(image->GetRow(y), decoder->GetScanline(y),
+                        image->width);
+          }
+
+          // Also with the data cut short and with flipped bits, which the
+          // decoders handle as errors.
+          const reference::Options options = {k, end_of_line, byte_align,
+                                              false};
+          for (size_t size = 0; size < encoded.size(); size += 1 + size / 4) {
+            ExpectSameAsReference(pdfium::span(encoded).first(size),
+                                  image->width, image->height, options);
+          }
+          for (int i = 0; i < 20; ++i) {
+            std::vector<uint8_t> corrupted = encoded;
+            corrupted[data.Next() % corrupted.size()] ^= 1 << (data.Next() % 8);
+            ExpectSameAsReference(corrupted, image->width, image->height,
+                                  options);
+          }
+        }
+      }
+    }
+  }
+
+  // Random data, including runs of ones as in V0 codes and runs of zeros as
+  // in EOL codes and fill bits.
+  for (int i = 0; i < 2000; ++i) {
+    std::vector<uint8_t> random(1 + data.Next() % 400);
+    const int mode = data.Next() % 4;
+    for (uint8_t& byte : random) {
+      const uint8_t random_byte = static_cast<uint8_t>(data.Next());
+      switch (mode) {
+        case 0:
+          byte = random_byte;
+          break;
+        case 1:
+          byte = data.Next() % 4 ? (0x80 | random_byte) : random_byte;
+          break;
+        case 2:
+          byte = data.Next() % 3 ? 0xff : random_byte;
+          break;
+        default:
+          byte = data.Next() % 3 ? 0x00 : random_byte;
+          break;
+      }
+    }
+    const int width = 1 + data.Next() % 300;
+    const int height = 1 + data.Next() % 40;
+    const reference::Options options = {
+        static_cast<int>(data.Next() % 3) - 1, !!(data.Next() % 2),
+        !!(data.Next() % 2), !!(data.Next() % 2)};
+    SCOPED_TRACE(i);
+    ExpectSameAsReference(random, width, height, options);
+  }
+}
+
+// Not run by default. Use --gtest_also_run_disabled_tests to time decoding a
+// scanned A4 page at 300 DPI with each type of coding.
+TEST(FaxModule, DISABLED_DecodeBenchmark) {
+  static constexpr int kIterations = 20;
+  TestData data;
+  TestImage image = CreateScannedPage(2480, 3508, data);
+  for (int k : {-1, 0, 4}) {
+    const std::vector<uint8_t> encoded = EncodeImage(image, k);
+    ScopedBenchmarkTimer timer("K=" + std::to_string(k) + ", " +
+                                   std::to_string(encoded.size()) + " bytes",
+                               kIterations);
+    for (int i = 0; i < kIterations; ++i) {
+      std::unique_ptr<fxcodec::ScanlineDecoder> decoder =
+          fxcodec::FaxModule::CreateDecoder(
+              encoded, image.width, image.height, k, /*EndOfLine=*/false,
+              /*EncodedByteAlign=*/false, /*BlackIs1=*/false, /*Columns=*/0,
+              /*Rows=*/0);
+      ASSERT_TRUE(decoder);
+      for (int y = 0; y < image.height; ++y) {
+        ASSERT_FALSE(decoder->GetScanline(y).empty());
+      }
+    }
+  }
+}
@@ -18,6 +18,7 @@
 #include "core/fxcodec/data_and_bytes_consumed.h"
 #include "core/fxcodec/scanlinedecoder.h"
 #include "core/fxcrt/check.h"
+#include "core/fxcrt/check_op.h"
 #include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/fixed_size_data_vector.h"
 #include "core/fxcrt/fx_2d_size.h"
@@ -38,6 +39,16 @@
 #include "third_party/zlib/zlib.h"
 #endif
 
+#if defined(USE_SYSTEM_LIBDEFLATE)
+#include <libdeflate.h>
+
+#include <atomic>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 extern "C" {
 
 static void* my_alloc_func(void* opaque,
@@ -67,15 +78,45 @@ uint32_t FlateGetPossiblyTruncatedTotalIn(z_stream* context) {
   return pdfium::saturated_cast<uint32_t>(context->total_in);
 }
 
-size_t FlateCompress(pdfium::span<const uint8_t> src_span,
-                     pdfium::span<uint8_t> dest_span) {
-  const auto src_size = pdfium::checked_cast<unsigned long>(src_span.size());
-  auto dest_size = pdfium::checked_cast<unsigned long>(dest_span.size());
-  if (compress(dest_span.data(), &dest_size, src_span.data(), src_size) !=
-      Z_OK) {
-    return 0;
+int GetZlibStrategy(FlateModule::Strategy strategy) {
+  switch (strategy) {
+    case FlateModule::Strategy::kDefault:
+      return Z_DEFAULT_STRATEGY;
+    case FlateModule::Strategy::kFiltered:
+      return Z_FILTERED;
+    case FlateModule::Strategy::kHuffmanOnly:
+      return Z_HUFFMAN_ONLY;
+    case FlateModule::Strategy::kRle:
+      return Z_RLE;
+  }
+}
+
+// Same as zlib's compress2(), which only supports the default strategy.
+DataVector<uint8_t> FlateCompress(pdfium::span<const uint8_t> src_span,
+                                  int level,
+                                  int strategy) {
+  z_stream stream = {};
+  stream.zalloc = my_alloc_func;
+  stream.zfree = my_free_func;
+  // Window and memory sizes are zlib's defaults, as used by compress2().
+  if (deflateInit2(&stream, level, Z_DEFLATED, MAX_WBITS, /*memLevel=*/8,
+                   strategy) != Z_OK) {
+    return DataVector<uint8_t>();
   }
-  return pdfium::checked_cast<size_t>(dest_size);
+  const auto src_size = pdfium::checked_cast<uLong>(src_span.size());
+  DataVector<uint8_t> dest_buf(deflateBound(&stream, src_size));
+  stream.next_in = const_cast<unsigned char*>(src_span.data());
+  stream.avail_in = pdfium::checked_cast<uInt>(src_span.size());
+  stream.next_out = dest_buf.data();
+  stream.avail_out = pdfium::checked_cast<uInt>(dest_buf.size());
+  const int result = deflate(&stream, Z_FINISH);
+  const size_t compressed_size = pdfium::checked_cast<size_t>(stream.total_out);
+  deflateEnd(&stream);
+  if (result != Z_STREAM_END) {
+    return DataVector<uint8_t>();
+  }
+  dest_buf.resize(compressed_size);
+  return dest_buf;
 }
 
 z_stream* FlateInit() {
@@ -122,7 +163,14 @@ class CLZWDecoder {
  public:
   CLZWDecoder(pdfium::span<const uint8_t> src_span, bool early_change);
 
+  // Decodes the whole stream into the buffer returned by TakeDestBuf().
   bool Decode();
+
+  // Decodes the next bytes of the stream into `dest`, resuming where the
+  // previous call stopped. Returns the number of bytes written, which is only
+  // less than `dest.size()` at the end of the data or on error.
+  size_t Read(pdfium::span<uint8_t> dest);
+
   uint32_t GetSrcSize() const { return (src_bit_pos_ + 7) / 8; }
   DataVector<uint8_t> TakeDestBuf() {
     dest_buf_.resize(dest_byte_pos_);
@@ -130,6 +178,11 @@ class CLZWDecoder {
   }
 
  private:
+  enum class State : uint8_t { kDecoding, kDone, kError };
+
+  // Reads the next code and leaves its string, if any, reversed on
+  // `decode_stack_`.
+  void DecodeNextCode();
   void AddCode(uint32_t prefix_code, uint8_t append_char);
   void DecodeString(uint32_t code);
   bool ExpandDestBuf(size_t additional_size);
@@ -142,6 +195,9 @@ class CLZWDecoder {
   FixedSizeDataVector<uint8_t> decode_stack_;
   const uint8_t early_change_;
   uint8_t code_len_ = 9;
+  uint8_t last_char_ = 0;
+  State state_ = State::kDecoding;
+  uint32_t old_code_ = 0xFFFFFFFF;
   uint32_t current_code_ = 0;
   FixedSizeDataVector<uint32_t> codes_;
 };
@@ -206,124 +262,114 @@ bool CLZWDecoder::ExpandDestBuf(size_t additional_size) {
 }
 
 bool CLZWDecoder::Decode() {
-  pdfium::span<uint8_t> decode_span = decode_stack_.span();
-  uint32_t old_code = 0xFFFFFFFF;
-  uint8_t last_char = 0;
-
   // In one PDF test set, 40% of Decode() calls did not need to realloc with
   // this size.
   dest_buf_.resize(512);
   while (true) {
-    if (src_bit_pos_ + code_len_ > src_span_.size() * 8) {
-      break;
+    if (dest_byte_pos_ == dest_buf_.size() && !ExpandDestBuf(1)) {
+      return false;
     }
-
-    int byte_pos = src_bit_pos_ / 8;
-    int bit_pos = src_bit_pos_ % 8;
-    uint8_t bit_left = code_len_;
-    uint32_t code = 0;
-    if (bit_pos) {
-      bit_left -= 8 - bit_pos;
-      code = (src_span_[byte_pos++] & ((1 << (8 - bit_pos)) - 1)) << bit_left;
+    FX_SAFE_UINT32 dest_byte_pos = dest_byte_pos_;
+    dest_byte_pos += Read(pdfium::span(dest_buf_).subspan(dest_byte_pos_));
+    if (!dest_byte_pos.IsValid()) {
+      return false;
     }
-    if (bit_left < 8) {
-      code |= src_span_[byte_pos] >> (8 - bit_left);
-    } else {
-      bit_left -= 8;
-      code |= src_span_[byte_pos++] << bit_left;
-      if (bit_left) {
-        code |= src_span_[byte_pos] >> (8 - bit_left);
-      }
+    dest_byte_pos_ = dest_byte_pos.ValueOrDie();
+    if (dest_byte_pos_ < dest_buf_.size()) {
+      break;
     }
-    src_bit_pos_ += code_len_;
-
-    if (code < 256) {
-      if (dest_byte_pos_ >= dest_buf_.size()) {
-        if (!ExpandDestBuf(dest_byte_pos_ - dest_buf_.size() + 1)) {
-          return false;
-        }
-      }
+  }
+  return state_ != State::kError && dest_byte_pos_ != 0;
+}
 
-      dest_buf_[dest_byte_pos_] = static_cast<uint8_t>(code);
-      dest_byte_pos_++;
-      last_char = (uint8_t)code;
-      if (old_code != 0xFFFFFFFF) {
-        AddCode(old_code, last_char);
+size_t CLZWDecoder::Read(pdfium::span<uint8_t> dest) {
+  pdfium::span<const uint8_t> decode_span = decode_stack_.span();
+  size_t bytes_read = 0;
+  while (bytes_read < dest.size()) {
+    if (stack_len_ == 0) {
+      if (state_ != State::kDecoding) {
+        break;
       }
-      old_code = code;
-      continue;
-    }
-    if (code == 256) {
-      code_len_ = 9;
-      current_code_ = 0;
-      old_code = 0xFFFFFFFF;
+      DecodeNextCode();
       continue;
     }
-    if (code == 257) {
-      break;
-    }
-
-    // Case where |code| is 258 or greater.
-    if (old_code == 0xFFFFFFFF) {
-      return false;
-    }
-
-    DCHECK(old_code < 256 || old_code >= 258);
-    stack_len_ = 0;
-    if (code - 258 >= current_code_) {
-      if (stack_len_ < decode_stack_.size()) {
-        decode_span[stack_len_++] = last_char;
-      }
-      DecodeString(old_code);
-    } else {
-      DecodeString(code);
+    const size_t count =
+        std::min<size_t>(stack_len_, dest.size() - bytes_read);
+    for (size_t i = 0; i < count; ++i) {
+      dest[bytes_read++] = decode_span[--stack_len_];
     }
+  }
+  return bytes_read;
+}
 
-    FX_SAFE_UINT32 safe_required_size = dest_byte_pos_;
-    safe_required_size += stack_len_;
-    if (!safe_required_size.IsValid()) {
-      return false;
-    }
+void CLZWDecoder::DecodeNextCode() {
+  DCHECK_EQ(stack_len_, 0u);
+  if (src_bit_pos_ + code_len_ > src_span_.size() * 8) {
+    state_ = State::kDone;
+    return;
+  }
 
-    uint32_t required_size = safe_required_size.ValueOrDie();
-    if (required_size > dest_buf_.size()) {
-      if (!ExpandDestBuf(required_size - dest_buf_.size())) {
-        return false;
-      }
+  int byte_pos = src_bit_pos_ / 8;
+  int bit_pos = src_bit_pos_ % 8;
+  uint8_t bit_left = code_len_;
+  uint32_t code = 0;
+  if (bit_pos) {
+    bit_left -= 8 - bit_pos;
+    code = (src_span_[byte_pos++] & ((1 << (8 - bit_pos)) - 1)) << bit_left;
+  }
+  if (bit_left < 8) {
+    code |= src_span_[byte_pos] >> (8 - bit_left);
+  } else {
+    bit_left -= 8;
+    code |= src_span_[byte_pos++] << bit_left;
+    if (bit_left) {
+      code |= src_span_[byte_pos] >> (8 - bit_left);
     }
+  }
+  src_bit_pos_ += code_len_;
 
-    for (uint32_t i = 0; i < stack_len_; i++) {
-      dest_buf_[dest_byte_pos_ + i] = decode_span[stack_len_ - i - 1];
-    }
-    dest_byte_pos_ += stack_len_;
-    last_char = decode_span[stack_len_ - 1];
-    if (old_code >= 258 && old_code - 258 >= current_code_) {
-      break;
+  pdfium::span<uint8_t> decode_span = decode_stack_.span();
+  if (code < 256) {
+    decode_span[stack_len_++] = static_cast<uint8_t>(code);
+    last_char_ = static_cast<uint8_t>(code);
+    if (old_code_ != 0xFFFFFFFF) {
+      AddCode(old_code_, last_char_);
     }
-
-    AddCode(old_code, last_char);
-    old_code = code;
+    old_code_ = code;
+    return;
+  }
+  if (code == 256) {
+    code_len_ = 9;
+    current_code_ = 0;
+    old_code_ = 0xFFFFFFFF;
+    return;
+  }
+  if (code == 257) {
+    state_ = State::kDone;
+    return;
   }
-  return dest_byte_pos_ != 0;
-}
-
-uint8_t GetLeftValue(pdfium::span<const uint8_t> span,
-                     size_t i,
-                     uint32_t bytes_per_pixel) {
-  return i >= bytes_per_pixel ? span[i - bytes_per_pixel] : 0;
-}
 
-uint8_t GetUpValue(pdfium::span<const uint8_t> span, size_t i) {
-  return span.empty() ? 0 : span[i];
-}
+  // Case where |code| is 258 or greater.
+  if (old_code_ == 0xFFFFFFFF) {
+    state_ = State::kError;
+    return;
+  }
 
-uint8_t GetUpperLeftValue(pdfium::span<const uint8_t> span,
-                          size_t i,
-                          uint32_t bytes_per_pixel) {
-  if (i >= bytes_per_pixel && !span.empty()) {
-    return span[i - bytes_per_pixel];
+  DCHECK(old_code_ < 256 || old_code_ >= 258);
+  if (code - 258 >= current_code_) {
+    decode_span[stack_len_++] = last_char_;
+    DecodeString(old_code_);
+  } else {
+    DecodeString(code);
+  }
+  last_char_ = decode_span[stack_len_ - 1];
+  if (old_code_ >= 258 && old_code_ - 258 >= current_code_) {
+    state_ = State::kDone;
+    return;
   }
-  return 0;
+
+  AddCode(old_code_, last_char_);
+  old_code_ = code;
 }
 
 uint8_t PathPredictor(uint8_t a, uint8_t b, uint8_t c) {
@@ -337,6 +383,181 @@ uint8_t PathPredictor(uint8_t a, uint8_t b, uint8_t c) {
   return pb <= pc ? b : c;
 }
 
+#if defined(__SSE2__)
+// The SSE2 paths below work on one pixel at a time, and only for the common 3
+// and 4 bytes per pixel. Each step reads 4 bytes, so it needs a 4th byte past
+// a 3-byte pixel, and the last pixel of such rows is left to the scalar code.
+bool CanUnfilterPixels(uint32_t bytes_per_pixel) {
+  return bytes_per_pixel == 3 || bytes_per_pixel == 4;
+}
+
+UNSAFE_BUFFER_USAGE __m128i LoadPixel(const uint8_t* src) {
+  uint32_t value;
+  // SAFETY: callers ensure that 4 bytes are available at `src`.
+  UNSAFE_BUFFERS(FXSYS_memcpy(&value, src, sizeof(value)));
+  return _mm_cvtsi32_si128(static_cast<int>(value));
+}
+
+// Unlike LoadPixel(), only reads the `bytes_per_pixel` bytes of the pixel.
+__m128i LoadPartialPixel(pdfium::span<const uint8_t> span,
+                         uint32_t bytes_per_pixel) {
+  uint32_t value = 0;
+  fxcrt::Copy(span.first(bytes_per_pixel),
+              pdfium::byte_span_from_ref(value));
+  return _mm_cvtsi32_si128(static_cast<int>(value));
+}
+
+UNSAFE_BUFFER_USAGE void StorePixel(__m128i pixel,
+                                    uint32_t bytes_per_pixel,
+                                    uint8_t* dest) {
+  const uint32_t value = static_cast<uint32_t>(_mm_cvtsi128_si32(pixel));
+  // SAFETY: callers ensure that `bytes_per_pixel` bytes are available at
+  // `dest`. Spelling out both sizes allows for inlined copies.
+  UNSAFE_BUFFERS({
+    if (bytes_per_pixel == 4) {
+      FXSYS_memcpy(dest, &value, 4);
+    } else {
+      FXSYS_memcpy(dest, &value, 3);
+    }
+  });
+}
+
+__m128i Abs16(__m128i x) {
+  return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x));
+}
+
+__m128i Select(__m128i mask, __m128i if_true, __m128i if_false) {
+  return _mm_or_si128(_mm_and_si128(mask, if_true),
+                      _mm_andnot_si128(mask, if_false));
+}
+#endif  // defined(__SSE2__)
+
+// The Unfilter*() functions reverse one PNG filter type. `src` holds the
+// filtered bytes, and `dest` and `up` hold the current and the previous
+// unfiltered row, all of the same size.
+void UnfilterSub(pdfium::span<uint8_t> dest,
+                 pdfium::span<const uint8_t> src,
+                 uint32_t bytes_per_pixel) {
+  size_t i = std::min<size_t>(bytes_per_pixel, src.size());
+  fxcrt::Copy(src.first(i), dest);
+#if defined(__SSE2__)
+  if (CanUnfilterPixels(bytes_per_pixel) && i + 4 <= src.size()) {
+    __m128i left = LoadPartialPixel(dest, bytes_per_pixel);
+    // SAFETY: the loop condition ensures that 4 bytes remain at `i`.
+    UNSAFE_BUFFERS({
+      for (; i + 4 <= src.size(); i += bytes_per_pixel) {
+        left = _mm_add_epi8(left, LoadPixel(src.data() + i));
+        StorePixel(left, bytes_per_pixel, dest.data() + i);
+      }
+    });
+  }
+#endif
+  for (; i < src.size(); ++i) {
+    dest[i] = src[i] + dest[i - bytes_per_pixel];
+  }
+}
+
+void UnfilterUp(pdfium::span<uint8_t> dest,
+                pdfium::span<const uint8_t> src,
+                pdfium::span<const uint8_t> up) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= src.size(); i += 16) {
+    // SAFETY: all spans have the size of `src`, and the loop condition ensures
+    // 16 bytes remain at `i`.
+    UNSAFE_BUFFERS({
+      const __m128i x =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src.data() + i));
+      const __m128i b =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(up.data() + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dest.data() + i),
+                       _mm_add_epi8(x, b));
+    });
+  }
+#endif
+  for (; i < src.size(); ++i) {
+    dest[i] = src[i] + up[i];
+  }
+}
+
+void UnfilterAverage(pdfium::span<uint8_t> dest,
+                     pdfium::span<const uint8_t> src,
+                     pdfium::span<const uint8_t> up,
+                     uint32_t bytes_per_pixel) {
+  size_t i = 0;
+  for (; i < bytes_per_pixel && i < src.size(); ++i) {
+    dest[i] = src[i] + up[i] / 2;
+  }
+#if defined(__SSE2__)
+  if (CanUnfilterPixels(bytes_per_pixel) && i + 4 <= src.size()) {
+    const __m128i ones = _mm_set1_epi8(1);
+    __m128i left = LoadPartialPixel(dest, bytes_per_pixel);
+    // SAFETY: the loop condition ensures that 4 bytes remain at `i` in all
+    // spans.
+    UNSAFE_BUFFERS({
+      for (; i + 4 <= src.size(); i += bytes_per_pixel) {
+        const __m128i b = LoadPixel(up.data() + i);
+        // _mm_avg_epu8() rounds up, but the filter rounds down.
+        __m128i average = _mm_avg_epu8(left, b);
+        average = _mm_sub_epi8(
+            average, _mm_and_si128(_mm_xor_si128(left, b), ones));
+        left = _mm_add_epi8(LoadPixel(src.data() + i), average);
+        StorePixel(left, bytes_per_pixel, dest.data() + i);
+      }
+    });
+  }
+#endif
+  for (; i < src.size(); ++i) {
+    dest[i] = src[i] + (dest[i - bytes_per_pixel] + up[i]) / 2;
+  }
+}
+
+void UnfilterPaeth(pdfium::span<uint8_t> dest,
+                   pdfium::span<const uint8_t> src,
+                   pdfium::span<const uint8_t> up,
+                   uint32_t bytes_per_pixel) {
+  // With no left and upper left pixels, the predictor is the upper pixel.
+  size_t i = std::min<size_t>(bytes_per_pixel, src.size());
+  UnfilterUp(dest.first(i), src.first(i), up.first(i));
+#if defined(__SSE2__)
+  if (CanUnfilterPixels(bytes_per_pixel) && i + 4 <= src.size()) {
+    // Work on 16-bit lanes, so that the differences below do not overflow.
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a =
+        _mm_unpacklo_epi8(LoadPartialPixel(dest, bytes_per_pixel), zero);
+    __m128i c = _mm_unpacklo_epi8(LoadPartialPixel(up, bytes_per_pixel), zero);
+    // SAFETY: the loop condition ensures that 4 bytes remain at `i` in all
+    // spans.
+    UNSAFE_BUFFERS({
+      for (; i + 4 <= src.size(); i += bytes_per_pixel) {
+        const __m128i b = _mm_unpacklo_epi8(LoadPixel(up.data() + i), zero);
+        // With p = a + b - c, these are p - a, p - b and p - c.
+        __m128i pa = _mm_sub_epi16(b, c);
+        __m128i pb = _mm_sub_epi16(a, c);
+        __m128i pc = _mm_add_epi16(pa, pb);
+        pa = Abs16(pa);
+        pb = Abs16(pb);
+        pc = Abs16(pc);
+        const __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+        const __m128i predictor =
+            Select(_mm_cmpeq_epi16(smallest, pa), a,
+                   Select(_mm_cmpeq_epi16(smallest, pb), b, c));
+        // Adding bytes wraps like the scalar code, and keeps the upper byte of
+        // each lane zero.
+        a = _mm_add_epi8(_mm_unpacklo_epi8(LoadPixel(src.data() + i), zero),
+                         predictor);
+        StorePixel(_mm_packus_epi16(a, a), bytes_per_pixel, dest.data() + i);
+        c = b;
+      }
+    });
+  }
+#endif
+  for (; i < src.size(); ++i) {
+    dest[i] = src[i] + PathPredictor(dest[i - bytes_per_pixel], up[i],
+                                     up[i - bytes_per_pixel]);
+  }
+}
+
 void PNG_PredictLine(pdfium::span<uint8_t> dest_span,
                      pdfium::span<const uint8_t> src_span,
                      pdfium::span<const uint8_t> last_span,
@@ -345,37 +566,38 @@ void PNG_PredictLine(pdfium::span<uint8_t> dest_span,
   const uint8_t tag = src_span.front();
   pdfium::span<const uint8_t> remaining_src_span =
       src_span.subspan(1u, row_size);
+  dest_span = dest_span.first(remaining_src_span.size());
+
+  // An empty `last_span` stands for a row of zeros above the first row.
+  DataVector<uint8_t> zero_row;
+  if (last_span.empty() && (tag == 3 || tag == 4)) {
+    zero_row.resize(remaining_src_span.size());
+    last_span = zero_row;
+  }
   switch (tag) {
     case 1: {
-      for (size_t i = 0; i < remaining_src_span.size(); ++i) {
-        uint8_t left = GetLeftValue(dest_span, i, bytes_per_pixel);
-        dest_span[i] = remaining_src_span[i] + left;
-      }
+      UnfilterSub(dest_span, remaining_src_span, bytes_per_pixel);
       break;
     }
     case 2: {
-      for (size_t i = 0; i < remaining_src_span.size(); ++i) {
-        uint8_t up = GetUpValue(last_span, i);
-        dest_span[i] = remaining_src_span[i] + up;
+      if (last_span.empty()) {
+        fxcrt::Copy(remaining_src_span, dest_span);
+      } else {
+        UnfilterUp(dest_span, remaining_src_span,
+                   last_span.first(remaining_src_span.size()));
       }
       break;
     }
     case 3: {
-      for (size_t i = 0; i < remaining_src_span.size(); ++i) {
-        uint8_t left = GetLeftValue(dest_span, i, bytes_per_pixel);
-        uint8_t up = GetUpValue(last_span, i);
-        dest_span[i] = remaining_src_span[i] + (up + left) / 2;
-      }
+      UnfilterAverage(dest_span, remaining_src_span,
+                      last_span.first(remaining_src_span.size()),
+                      bytes_per_pixel);
       break;
     }
     case 4: {
-      for (size_t i = 0; i < remaining_src_span.size(); ++i) {
-        uint8_t left = GetLeftValue(dest_span, i, bytes_per_pixel);
-        uint8_t up = GetUpValue(last_span, i);
-        uint8_t upper_left = GetUpperLeftValue(last_span, i, bytes_per_pixel);
-        dest_span[i] =
-            remaining_src_span[i] + PathPredictor(left, up, upper_left);
-      }
+      UnfilterPaeth(dest_span, remaining_src_span,
+                    last_span.first(remaining_src_span.size()),
+                    bytes_per_pixel);
       break;
     }
     default: {
@@ -385,6 +607,23 @@ void PNG_PredictLine(pdfium::span<uint8_t> dest_span,
   }
 }
 
+// Returns the size of PNG predicted data that is `decoded_size` bytes once
+// the predictors are undone, which has a tag byte in front of each row, or 0
+// if unknown.
+uint32_t GetPngPredictedSize(int Colors,
+                             int BitsPerComponent,
+                             int Columns,
+                             uint32_t decoded_size) {
+  const uint32_t row_size =
+      fxge::CalculatePitch8(BitsPerComponent, Colors, Columns).value_or(0);
+  if (row_size == 0) {
+    return 0;
+  }
+  FX_SAFE_UINT32 predicted_size = decoded_size;
+  predicted_size += (decoded_size + row_size - 1) / row_size;
+  return predicted_size.ValueOrDefault(0);
+}
+
 std::optional<DataVector<uint8_t>> PNG_Predictor(
     int Colors,
     int BitsPerComponent,
@@ -486,16 +725,80 @@ bool TIFF_Predictor(int Colors,
   return true;
 }
 
+// Returns the most that `src_size` bytes of zlib data can decode to, as
+// deflate cannot compress better than about 1032:1.
+uint32_t GetMaxFlateUncompressedSize(size_t src_size) {
+  static constexpr uint32_t kMaxCompressionRatio = 1032;
+  FX_SAFE_UINT32 max_size = src_size;
+  max_size *= kMaxCompressionRatio;
+  const uint32_t result = max_size.ValueOrDefault(kMaxTotalOutSize);
+  return std::min(result, kMaxTotalOutSize);
+}
+
 uint32_t EstimateFlateUncompressBufferSize(uint32_t orig_size,
                                            size_t src_size) {
   static constexpr uint32_t kMaxInitialAllocSize = 10000000;
   uint32_t guess_size =
-      orig_size ? orig_size : pdfium::checked_cast<uint32_t>(src_size * 2);
+      orig_size ? std::min(orig_size, GetMaxFlateUncompressedSize(src_size))
+                : pdfium::checked_cast<uint32_t>(src_size * 2);
   return std::min(guess_size, kMaxInitialAllocSize);
 }
 
+#if defined(USE_SYSTEM_LIBDEFLATE)
+std::atomic<size_t> g_libdeflate_failure_count = 0;
+
+// For use with std::unique_ptr<libdeflate_decompressor>.
+struct LibdeflateDeleter {
+  inline void operator()(libdeflate_decompressor* decompressor) {
+    libdeflate_free_decompressor(decompressor);
+  }
+};
+
+// Decodes `src_buf` in one go with libdeflate, which is considerably faster
+// than zlib, but needs to know the decoded size up front. Returns nullopt when
+// the data does not decode to at most `orig_size` bytes, including when it is
+// damaged, so that zlib can recover as much of it as possible.
+std::optional<DataAndBytesConsumed> LibdeflateUncompress(
+    pdfium::span<const uint8_t> src_buf,
+    uint32_t orig_size) {
+  if (orig_size == 0 ||
+      orig_size > GetMaxFlateUncompressedSize(src_buf.size())) {
+    return std::nullopt;
+  }
+
+  std::unique_ptr<libdeflate_decompressor, LibdeflateDeleter> decompressor(
+      libdeflate_alloc_decompressor());
+  if (!decompressor) {
+    return std::nullopt;
+  }
+
+  DataVector<uint8_t> dest_buf(orig_size);
+  size_t bytes_consumed = 0;
+  size_t dest_size = 0;
+  if (libdeflate_zlib_decompress_ex(decompressor.get(), src_buf.data(),
+                                    src_buf.size(), dest_buf.data(),
+                                    dest_buf.size(), &bytes_consumed,
+                                    &dest_size) != LIBDEFLATE_SUCCESS) {
+    ++g_libdeflate_failure_count;
+    return std::nullopt;
+  }
+
+  dest_buf.resize(dest_size);
+  return DataAndBytesConsumed(std::move(dest_buf),
+                              pdfium::checked_cast<uint32_t>(bytes_consumed));
+}
+#endif  // defined(USE_SYSTEM_LIBDEFLATE)
+
 DataAndBytesConsumed FlateUncompress(pdfium::span<const uint8_t> src_buf,
                                      uint32_t orig_size) {
+#if defined(USE_SYSTEM_LIBDEFLATE)
+  std::optional<DataAndBytesConsumed> whole_buffer_result =
+      LibdeflateUncompress(src_buf, orig_size);
+  if (whole_buffer_result.has_value()) {
+    return std::move(whole_buffer_result.value());
+  }
+#endif
+
   std::unique_ptr<z_stream, FlateDeleter> context(FlateInit());
   if (!context) {
     return {DataVector<uint8_t>(), 0u};
@@ -559,14 +862,78 @@ static PredictorType GetPredictor(int predictor) {
   return PredictorType::kNone;
 }
 
-class FlateScanlineDecoder : public ScanlineDecoder {
+// Produces the decompressed bytes of a Flate or LZW stream on demand, so the
+// scanline decoders below never hold more than a row or two of output.
+class DecompressStream {
+ public:
+  virtual ~DecompressStream() = default;
+
+  [[nodiscard]] virtual bool Rewind() = 0;
+
+  // Fills all of `dest`, with zeros past the end of the data.
+  virtual void Read(pdfium::span<uint8_t> dest) = 0;
+
+  virtual uint32_t GetSrcOffset() = 0;
+};
+
+class FlateStream final : public DecompressStream {
+ public:
+  explicit FlateStream(pdfium::span<const uint8_t> src_span)
+      : src_buf_(src_span) {}
+  ~FlateStream() override = default;
+
+  // DecompressStream:
+  bool Rewind() override {
+    flate_.reset(FlateInit());
+    if (!flate_) {
+      return false;
+    }
+
+    FlateInput(flate_.get(), src_buf_);
+    return true;
+  }
+  void Read(pdfium::span<uint8_t> dest) override {
+    FlateOutput(flate_.get(), dest);
+  }
+  uint32_t GetSrcOffset() override {
+    return FlateGetPossiblyTruncatedTotalIn(flate_.get());
+  }
+
+ private:
+  std::unique_ptr<z_stream, FlateDeleter> flate_;
+  const pdfium::raw_span<const uint8_t> src_buf_;
+};
+
+class LZWStream final : public DecompressStream {
+ public:
+  LZWStream(pdfium::span<const uint8_t> src_span, bool early_change)
+      : src_buf_(src_span), early_change_(early_change) {}
+  ~LZWStream() override = default;
+
+  // DecompressStream:
+  bool Rewind() override {
+    lzw_ = std::make_unique<CLZWDecoder>(src_buf_, early_change_);
+    return true;
+  }
+  void Read(pdfium::span<uint8_t> dest) override {
+    std::ranges::fill(dest.subspan(lzw_->Read(dest)), 0);
+  }
+  uint32_t GetSrcOffset() override { return lzw_->GetSrcSize(); }
+
+ private:
+  std::unique_ptr<CLZWDecoder> lzw_;
+  const pdfium::raw_span<const uint8_t> src_buf_;
+  const bool early_change_;
+};
+
+class StreamScanlineDecoder : public ScanlineDecoder {
  public:
-  FlateScanlineDecoder(pdfium::span<const uint8_t> src_span,
-                       int width,
-                       int height,
-                       int nComps,
-                       int bpc);
-  ~FlateScanlineDecoder() override;
+  StreamScanlineDecoder(std::unique_ptr<DecompressStream> stream,
+                        int width,
+                        int height,
+                        int nComps,
+                        int bpc);
+  ~StreamScanlineDecoder() override;
 
   // ScanlineDecoder:
   [[nodiscard]] bool Rewind() override;
@@ -574,16 +941,16 @@ class FlateScanlineDecoder : public ScanlineDecoder {
   uint32_t GetSrcOffset() override;
 
  protected:
-  std::unique_ptr<z_stream, FlateDeleter> flate_;
-  const pdfium::raw_span<const uint8_t> src_buf_;
+  const std::unique_ptr<DecompressStream> stream_;
   FixedSizeDataVector<uint8_t> scanline_;
 };
 
-FlateScanlineDecoder::FlateScanlineDecoder(pdfium::span<const uint8_t> src_span,
-                                           int width,
-                                           int height,
-                                           int nComps,
-                                           int bpc)
+StreamScanlineDecoder::StreamScanlineDecoder(
+    std::unique_ptr<DecompressStream> stream,
+    int width,
+    int height,
+    int nComps,
+    int bpc)
     : ScanlineDecoder(width,
                       height,
                       width,
@@ -591,45 +958,39 @@ FlateScanlineDecoder::FlateScanlineDecoder(pdfium::span<const uint8_t> src_span,
                       nComps,
                       bpc,
                       fxge::CalculatePitch8OrDie(bpc, nComps, width)),
-      src_buf_(src_span),
+      stream_(std::move(stream)),
       scanline_(FixedSizeDataVector<uint8_t>::Zeroed(pitch_)) {}
 
-FlateScanlineDecoder::~FlateScanlineDecoder() {
+StreamScanlineDecoder::~StreamScanlineDecoder() {
   // Span in superclass can't outlive our buffer.
   last_scanline_ = pdfium::span<uint8_t>();
 }
 
-bool FlateScanlineDecoder::Rewind() {
-  flate_.reset(FlateInit());
-  if (!flate_) {
-    return false;
-  }
-
-  FlateInput(flate_.get(), src_buf_);
-  return true;
+bool StreamScanlineDecoder::Rewind() {
+  return stream_->Rewind();
 }
 
-pdfium::span<uint8_t> FlateScanlineDecoder::GetNextLine() {
-  FlateOutput(flate_.get(), scanline_);
+pdfium::span<uint8_t> StreamScanlineDecoder::GetNextLine() {
+  stream_->Read(scanline_);
   return scanline_;
 }
 
-uint32_t FlateScanlineDecoder::GetSrcOffset() {
-  return FlateGetPossiblyTruncatedTotalIn(flate_.get());
+uint32_t StreamScanlineDecoder::GetSrcOffset() {
+  return stream_->GetSrcOffset();
 }
 
-class FlatePredictorScanlineDecoder final : public FlateScanlineDecoder {
+class PredictorScanlineDecoder final : public StreamScanlineDecoder {
  public:
-  FlatePredictorScanlineDecoder(pdfium::span<const uint8_t> src_span,
-                                int width,
-                                int height,
-                                int comps,
-                                int bpc,
-                                PredictorType predictor,
-                                int Colors,
-                                int BitsPerComponent,
-                                int Columns);
-  ~FlatePredictorScanlineDecoder() override;
+  PredictorScanlineDecoder(std::unique_ptr<DecompressStream> stream,
+                           int width,
+                           int height,
+                           int comps,
+                           int bpc,
+                           PredictorType predictor,
+                           int Colors,
+                           int BitsPerComponent,
+                           int Columns);
+  ~PredictorScanlineDecoder() override;
 
   // ScanlineDecoder:
   bool Rewind() override;
@@ -651,8 +1012,8 @@ class FlatePredictorScanlineDecoder final : public FlateScanlineDecoder {
   FixedSizeDataVector<uint8_t> predict_raw_;
 };
 
-FlatePredictorScanlineDecoder::FlatePredictorScanlineDecoder(
-    pdfium::span<const uint8_t> src_span,
+PredictorScanlineDecoder::PredictorScanlineDecoder(
+    std::unique_ptr<DecompressStream> stream,
     int width,
     int height,
     int comps,
@@ -661,7 +1022,7 @@ FlatePredictorScanlineDecoder::FlatePredictorScanlineDecoder(
     int Colors,
     int BitsPerComponent,
     int Columns)
-    : FlateScanlineDecoder(src_span, width, height, comps, bpc),
+    : StreamScanlineDecoder(std::move(stream), width, height, comps, bpc),
       predictor_(predictor) {
   DCHECK(predictor_ != PredictorType::kNone);
   if (BitsPerComponent * Colors * Columns == 0) {
@@ -679,13 +1040,13 @@ FlatePredictorScanlineDecoder::FlatePredictorScanlineDecoder(
   predict_raw_ = FixedSizeDataVector<uint8_t>::Zeroed(predict_pitch_ + 1);
 }
 
-FlatePredictorScanlineDecoder::~FlatePredictorScanlineDecoder() {
+PredictorScanlineDecoder::~PredictorScanlineDecoder() {
   // Span in superclass can't outlive our buffer.
   last_scanline_ = pdfium::span<uint8_t>();
 }
 
-bool FlatePredictorScanlineDecoder::Rewind() {
-  if (!FlateScanlineDecoder::Rewind()) {
+bool PredictorScanlineDecoder::Rewind() {
+  if (!StreamScanlineDecoder::Rewind()) {
     return false;
   }
 
@@ -693,7 +1054,7 @@ bool FlatePredictorScanlineDecoder::Rewind() {
   return true;
 }
 
-pdfium::span<uint8_t> FlatePredictorScanlineDecoder::GetNextLine() {
+pdfium::span<uint8_t> PredictorScanlineDecoder::GetNextLine() {
   if (pitch_ == predict_pitch_) {
     GetNextLineWithPredictedPitch();
   } else {
@@ -702,20 +1063,20 @@ pdfium::span<uint8_t> FlatePredictorScanlineDecoder::GetNextLine() {
   return scanline_;
 }
 
-void FlatePredictorScanlineDecoder::GetNextLineWithPredictedPitch() {
+void PredictorScanlineDecoder::GetNextLineWithPredictedPitch() {
   switch (predictor_) {
     case PredictorType::kPng: {
       const uint32_t row_size =
           fxge::CalculatePitch8OrDie(bits_per_component_, colors_, columns_);
       const uint32_t bytes_per_pixel = (bits_per_component_ * colors_ + 7) / 8;
-      FlateOutput(flate_.get(), predict_raw_);
+      stream_->Read(predict_raw_);
       PNG_PredictLine(scanline_, predict_raw_, last_line_, row_size,
                       bytes_per_pixel);
       fxcrt::Copy(scanline_.first(predict_pitch_), last_line_.span());
       break;
     }
     case PredictorType::kFlate: {
-      FlateOutput(flate_.get(), scanline_);
+      stream_->Read(scanline_);
       TIFF_PredictLine(scanline_.first(predict_pitch_), bpc_, comps_,
                        output_width_);
       break;
@@ -726,7 +1087,7 @@ void FlatePredictorScanlineDecoder::GetNextLineWithPredictedPitch() {
   }
 }
 
-void FlatePredictorScanlineDecoder::GetNextLineWithoutPredictedPitch() {
+void PredictorScanlineDecoder::GetNextLineWithoutPredictedPitch() {
   size_t bytes_to_go = pitch_;
   size_t read_leftover = left_over_ > bytes_to_go ? bytes_to_go : left_over_;
   if (read_leftover) {
@@ -742,7 +1103,7 @@ void FlatePredictorScanlineDecoder::GetNextLineWithoutPredictedPitch() {
   switch (predictor_) {
     case PredictorType::kPng: {
       while (bytes_to_go) {
-        FlateOutput(flate_.get(), predict_raw_);
+        stream_->Read(predict_raw_);
         PNG_PredictLine(predict_buffer_, predict_raw_, last_line_, row_size,
                         bytes_per_pixel);
         fxcrt::Copy(predict_buffer_.span(), last_line_.span());
@@ -752,7 +1113,7 @@ void FlatePredictorScanlineDecoder::GetNextLineWithoutPredictedPitch() {
     }
     case PredictorType::kFlate: {
       while (bytes_to_go) {
-        FlateOutput(flate_.get(), predict_buffer_);
+        stream_->Read(predict_buffer_);
         TIFF_PredictLine(predict_buffer_, bits_per_component_, colors_,
                          columns_);
         bytes_to_go = CopyAndAdvanceLine(bytes_to_go);
@@ -765,7 +1126,7 @@ void FlatePredictorScanlineDecoder::GetNextLineWithoutPredictedPitch() {
   }
 }
 
-size_t FlatePredictorScanlineDecoder::CopyAndAdvanceLine(size_t bytes_to_go) {
+size_t PredictorScanlineDecoder::CopyAndAdvanceLine(size_t bytes_to_go) {
   size_t read_bytes = std::min<size_t>(predict_pitch_, bytes_to_go);
   fxcrt::Copy(predict_buffer_.first(read_bytes),
               scanline_.subspan(pitch_ - bytes_to_go));
@@ -773,6 +1134,26 @@ size_t FlatePredictorScanlineDecoder::CopyAndAdvanceLine(size_t bytes_to_go) {
   return bytes_to_go - read_bytes;
 }
 
+std::unique_ptr<ScanlineDecoder> CreateStreamDecoder(
+    std::unique_ptr<DecompressStream> stream,
+    int width,
+    int height,
+    int nComps,
+    int bpc,
+    int predictor,
+    int Colors,
+    int BitsPerComponent,
+    int Columns) {
+  PredictorType predictor_type = GetPredictor(predictor);
+  if (predictor_type == PredictorType::kNone) {
+    return std::make_unique<StreamScanlineDecoder>(std::move(stream), width,
+                                                   height, nComps, bpc);
+  }
+  return std::make_unique<PredictorScanlineDecoder>(
+      std::move(stream), width, height, nComps, bpc, predictor_type, Colors,
+      BitsPerComponent, Columns);
+}
+
 }  // namespace
 
 // static
@@ -786,14 +1167,26 @@ std::unique_ptr<ScanlineDecoder> FlateModule::CreateDecoder(
     int Colors,
     int BitsPerComponent,
     int Columns) {
-  PredictorType predictor_type = GetPredictor(predictor);
-  if (predictor_type == PredictorType::kNone) {
-    return std::make_unique<FlateScanlineDecoder>(src_span, width, height,
-                                                  nComps, bpc);
-  }
-  return std::make_unique<FlatePredictorScanlineDecoder>(
-      src_span, width, height, nComps, bpc, predictor_type, Colors,
-      BitsPerComponent, Columns);
+  return CreateStreamDecoder(std::make_unique<FlateStream>(src_span), width,
+                             height, nComps, bpc, predictor, Colors,
+                             BitsPerComponent, Columns);
+}
+
+// static
+std::unique_ptr<ScanlineDecoder> FlateModule::CreateLZWDecoder(
+    pdfium::span<const uint8_t> src_span,
+    int width,
+    int height,
+    int nComps,
+    int bpc,
+    bool bEarlyChange,
+    int predictor,
+    int Colors,
+    int BitsPerComponent,
+    int Columns) {
+  return CreateStreamDecoder(
+      std::make_unique<LZWStream>(src_span, bEarlyChange), width, height,
+      nComps, bpc, predictor, Colors, BitsPerComponent, Columns);
 }
 
 // static
@@ -819,6 +1212,10 @@ DataAndBytesConsumed FlateModule::FlateOrLZWDecode(
     dest_buf = decoder->TakeDestBuf();
     bytes_consumed = decoder->GetSrcSize();
   } else {
+    if (predictor_type == PredictorType::kPng) {
+      estimated_size = GetPngPredictedSize(Colors, BitsPerComponent, Columns,
+                                           estimated_size);
+    }
     DataAndBytesConsumed result = FlateUncompress(src_span, estimated_size);
     dest_buf = std::move(result.data);
     bytes_consumed = result.bytes_consumed;
@@ -843,15 +1240,25 @@ DataAndBytesConsumed FlateModule::FlateOrLZWDecode(
   }
 }
 
+#if defined(USE_SYSTEM_LIBDEFLATE)
+// static
+size_t FlateModule::GetLibdeflateFailureCountForTesting() {
+  return g_libdeflate_failure_count;
+}
+#endif
+
 // static
 DataVector<uint8_t> FlateModule::Encode(pdfium::span<const uint8_t> src_span) {
-  FX_SAFE_SIZE_T safe_dest_size = src_span.size();
-  safe_dest_size += src_span.size() / 1000;
-  safe_dest_size += 12;
-  DataVector<uint8_t> dest_buf(safe_dest_size.ValueOrDie());
-  size_t compressed_size = FlateCompress(src_span, dest_buf);
-  dest_buf.resize(compressed_size);
-  return dest_buf;
+  return Encode(src_span, EncodeOptions());
+}
+
+// static
+DataVector<uint8_t> FlateModule::Encode(pdfium::span<const uint8_t> src_span,
+                                        const EncodeOptions& options) {
+  CHECK_GE(options.level, Z_DEFAULT_COMPRESSION);
+  CHECK_LE(options.level, Z_BEST_COMPRESSION);
+  return FlateCompress(src_span, options.level,
+                       GetZlibStrategy(options.strategy));
 }
 
 }  // namespace fxcodec
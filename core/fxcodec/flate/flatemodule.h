@@ -7,6 +7,7 @@
 #ifndef CORE_FXCODEC_FLATE_FLATEMODULE_H_
 #define CORE_FXCODEC_FLATE_FLATEMODULE_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <memory>
@@ -21,6 +22,16 @@ class ScanlineDecoder;
 
 class FlateModule {
  public:
+  // Mirrors zlib's compression strategies.
+  enum class Strategy { kDefault, kFiltered, kHuffmanOnly, kRle };
+
+  struct EncodeOptions {
+    // From 0 for no compression to 9 for the smallest output, or -1 for
+    // zlib's default trade-off.
+    int level = -1;
+    Strategy strategy = Strategy::kDefault;
+  };
+
   static std::unique_ptr<ScanlineDecoder> CreateDecoder(
       pdfium::span<const uint8_t> src_span,
       int width,
@@ -32,6 +43,22 @@ class FlateModule {
       int BitsPerComponent,
       int Columns);
 
+  // Like CreateDecoder(), but for LZWDecode streams. Both decode the rows
+  // incrementally, without holding the whole decoded image.
+  static std::unique_ptr<ScanlineDecoder> CreateLZWDecoder(
+      pdfium::span<const uint8_t> src_span,
+      int width,
+      int height,
+      int nComps,
+      int bpc,
+      bool bEarlyChange,
+      int predictor,
+      int Colors,
+      int BitsPerComponent,
+      int Columns);
+
+  // `estimated_size` is the expected size of the output, after undoing
+  // `predictor`, or 0 if unknown.
   static DataAndBytesConsumed FlateOrLZWDecode(
       bool bLZW,
       pdfium::span<const uint8_t> src_span,
@@ -42,7 +69,16 @@ class FlateModule {
       int Columns,
       uint32_t estimated_size);
 
+  // Compresses with the default options.
   static DataVector<uint8_t> Encode(pdfium::span<const uint8_t> src_span);
+  static DataVector<uint8_t> Encode(pdfium::span<const uint8_t> src_span,
+                                    const EncodeOptions& options);
+
+#if defined(USE_SYSTEM_LIBDEFLATE)
+  // Returns how many times libdeflate failed to decode a stream, which then
+  // had to be decoded again with zlib.
+  static size_t GetLibdeflateFailureCountForTesting();
+#endif
 
   FlateModule() = delete;
   FlateModule(const FlateModule&) = delete;
@@ -4,10 +4,25 @@
 
 #include "core/fxcodec/flate/flatemodule.h"
 
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "build/build_config.h"
 #include "core/fxcodec/data_and_bytes_consumed.h"
+#include "core/fxcodec/scanlinedecoder.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "testing/test_support.h"
+#include "testing/utils/benchmark_timer.h"
 
 using testing::ElementsAreArray;
 
@@ -72,3 +87,486 @@ TEST(FlateModule, Encode) {
     ++i;
   }
 }
+
+TEST(FlateModule, EncodeWithOptions) {
+  std::string content;
+  for (int i = 0; i < 200; ++i) {
+    content += "0 0 " + std::to_string(i) + " 10 re f\n";
+  }
+  const pdfium::span<const uint8_t> input = pdfium::as_byte_span(content);
+  EXPECT_EQ(FlateModule::Encode(input),
+            FlateModule::Encode(input, FlateModule::EncodeOptions()));
+
+  static constexpr FlateModule::Strategy kStrategies[] = {
+      FlateModule::Strategy::kDefault, FlateModule::Strategy::kFiltered,
+      FlateModule::Strategy::kHuffmanOnly, FlateModule::Strategy::kRle};
+  for (FlateModule::Strategy strategy : kStrategies) {
+    for (int level = -1; level <= 9; ++level) {
+      FlateModule::EncodeOptions options;
+      options.level = level;
+      options.strategy = strategy;
+      DataVector<uint8_t> encoded = FlateModule::Encode(input, options);
+      if (level == 0) {
+        EXPECT_GT(encoded.size(), input.size());
+      } else {
+        EXPECT_LT(encoded.size(), input.size());
+      }
+      DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+          /*bLZW=*/false, encoded, /*bEarlyChange=*/false, /*predictor=*/0,
+          /*Colors=*/0, /*BitsPerComponent=*/0, /*Columns=*/0,
+          /*estimated_size=*/0);
+      EXPECT_EQ(encoded.size(), result.bytes_consumed);
+      EXPECT_THAT(result.data, ElementsAreArray(input))
+          << static_cast<int>(strategy) << " " << level;
+    }
+  }
+}
+
+namespace {
+
+struct PredictorTestImage {
+  int colors;
+  int bits_per_component;
+  int columns;
+  int rows;
+};
+
+size_t GetRowSize(const PredictorTestImage& image) {
+  return (image.colors * image.bits_per_component * image.columns + 7) / 8;
+}
+
+size_t GetBytesPerPixel(const PredictorTestImage& image) {
+  return (image.colors * image.bits_per_component + 7) / 8;
+}
+
+uint8_t PaethPredictor(uint8_t a, uint8_t b, uint8_t c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) {
+    return a;
+  }
+  return pb <= pc ? b : c;
+}
+
+// Returns the PNG predictor for `filter` at `i` in `row`, with `up` as the
+// row above.
+uint8_t Predict(int filter,
+                const std::vector<uint8_t>& row,
+                const std::vector<uint8_t>& up,
+                size_t i,
+                size_t bytes_per_pixel) {
+  const uint8_t a = i >= bytes_per_pixel ? row[i - bytes_per_pixel] : 0;
+  const uint8_t b = up[i];
+  const uint8_t c = i >= bytes_per_pixel ? up[i - bytes_per_pixel] : 0;
+  switch (filter) {
+    case 1:
+      return a;
+    case 2:
+      return b;
+    case 3:
+      return (a + b) / 2;
+    case 4:
+      return PaethPredictor(a, b, c);
+    default:
+      return 0;
+  }
+}
+
+// Returns `image` sized pixel data, and the same data filtered with PNG
+// predictors, cycling through the filter types from row to row starting with
+// `first_filter`.
+std::pair<std::vector<uint8_t>, std::vector<uint8_t>> CreatePredictedImage(
+    const PredictorTestImage& image,
+    int first_filter) {
+  const size_t row_size = GetRowSize(image);
+  const size_t bytes_per_pixel = GetBytesPerPixel(image);
+  std::vector<uint8_t> pixels;
+  std::vector<uint8_t> filtered;
+  std::vector<uint8_t> up(row_size);
+  uint32_t state = 1;
+  for (int y = 0; y < image.rows; ++y) {
+    std::vector<uint8_t> row(row_size);
+    for (size_t i = 0; i < row_size; ++i) {
+      // Smooth gradients with some noise, like a typical photo.
+      state = state * 1103515245 + 12345;
+      row[i] = static_cast<uint8_t>(y * 3 + i + ((state >> 16) % 16));
+    }
+    const int filter = (first_filter + y) % 5;
+    filtered.push_back(static_cast<uint8_t>(filter));
+    for (size_t i = 0; i < row_size; ++i) {
+      filtered.push_back(
+          static_cast<uint8_t>(row[i] - Predict(filter, row, up, i,
+                                                bytes_per_pixel)));
+    }
+    pixels.insert(pixels.end(), row.begin(), row.end());
+    up = std::move(row);
+  }
+  return {std::move(pixels), std::move(filtered)};
+}
+
+// Returns `pixels` of `image` filtered with the TIFF predictor, for 8 bits per
+// component.
+std::vector<uint8_t> CreateTiffPredictedImage(const PredictorTestImage& image,
+                                              std::vector<uint8_t> pixels) {
+  const size_t row_size = GetRowSize(image);
+  const size_t bytes_per_pixel = GetBytesPerPixel(image);
+  for (size_t row = 0; row < pixels.size(); row += row_size) {
+    for (size_t i = row_size - 1; i >= bytes_per_pixel; --i) {
+      pixels[row + i] -= pixels[row + i - bytes_per_pixel];
+    }
+  }
+  return pixels;
+}
+
+// A minimal LZWDecode encoder, which tracks the code width the same way as
+// the decoder, and starts over with a clear code before the table fills up.
+class TestLZWEncoder {
+ public:
+  explicit TestLZWEncoder(bool early_change) : early_change_(early_change) {}
+
+  std::vector<uint8_t> Encode(const std::vector<uint8_t>& data) {
+    std::map<std::pair<uint32_t, uint8_t>, uint32_t> table;
+    uint32_t next_code = 258;
+    uint32_t prefix = kNoCode;
+    for (uint8_t c : data) {
+      if (prefix == kNoCode) {
+        prefix = c;
+        continue;
+      }
+      auto it = table.find({prefix, c});
+      if (it != table.end()) {
+        prefix = it->second;
+        continue;
+      }
+      Emit(prefix);
+      if (next_code == 4093) {
+        Emit(256);
+        table.clear();
+        next_code = 258;
+      } else {
+        table[{prefix, c}] = next_code++;
+      }
+      prefix = c;
+    }
+    if (prefix != kNoCode) {
+      Emit(prefix);
+    }
+    Emit(257);
+    if (bit_count_) {
+      result_.push_back(static_cast<uint8_t>(bits_ << (8 - bit_count_)));
+    }
+    return std::move(result_);
+  }
+
+ private:
+  static constexpr uint32_t kNoCode = 0xffffffff;
+
+  void Emit(uint32_t code) {
+    bits_ = (bits_ << code_len_) | code;
+    bit_count_ += code_len_;
+    while (bit_count_ >= 8) {
+      bit_count_ -= 8;
+      result_.push_back(static_cast<uint8_t>(bits_ >> bit_count_));
+    }
+    if (code == 256) {
+      code_len_ = 9;
+      decoder_codes_ = 0;
+      first_code_ = true;
+      return;
+    }
+    // The decoder adds a code for each code after the first one.
+    if (!first_code_) {
+      ++decoder_codes_;
+      const uint32_t limit = decoder_codes_ + 258 + (early_change_ ? 1 : 0);
+      if (limit == 512) {
+        code_len_ = 10;
+      } else if (limit == 1024) {
+        code_len_ = 11;
+      } else if (limit == 2048) {
+        code_len_ = 12;
+      }
+    }
+    first_code_ = false;
+  }
+
+  const bool early_change_;
+  bool first_code_ = true;
+  uint32_t code_len_ = 9;
+  uint32_t decoder_codes_ = 0;
+  uint32_t bits_ = 0;
+  uint32_t bit_count_ = 0;
+  std::vector<uint8_t> result_;
+};
+
+#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
+// Returns the value of `field` in /proc/self/status, such as "VmRSS", in KiB,
+// or 0 if it is missing.
+size_t GetProcStatusKiB(std::string_view field) {
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.size() > field.size() && line.starts_with(field) &&
+        line[field.size()] == ':') {
+      return strtoul(line.substr(field.size() + 1).c_str(), nullptr, 10);
+    }
+  }
+  return 0;
+}
+
+// Resets the peak resident set size, "VmHWM", to the current one. Returns
+// whether the kernel allowed it.
+bool ResetPeakRss() {
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.close();
+  return !clear_refs.fail();
+}
+#endif  // BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
+
+}  // namespace
+
+TEST(FlateModule, DecodePngPredictors) {
+  static constexpr PredictorTestImage kImages[] = {
+      {1, 8, 19, 10}, {2, 8, 19, 10}, {3, 8, 19, 10}, {4, 8, 19, 10},
+      {3, 16, 7, 10}, {1, 1, 37, 10}, {3, 8, 1, 10},  {4, 8, 2, 10},
+  };
+  for (const PredictorTestImage& image : kImages) {
+    for (int first_filter = 0; first_filter < 5; ++first_filter) {
+      auto [pixels, filtered] = CreatePredictedImage(image, first_filter);
+      DataVector<uint8_t> encoded = FlateModule::Encode(filtered);
+      DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+          /*bLZW=*/false, encoded, /*bEarlyChange=*/false, /*predictor=*/15,
+          image.colors, image.bits_per_component, image.columns,
+          /*estimated_size=*/0);
+      EXPECT_EQ(encoded.size(), result.bytes_consumed);
+      EXPECT_THAT(result.data, ElementsAreArray(pixels))
+          << image.colors << " " << image.bits_per_component << " "
+          << first_filter;
+    }
+  }
+}
+
+TEST(FlateModule, DecodePngPredictorsTruncated) {
+  static constexpr PredictorTestImage kImage = {3, 8, 20, 4};
+  auto [pixels, filtered] = CreatePredictedImage(kImage, /*first_filter=*/1);
+  // Cut the last row, which uses the Paeth predictor, short.
+  filtered.resize(filtered.size() - 10);
+  pixels.resize(pixels.size() - 10);
+  DataVector<uint8_t> encoded = FlateModule::Encode(filtered);
+  DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+      /*bLZW=*/false, encoded, /*bEarlyChange=*/false, /*predictor=*/15,
+      kImage.colors, kImage.bits_per_component, kImage.columns,
+      /*estimated_size=*/0);
+  EXPECT_THAT(result.data, ElementsAreArray(pixels));
+}
+
+TEST(FlateModule, DecodePngPredictorsWithEstimatedSize) {
+  static constexpr PredictorTestImage kImage = {3, 8, 100, 20};
+  auto [pixels, filtered] = CreatePredictedImage(kImage, /*first_filter=*/0);
+  DataVector<uint8_t> encoded = FlateModule::Encode(filtered);
+#if defined(USE_SYSTEM_LIBDEFLATE)
+  const size_t failure_count =
+      FlateModule::GetLibdeflateFailureCountForTesting();
+#endif
+  // The estimated size does not include the tag byte in front of each row.
+  DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+      /*bLZW=*/false, encoded, /*bEarlyChange=*/false, /*predictor=*/15,
+      kImage.colors, kImage.bits_per_component, kImage.columns,
+      /*estimated_size=*/pixels.size());
+  EXPECT_EQ(encoded.size(), result.bytes_consumed);
+  EXPECT_THAT(result.data, ElementsAreArray(pixels));
+#if defined(USE_SYSTEM_LIBDEFLATE)
+  // Decoded by libdeflate on the first attempt, without going back to zlib.
+  EXPECT_EQ(failure_count, FlateModule::GetLibdeflateFailureCountForTesting());
+#endif
+}
+
+TEST(FlateModule, ScanlineDecoderPngPredictors) {
+  static constexpr PredictorTestImage kImages[] = {
+      {1, 8, 19, 10}, {3, 8, 19, 10}, {4, 8, 19, 10}, {3, 16, 7, 10}};
+  for (const PredictorTestImage& image : kImages) {
+    auto [pixels, filtered] = CreatePredictedImage(image, /*first_filter=*/0);
+    DataVector<uint8_t> encoded = FlateModule::Encode(filtered);
+    std::unique_ptr<ScanlineDecoder> decoder = FlateModule::CreateDecoder(
+        encoded, image.columns, image.rows, image.colors,
+        image.bits_per_component, /*predictor=*/15, image.colors,
+        image.bits_per_component, image.columns);
+    ASSERT_TRUE(decoder);
+    const size_t row_size = GetRowSize(image);
+    for (int y = 0; y < image.rows; ++y) {
+      pdfium::span<const uint8_t> scanline = decoder->GetScanline(y);
+      ASSERT_EQ(row_size, scanline.size());
+      EXPECT_THAT(scanline, ElementsAreArray(pdfium::span(pixels).subspan(
+                                y * row_size, row_size)))
+          << image.colors << " " << image.bits_per_component << " " << y;
+    }
+  }
+}
+
+TEST(FlateModule, LZWScanlineDecoder) {
+  static constexpr PredictorTestImage kImage = {3, 8, 150, 50};
+  const size_t row_size = GetRowSize(kImage);
+  auto [pixels, png_filtered] =
+      CreatePredictedImage(kImage, /*first_filter=*/0);
+  const struct {
+    int predictor;
+    std::vector<uint8_t> data;
+  } kCases[] = {
+      {0, pixels},
+      {2, CreateTiffPredictedImage(kImage, pixels)},
+      {15, png_filtered},
+  };
+  for (const auto& test_case : kCases) {
+    for (bool early_change : {false, true}) {
+      SCOPED_TRACE(testing::Message()
+                   << test_case.predictor << " " << early_change);
+      const std::vector<uint8_t> encoded =
+          TestLZWEncoder(early_change).Encode(test_case.data);
+
+      DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+          /*bLZW=*/true, encoded, early_change, test_case.predictor,
+          kImage.colors, kImage.bits_per_component, kImage.columns,
+          /*estimated_size=*/0);
+      EXPECT_EQ(encoded.size(), result.bytes_consumed);
+      EXPECT_THAT(result.data, ElementsAreArray(pixels));
+
+      std::unique_ptr<ScanlineDecoder> decoder = FlateModule::CreateLZWDecoder(
+          encoded, kImage.columns, kImage.rows, kImage.colors,
+          kImage.bits_per_component, early_change, test_case.predictor,
+          kImage.colors, kImage.bits_per_component, kImage.columns);
+      ASSERT_TRUE(decoder);
+      for (int y = 0; y < kImage.rows; ++y) {
+        pdfium::span<const uint8_t> scanline = decoder->GetScanline(y);
+        ASSERT_EQ(row_size, scanline.size());
+        EXPECT_THAT(scanline, ElementsAreArray(pdfium::span(pixels).subspan(
+                                  y * row_size, row_size)))
+            << y;
+      }
+
+      // Going back rewinds the decoder.
+      EXPECT_THAT(decoder->GetScanline(1),
+                  ElementsAreArray(pdfium::span(pixels).subspan(row_size,
+                                                                row_size)));
+    }
+  }
+}
+
+TEST(FlateModule, LZWScanlineDecoderTruncated) {
+  static constexpr PredictorTestImage kImage = {1, 8, 40, 10};
+  const size_t row_size = GetRowSize(kImage);
+  auto [pixels, filtered] = CreatePredictedImage(kImage, /*first_filter=*/0);
+  std::vector<uint8_t> encoded =
+      TestLZWEncoder(/*early_change=*/true).Encode(pixels);
+  encoded.resize(encoded.size() / 2);
+  DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+      /*bLZW=*/true, encoded, /*bEarlyChange=*/true, /*predictor=*/0,
+      kImage.colors, kImage.bits_per_component, kImage.columns,
+      /*estimated_size=*/0);
+  ASSERT_LT(result.data.size(), pixels.size());
+
+  // Rows past the end of the data are zero filled.
+  std::vector<uint8_t> expected(result.data.begin(), result.data.end());
+  expected.resize(pixels.size());
+  std::unique_ptr<ScanlineDecoder> decoder = FlateModule::CreateLZWDecoder(
+      encoded, kImage.columns, kImage.rows, kImage.colors,
+      kImage.bits_per_component, /*bEarlyChange=*/true, /*predictor=*/0,
+      kImage.colors, kImage.bits_per_component, kImage.columns);
+  ASSERT_TRUE(decoder);
+  for (int y = 0; y < kImage.rows; ++y) {
+    EXPECT_THAT(decoder->GetScanline(y),
+                ElementsAreArray(pdfium::span(expected).subspan(
+                    y * row_size, row_size)))
+        << y;
+  }
+}
+
+// Not run by default. Use --gtest_also_run_disabled_tests to time decoding a
+// large content stream and a large image with PNG predictors, with and
+// without knowing the decoded size up front.
+TEST(FlateModule, DISABLED_DecodeBenchmark) {
+  static constexpr int kIterations = 10;
+
+  std::vector<uint8_t> content;
+  for (int i = 0; content.size() < 8 * 1024 * 1024; ++i) {
+    std::string op = "q 1 0 0 1 " + std::to_string(i % 612) + " " +
+                     std::to_string(i % 792) +
+                     " cm BT /F1 12 Tf (Lorem ipsum dolor sit amet) Tj ET Q\n";
+    content.insert(content.end(), op.begin(), op.end());
+  }
+  static constexpr PredictorTestImage kImage = {3, 8, 2550, 3300};
+  auto [pixels, filtered] = CreatePredictedImage(kImage, /*first_filter=*/0);
+
+  const struct {
+    const char* name;
+    DataVector<uint8_t> encoded;
+    size_t decoded_size;
+    int predictor;
+  } streams[] = {
+      {"content", FlateModule::Encode(content), content.size(), 0},
+      {"image", FlateModule::Encode(filtered), pixels.size(), 15},
+  };
+  for (const auto& stream : streams) {
+    for (uint32_t estimated_size :
+         {0u, static_cast<uint32_t>(stream.decoded_size)}) {
+      ScopedBenchmarkTimer timer(std::string(stream.name) +
+                                     ", estimated size " +
+                                     std::to_string(estimated_size),
+                                 kIterations);
+      for (int i = 0; i < kIterations; ++i) {
+        DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+            /*bLZW=*/false, stream.encoded, /*bEarlyChange=*/false,
+            stream.predictor, kImage.colors, kImage.bits_per_component,
+            kImage.columns, estimated_size);
+        ASSERT_FALSE(result.data.empty());
+      }
+    }
+  }
+}
+
+#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
+// Not run by default. Use --gtest_also_run_disabled_tests to compare how far
+// decoding a large LZW image raises the peak resident set size, when decoding
+// it all at once and when decoding it one row at a time.
+TEST(FlateModule, DISABLED_LZWDecodePeakMemory) {
+  static constexpr PredictorTestImage kImage = {3, 8, 2550, 3300};
+  const size_t row_size = GetRowSize(kImage);
+  std::vector<uint8_t> encoded;
+  {
+    auto [pixels, filtered] = CreatePredictedImage(kImage, /*first_filter=*/0);
+    encoded = TestLZWEncoder(/*early_change=*/true).Encode(pixels);
+  }
+
+  if (!ResetPeakRss()) {
+    GTEST_SKIP() << "Cannot reset the peak resident set size";
+  }
+  // Decode one row at a time first, as memory freed after decoding the whole
+  // image may stay with the process and hide later growth.
+  size_t rss = GetProcStatusKiB("VmRSS");
+  {
+    std::unique_ptr<ScanlineDecoder> decoder = FlateModule::CreateLZWDecoder(
+        encoded, kImage.columns, kImage.rows, kImage.colors,
+        kImage.bits_per_component, /*bEarlyChange=*/true, /*predictor=*/0,
+        kImage.colors, kImage.bits_per_component, kImage.columns);
+    ASSERT_TRUE(decoder);
+    for (int y = 0; y < kImage.rows; ++y) {
+      ASSERT_EQ(row_size, decoder->GetScanline(y).size()) << y;
+    }
+  }
+  printf("row at a time: peak RSS %zu KiB above the %zu KiB before decoding\n",
+         GetProcStatusKiB("VmHWM") - rss, rss);
+
+  ASSERT_TRUE(ResetPeakRss());
+  rss = GetProcStatusKiB("VmRSS");
+  {
+    DataAndBytesConsumed result = FlateModule::FlateOrLZWDecode(
+        /*bLZW=*/true, encoded, /*bEarlyChange=*/true, /*predictor=*/0,
+        kImage.colors, kImage.bits_per_component, kImage.columns,
+        /*estimated_size=*/0);
+    ASSERT_EQ(row_size * kImage.rows, result.data.size());
+  }
+  printf("whole image: peak RSS %zu KiB above the %zu KiB before decoding\n",
+         GetProcStatusKiB("VmHWM") - rss, rss);
+}
+#endif  // BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS)
@@ -15,6 +15,7 @@
 #include "core/fxcrt/notreached.h"
 #include "core/fxcrt/numerics/safe_conversions.h"
 #include "core/fxcrt/ptr_util.h"
+#include "core/fxcrt/span_util.h"
 
 namespace fxcodec {
 
@@ -46,7 +47,17 @@ IccTransform::IccTransform(cmsHTRANSFORM hTransform,
     : transform_(hTransform),
       src_components_(srcComponents),
       lab_(bIsLab),
-      normal_(bNormal) {}
+      normal_(bNormal) {
+  if (src_components_ == 1 && !lab_) {
+    DataVector<uint8_t> inputs(256);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      inputs[i] = static_cast<uint8_t>(i);
+    }
+    gray_table_.resize(inputs.size() * 3);
+    cmsDoTransform(transform_, inputs.data(), gray_table_.data(),
+                   pdfium::checked_cast<cmsUInt32Number>(inputs.size()));
+  }
+}
 
 IccTransform::~IccTransform() {
   cmsDeleteTransform(transform_);
@@ -96,9 +107,12 @@ std::unique_ptr<IccTransform> IccTransform::CreateTransformSRGB(
   cmsHTRANSFORM hTransform = nullptr;
   switch (dstCS) {
     case cmsSigRgbData:
-      hTransform =
-          cmsCreateTransform(srcProfile.get(), srcFormat, dstProfile.get(),
-                             TYPE_BGR_8, INTENT_PERCEPTUAL, /*dwFlags=*/0);
+      // Without its cache of the last translated color, which every call
+      // would update, lcms allows using a transform on several threads at
+      // once. The results are the same.
+      hTransform = cmsCreateTransform(srcProfile.get(), srcFormat,
+                                      dstProfile.get(), TYPE_BGR_8,
+                                      INTENT_PERCEPTUAL, cmsFLAGS_NOCACHE);
       break;
     case cmsSigGrayData:
     case cmsSigCmykData:
@@ -145,6 +159,16 @@ void IccTransform::Translate(pdfium::span<const float> pSrcValues,
 void IccTransform::TranslateScanline(pdfium::span<uint8_t> pDest,
                                      pdfium::span<const uint8_t> pSrc,
                                      int32_t pixels) {
+  if (!gray_table_.empty()) {
+    const size_t count = pdfium::checked_cast<size_t>(pixels);
+    pSrc = pSrc.first(count);
+    pDest = pDest.first(count * 3);
+    for (size_t i = 0; i < count; ++i) {
+      fxcrt::spancpy(pDest.subspan(i * 3),
+                     pdfium::span(gray_table_).subspan(pSrc[i] * 3u, 3u));
+    }
+    return;
+  }
   cmsDoTransform(transform_, pSrc.data(), pDest.data(), pixels);
 }
 
@@ -12,6 +12,7 @@
 #include <memory>
 
 #include "core/fxcodec/fx_codec_def.h"
+#include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/span.h"
 
 #if defined(USE_SYSTEM_LCMS2)
@@ -22,6 +23,8 @@
 
 namespace fxcodec {
 
+// Translates colors from an ICC profile to sRGB. Translate() and
+// TranslateScanline() may be called on several threads at once.
 class IccTransform {
  public:
   static std::unique_ptr<IccTransform> CreateTransformSRGB(
@@ -50,6 +53,9 @@ class IccTransform {
   const int src_components_;
   const bool lab_;
   const bool normal_;
+  // With only 256 possible inputs, 1-component profiles translate scanlines
+  // by table lookup. Holds the 3 output bytes for each input byte.
+  DataVector<uint8_t> gray_table_;
 };
 
 }  // namespace fxcodec
@@ -0,0 +1,97 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/icc/icc_transform_cache.h"
+
+#include <utility>
+
+#include "core/fxcodec/icc/icc_transform.h"
+#include "core/fxcrt/check.h"
+
+namespace fxcodec {
+
+namespace {
+
+IccTransformCache* g_icc_transform_cache = nullptr;
+
+}  // namespace
+
+IccTransformCache::Entry::Entry(DataVector<uint8_t> digest,
+                                std::shared_ptr<IccTransform> transform)
+    : digest(std::move(digest)), transform(std::move(transform)) {}
+
+IccTransformCache::Entry::~Entry() = default;
+
+// static
+void IccTransformCache::InitializeGlobals() {
+  CHECK(!g_icc_transform_cache);
+  g_icc_transform_cache = new IccTransformCache();
+}
+
+// static
+void IccTransformCache::DestroyGlobals() {
+  delete g_icc_transform_cache;
+  g_icc_transform_cache = nullptr;
+}
+
+// static
+IccTransformCache* IccTransformCache::GetInstance() {
+  return g_icc_transform_cache;
+}
+
+IccTransformCache::IccTransformCache(size_t max_entries)
+    : max_entries_(max_entries) {}
+
+IccTransformCache::~IccTransformCache() = default;
+
+std::shared_ptr<IccTransform> IccTransformCache::GetTransform(
+    pdfium::span<const uint8_t> digest,
+    pdfium::span<const uint8_t> profile) {
+  DataVector<uint8_t> key(digest.begin(), digest.end());
+  // Holding the lock while creating a transform keeps threads that want the
+  // same profile from creating it more than once.
+  std::lock_guard<std::mutex> guard(lock_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    ++stats_.hits;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->transform;
+  }
+
+  ++stats_.misses;
+  std::shared_ptr<IccTransform> transform =
+      IccTransform::CreateTransformSRGB(profile);
+  if (max_entries_ == 0) {
+    return transform;
+  }
+  EvictUntilFits(max_entries_ - 1);
+  entries_.emplace_front(key, transform);
+  index_[std::move(key)] = entries_.begin();
+  ++stats_.entries;
+  return transform;
+}
+
+void IccTransformCache::SetMaxEntries(size_t max_entries) {
+  std::lock_guard<std::mutex> guard(lock_);
+  max_entries_ = max_entries;
+  EvictUntilFits(max_entries_);
+}
+
+IccTransformCache::Stats IccTransformCache::GetStats() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return stats_;
+}
+
+void IccTransformCache::EvictUntilFits(size_t max_entries) {
+  while (stats_.entries > max_entries) {
+    DCHECK(!entries_.empty());
+    // Documents still using the transform keep it alive.
+    index_.erase(entries_.back().digest);
+    entries_.pop_back();
+    --stats_.entries;
+    ++stats_.evictions;
+  }
+}
+
+}  // namespace fxcodec
@@ -0,0 +1,85 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FXCODEC_ICC_ICC_TRANSFORM_CACHE_H_
+#define CORE_FXCODEC_ICC_ICC_TRANSFORM_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "core/fxcrt/data_vector.h"
+#include "core/fxcrt/span.h"
+
+namespace fxcodec {
+
+class IccTransform;
+
+// Process-wide least recently used (LRU) cache of ICC profile to sRGB
+// transforms, keyed by a digest of the profile data. A handful of profiles,
+// such as sRGB IEC61966-2.1 and U.S. Web Coated (SWOP), are embedded in a
+// large share of all documents, and building their lcms transforms, which
+// includes precomputing the 8-bit lookup tables lcms interpolates in, costs
+// far more than using them. With the cache, each such profile is only built
+// once, however many documents use it.
+//
+// The cache is thread-safe, as are the transforms it hands out.
+class IccTransformCache {
+ public:
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t entries = 0;
+  };
+
+  static constexpr size_t kDefaultMaxEntries = 16;
+
+  static void InitializeGlobals();
+  static void DestroyGlobals();
+
+  // Returns nullptr before InitializeGlobals() and after DestroyGlobals().
+  static IccTransformCache* GetInstance();
+
+  explicit IccTransformCache(size_t max_entries = kDefaultMaxEntries);
+  ~IccTransformCache();
+
+  // Returns the transform for `profile`, whose digest is `digest`, creating
+  // it on first use. Returns nullptr if `profile` is not usable, which is
+  // remembered as well.
+  std::shared_ptr<IccTransform> GetTransform(
+      pdfium::span<const uint8_t> digest,
+      pdfium::span<const uint8_t> profile);
+
+  // Evicts transforms until at most `max_entries` remain.
+  void SetMaxEntries(size_t max_entries);
+
+  Stats GetStats() const;
+
+ private:
+  struct Entry {
+    Entry(DataVector<uint8_t> digest, std::shared_ptr<IccTransform> transform);
+    ~Entry();
+
+    const DataVector<uint8_t> digest;
+    const std::shared_ptr<IccTransform> transform;
+  };
+
+  void EvictUntilFits(size_t max_entries);
+
+  mutable std::mutex lock_;
+  size_t max_entries_;
+  Stats stats_;
+  // Freshest entries at the front.
+  std::list<Entry> entries_;
+  std::map<DataVector<uint8_t>, std::list<Entry>::iterator> index_;
+};
+
+}  // namespace fxcodec
+
+#endif  // CORE_FXCODEC_ICC_ICC_TRANSFORM_CACHE_H_
@@ -0,0 +1,134 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/icc/icc_transform_cache.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "core/fxcodec/icc/icc_transform.h"
+#include "core/fxcrt/fx_system.h"
+#include "core/fxcrt/span.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Returns the data of an ICC profile with the sRGB colorspace.
+std::vector<uint8_t> CreateSRGBProfileData() {
+  cmsHPROFILE profile = cmsCreate_sRGBProfile();
+  cmsUInt32Number size = 0;
+  EXPECT_TRUE(cmsSaveProfileToMem(profile, nullptr, &size));
+  std::vector<uint8_t> data(size);
+  EXPECT_TRUE(cmsSaveProfileToMem(profile, data.data(), &size));
+  cmsCloseProfile(profile);
+  return data;
+}
+
+// Returns the data of an ICC profile with a gray colorspace.
+std::vector<uint8_t> CreateGrayProfileData() {
+  cmsToneCurve* gamma = cmsBuildGamma(nullptr, 2.2);
+  cmsHPROFILE profile = cmsCreateGrayProfile(cmsD50_xyY(), gamma);
+  cmsFreeToneCurve(gamma);
+  cmsUInt32Number size = 0;
+  EXPECT_TRUE(cmsSaveProfileToMem(profile, nullptr, &size));
+  std::vector<uint8_t> data(size);
+  EXPECT_TRUE(cmsSaveProfileToMem(profile, data.data(), &size));
+  cmsCloseProfile(profile);
+  return data;
+}
+
+}  // namespace
+
+namespace fxcodec {
+
+TEST(IccTransformCache, SharesTransforms) {
+  const std::vector<uint8_t> profile = CreateSRGBProfileData();
+  const std::vector<uint8_t> digest = {1, 2, 3};
+  IccTransformCache cache;
+  std::shared_ptr<IccTransform> transform =
+      cache.GetTransform(digest, profile);
+  ASSERT_TRUE(transform);
+  EXPECT_EQ(3, transform->components());
+  EXPECT_EQ(transform, cache.GetTransform(digest, profile));
+
+  // A different digest gets its own transform.
+  std::shared_ptr<IccTransform> other =
+      cache.GetTransform(std::vector<uint8_t>{4, 5, 6}, profile);
+  ASSERT_TRUE(other);
+  EXPECT_NE(transform, other);
+
+  const IccTransformCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(0u, stats.evictions);
+  EXPECT_EQ(2u, stats.entries);
+}
+
+TEST(IccTransformCache, RemembersInvalidProfiles) {
+  const std::vector<uint8_t> profile = {'n', 'o', 't', ' ', 'I', 'C', 'C'};
+  const std::vector<uint8_t> digest = {7};
+  IccTransformCache cache;
+  EXPECT_FALSE(cache.GetTransform(digest, profile));
+  EXPECT_FALSE(cache.GetTransform(digest, profile));
+  EXPECT_EQ(1u, cache.GetStats().hits);
+  EXPECT_EQ(1u, cache.GetStats().misses);
+}
+
+TEST(IccTransformCache, EvictsLeastRecentlyUsed) {
+  const std::vector<uint8_t> profile = CreateSRGBProfileData();
+  IccTransformCache cache(2);
+  std::shared_ptr<IccTransform> first =
+      cache.GetTransform(std::vector<uint8_t>{1}, profile);
+  cache.GetTransform(std::vector<uint8_t>{2}, profile);
+
+  // Using the first entry makes the second one the least recently used.
+  EXPECT_EQ(first, cache.GetTransform(std::vector<uint8_t>{1}, profile));
+  cache.GetTransform(std::vector<uint8_t>{3}, profile);
+  EXPECT_EQ(1u, cache.GetStats().evictions);
+  EXPECT_EQ(2u, cache.GetStats().entries);
+  EXPECT_EQ(first, cache.GetTransform(std::vector<uint8_t>{1}, profile));
+  EXPECT_EQ(3u, cache.GetStats().misses);
+  cache.GetTransform(std::vector<uint8_t>{2}, profile);
+  EXPECT_EQ(4u, cache.GetStats().misses);
+
+  // Evicted transforms stay usable by whoever still holds them.
+  cache.SetMaxEntries(0);
+  EXPECT_EQ(0u, cache.GetStats().entries);
+  ASSERT_TRUE(first);
+  EXPECT_EQ(3, first->components());
+
+  // Without room for any entries, nothing is cached.
+  EXPECT_TRUE(cache.GetTransform(std::vector<uint8_t>{1}, profile));
+  EXPECT_EQ(0u, cache.GetStats().entries);
+}
+
+TEST(IccTransform, GrayScanline) {
+  const std::vector<uint8_t> profile = CreateGrayProfileData();
+  std::unique_ptr<IccTransform> transform =
+      IccTransform::CreateTransformSRGB(profile);
+  ASSERT_TRUE(transform);
+  ASSERT_EQ(1, transform->components());
+
+  std::vector<uint8_t> src(300);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<uint8_t>(i * 7);
+  }
+  std::vector<uint8_t> dest(src.size() * 3);
+  transform->TranslateScanline(dest, src, static_cast<int>(src.size()));
+
+  // Scanlines are translated by table lookup, which must match translating
+  // each pixel with lcms.
+  for (size_t i = 0; i < src.size(); ++i) {
+    const float gray = (src[i] + 0.5f) / 255.0f;
+    float rgb[3];
+    transform->Translate(pdfium::span_from_ref(gray), rgb);
+    EXPECT_EQ(FXSYS_roundf(rgb[2] * 255), dest[i * 3]) << i;
+    EXPECT_EQ(FXSYS_roundf(rgb[1] * 255), dest[i * 3 + 1]) << i;
+    EXPECT_EQ(FXSYS_roundf(rgb[0] * 255), dest[i * 3 + 2]) << i;
+  }
+}
+
+}  // namespace fxcodec
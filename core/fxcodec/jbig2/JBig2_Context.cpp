@@ -9,7 +9,6 @@
 #include <algorithm>
 #include <array>
 #include <limits>
-#include <list>
 #include <utility>
 #include <vector>
 
@@ -40,24 +39,13 @@ size_t GetRefAggContextSize(bool val) {
 
 }  // namespace
 
-// Implement a very small least recently used (LRU) cache. It is very
-// common for a JBIG2 dictionary to span multiple pages in a PDF file,
-// and we do not want to decode the same dictionary over and over
-// again. We key off of the memory location of the dictionary. The
-// list keeps track of the freshness of entries, with freshest ones
-// at the front. Even a tiny cache size like 2 makes a dramatic
-// difference for typical JBIG2 documents.
-static const size_t kSymbolDictCacheMaxSize = 2;
-static_assert(kSymbolDictCacheMaxSize > 0,
-              "Symbol Dictionary Cache must have non-zero size");
-
 // static
 std::unique_ptr<CJBig2_Context> CJBig2_Context::Create(
     pdfium::span<const uint8_t> pGlobalSpan,
     uint64_t global_key,
     pdfium::span<const uint8_t> pSrcSpan,
     uint64_t src_key,
-    std::list<CJBig2_CachePair>* pSymbolDictCache) {
+    CJBig2_SymbolDictCache* pSymbolDictCache) {
   auto result = pdfium::WrapUnique(
       new CJBig2_Context(pSrcSpan, src_key, pSymbolDictCache, false));
   if (!pGlobalSpan.empty()) {
@@ -69,7 +57,7 @@ std::unique_ptr<CJBig2_Context> CJBig2_Context::Create(
 
 CJBig2_Context::CJBig2_Context(pdfium::span<const uint8_t> pSrcSpan,
                                uint64_t src_key,
-                               std::list<CJBig2_CachePair>* pSymbolDictCache,
+                               CJBig2_SymbolDictCache* pSymbolDictCache,
                                bool bIsGlobal)
     : stream_(std::make_unique<CJBig2_BitStream>(pSrcSpan, src_key)),
       huffman_tables_(CJBig2_HuffmanTable::kNumHuffmanTables),
@@ -553,22 +541,16 @@ JBig2_Result CJBig2_Context::ParseSymbolDict(CJBig2_Segment* pSegment) {
     }
   }
 
+  // Dictionaries in the globals stream are typically shared by many images,
+  // so avoid decoding them over and over again. Streams without a key cannot
+  // be told apart.
   CJBig2_CompoundKey key(pSegment->key_, pSegment->data_offset_);
-  bool cache_hit = false;
+  const bool use_cache = is_global_ && key.first != 0;
   pSegment->result_type_ = JBIG2_SYMBOL_DICT_POINTER;
-  if (is_global_ && key.first != 0) {
-    for (auto it = symbol_dict_cache_->begin(); it != symbol_dict_cache_->end();
-         ++it) {
-      if (it->first == key) {
-        pSegment->symbol_dict_ = it->second->DeepCopy();
-        symbol_dict_cache_->emplace_front(key, std::move(it->second));
-        symbol_dict_cache_->erase(it);
-        cache_hit = true;
-        break;
-      }
-    }
+  if (use_cache) {
+    pSegment->symbol_dict_ = symbol_dict_cache_->Lookup(key);
   }
-  if (!cache_hit) {
+  if (!pSegment->symbol_dict_) {
     if (bUseGbContext) {
       auto pArithDecoder = std::make_unique<CJBig2_ArithDecoder>(stream_.get());
       pSegment->symbol_dict_ = pSymbolDictDecoder->DecodeArith(
@@ -587,15 +569,8 @@ JBig2_Result CJBig2_Context::ParseSymbolDict(CJBig2_Segment* pSegment) {
       }
       stream_->alignByte();
     }
-    if (is_global_) {
-      std::unique_ptr<CJBig2_SymbolDict> value =
-          pSegment->symbol_dict_->DeepCopy();
-      size_t size = symbol_dict_cache_->size();
-      while (size >= kSymbolDictCacheMaxSize) {
-        symbol_dict_cache_->pop_back();
-        --size;
-      }
-      symbol_dict_cache_->emplace_front(key, std::move(value));
+    if (use_cache) {
+      symbol_dict_cache_->Insert(key, pSegment->symbol_dict_->DeepCopy());
     }
   }
   if (wFlags & 0x0200) {
@@ -6,8 +6,8 @@
 
 #include "core/fxcodec/jbig2/JBig2_GrdProc.h"
 
+#include <algorithm>
 #include <array>
-#include <functional>
 #include <memory>
 #include <utility>
 
@@ -15,410 +15,486 @@
 #include "core/fxcodec/jbig2/JBig2_ArithDecoder.h"
 #include "core/fxcodec/jbig2/JBig2_BitStream.h"
 #include "core/fxcodec/jbig2/JBig2_Image.h"
+#include "core/fxcrt/check.h"
+#include "core/fxcrt/compiler_specific.h"
 #include "core/fxcrt/pauseindicator_iface.h"
+#include "core/fxcrt/unowned_ptr.h"
 
 namespace {
 
-// TODO(npm): Name this constants better or merge some together.
-constexpr std::array<const uint16_t, 3> kOptConstant1 = {
-    {0x9b25, 0x0795, 0x00e5}};
-constexpr std::array<const uint16_t, 3> kOptConstant2 = {
-    {0x0006, 0x0004, 0x0001}};
-constexpr std::array<const uint16_t, 3> kOptConstant3 = {
-    {0xf800, 0x1e00, 0x0380}};
-constexpr std::array<const uint16_t, 3> kOptConstant4 = {
-    {0x0000, 0x0001, 0x0003}};
-constexpr std::array<const uint16_t, 3> kOptConstant5 = {
-    {0x07f0, 0x01f8, 0x007c}};
-constexpr std::array<const uint16_t, 3> kOptConstant6 = {
-    {0x7bf7, 0x0efb, 0x01bd}};
-constexpr std::array<const uint16_t, 3> kOptConstant7 = {
-    {0x0800, 0x0200, 0x0080}};
-constexpr std::array<const uint16_t, 3> kOptConstant8 = {
-    {0x0010, 0x0008, 0x0004}};
-constexpr std::array<const uint16_t, 3> kOptConstant9 = {
-    {0x000c, 0x0009, 0x0007}};
-constexpr std::array<const uint16_t, 3> kOptConstant10 = {
-    {0x0007, 0x000f, 0x0007}};
-constexpr std::array<const uint16_t, 3> kOptConstant11 = {
-    {0x001f, 0x001f, 0x000f}};
-constexpr std::array<const uint16_t, 3> kOptConstant12 = {
-    {0x000f, 0x0007, 0x0003}};
+// Bits in the sliding windows of RowReader.
+constexpr int kWindowBits = 64;
+
+// Where the context bits of the generic region templates come from, see
+// 6.2.5.3 of the JBIG2 spec. Besides the AT pixels, each context holds the
+// decoded pixels left of the current one in its low bits, followed by runs of
+// adjacent pixels from the two rows above. The runs are given by the offset
+// of their rightmost pixel and their length.
+struct TemplateLayout {
+  uint16_t tpgdon_context;
+  uint8_t current_row_bits;
+  uint8_t at_count;
+  std::array<uint8_t, 4> at_shifts;
+  std::array<int8_t, 2> run_lookaheads;  // For rows y - 2 and y - 1.
+  std::array<uint8_t, 2> run_bits;
+  std::array<uint8_t, 2> run_shifts;
+  // The AT pixel positions from Figures 3 to 6, which all lie in the rows
+  // above.
+  std::array<int8_t, 8> nominal_at;
+};
+
+constexpr std::array<TemplateLayout, 4> kTemplateLayouts = {{
+    {0x9b25, 4, 4, {4, 10, 11, 15}, {1, 2}, {3, 5}, {12, 5},
+     {3, -1, -3, -1, 2, -2, -2, -2}},
+    {0x0795, 3, 1, {3, 0, 0, 0}, {2, 2}, {4, 5}, {9, 4},
+     {3, -1, 0, 0, 0, 0, 0, 0}},
+    {0x00e5, 2, 1, {2, 0, 0, 0}, {1, 1}, {3, 4}, {7, 3},
+     {2, -1, 0, 0, 0, 0, 0, 0}},
+    {0x0195, 4, 1, {4, 0, 0, 0}, {0, 1}, {0, 5}, {0, 5},
+     {2, -1, 0, 0, 0, 0, 0, 0}},
+}};
+
+// Returns the lookaheads for rows y - 2 and y - 1 when the windows of the rows
+// above also cover the given AT pixels.
+constexpr std::array<int, 2> GetRunLookaheads(
+    const TemplateLayout& layout,
+    const std::array<int8_t, 8>& gbat) {
+  std::array<int, 2> lookaheads = {layout.run_lookaheads[0],
+                                   layout.run_lookaheads[1]};
+  for (int i = 0; i < layout.at_count; ++i) {
+    const int dx = gbat[2 * i];
+    const int dy = gbat[2 * i + 1];
+    if ((dy == -1 || dy == -2) && layout.run_bits[dy + 2] > 0 &&
+        dx <= kWindowBits - 8) {
+      lookaheads[dy + 2] = std::max(lookaheads[dy + 2], dx);
+    }
+  }
+  return lookaheads;
+}
 
-}  // namespace
+// Streams the pixels of one image row for the columns being decoded. Once
+// Advance() has been called for column x, bit i of window() holds the pixel
+// at column x + `lookahead` - i. Pixels outside of the row read as 0.
+class RowReader {
+ public:
+  RowReader() = default;
+
+  // `row` holds the whole bytes of a row that is `width` pixels wide, or is
+  // empty for rows outside of the image.
+  void Init(pdfium::span<const uint8_t> row, uint32_t width, int lookahead) {
+    row_ = row;
+    width_ = width;
+    lookahead_ = lookahead;
+    window_ = (static_cast<uint64_t>(LoadBits(int64_t{lookahead} - 64)) << 32) |
+              LoadBits(int64_t{lookahead} - 32);
+  }
 
-CJBig2_GRDProc::ProgressiveArithDecodeState::ProgressiveArithDecodeState() =
-    default;
+  // Fetches the pixels for the next 32 columns, starting at column `x`.
+  void Load(uint32_t x) { pending_ = LoadBits(int64_t{x} + lookahead_); }
 
-CJBig2_GRDProc::ProgressiveArithDecodeState::~ProgressiveArithDecodeState() =
-    default;
+  void Advance() {
+    window_ = (window_ << 1) | (pending_ >> 31);
+    pending_ <<= 1;
+  }
 
-CJBig2_GRDProc::CJBig2_GRDProc() = default;
+  uint64_t window() const { return window_; }
 
-CJBig2_GRDProc::~CJBig2_GRDProc() = default;
+ private:
+  uint8_t GetByte(int64_t index) const {
+    if (index < 0 || index >= static_cast<int64_t>(row_.size())) {
+      return 0;
+    }
+    uint8_t value = row_[static_cast<size_t>(index)];
+    if (index + 1 == static_cast<int64_t>(row_.size()) && width_ % 8) {
+      // Clear the padding bits past the end of the row.
+      value &= 0xff << (8 - width_ % 8);
+    }
+    return value;
+  }
 
-bool CJBig2_GRDProc::UseTemplate0Opt3() const {
-  return (GBAT[0] == 3) && (GBAT[1] == -1) && (GBAT[2] == -3) &&
-         (GBAT[3] == -1) && (GBAT[4] == 2) && (GBAT[5] == -2) &&
-         (GBAT[6] == -2) && (GBAT[7] == -2) && !USESKIP;
-}
+  // Returns the pixels at columns [`x`, `x` + 32), with the first one in the
+  // most significant bit.
+  uint32_t LoadBits(int64_t x) const {
+    const int64_t index = x >> 3;
+    uint64_t bits = 0;
+    for (int64_t i = index; i < index + 5; ++i) {
+      bits = (bits << 8) | GetByte(i);
+    }
+    return static_cast<uint32_t>(bits >> (8 - (x & 7)));
+  }
 
-bool CJBig2_GRDProc::UseTemplate1Opt3() const {
-  return (GBAT[0] == 3) && (GBAT[1] == -1) && !USESKIP;
-}
+  pdfium::span<const uint8_t> row_;
+  uint32_t width_ = 0;
+  int lookahead_ = 0;
+  uint64_t window_ = 0;
+  uint32_t pending_ = 0;
+};
+
+// Decodes generic region rows with arithmetic coding, 6.2.5.7 steps 3 c) i)
+// to iii). Rather than fetching every context pixel separately, the pixels
+// come from sliding windows that get refilled 32 columns at a time, which
+// works for any GBTEMPLATE and AT pixels, and for USESKIP.
+class GenericRowDecoder {
+ public:
+  GenericRowDecoder(uint8_t gbtemplate,
+                    const std::array<int8_t, 8>& gbat,
+                    const CJBig2_Image* skip)
+      : template_(std::min<uint8_t>(gbtemplate, 3)),
+        layout_(kTemplateLayouts[template_]),
+        skip_(skip),
+        // Widen the windows of the rows above to cover nearby AT pixels too.
+        run_lookaheads_(GetRunLookaheads(layout_, gbat)) {
+    nominal_at_ = std::equal(gbat.begin(), gbat.begin() + 2 * layout_.at_count,
+                             layout_.nominal_at.begin());
+    for (int i = 0; i < layout_.at_count; ++i) {
+      const int dx = gbat[2 * i];
+      const int dy = gbat[2 * i + 1];
+      AtPixel& at = at_pixels_[i];
+      at.dx = dx;
+      at.dy = dy;
+      if (dy > 0 || (dy == 0 && dx >= 0)) {
+        // Not decoded yet, so always 0.
+        at.source = AtSource::kZero;
+      } else if (dy == 0 && dx >= -kWindowBits) {
+        at.source = AtSource::kCurrentRow;
+        at.shift = -dx - 1;
+      } else if (dy == 0) {
+        at.source = AtSource::kCurrentRowMemory;
+      } else if (HasRun(dy) && dx <= run_lookaheads_[dy + 2] &&
+                 dx > run_lookaheads_[dy + 2] - kWindowBits) {
+        at.source = dy == -1 ? AtSource::kRowAbove : AtSource::kRowTwoAbove;
+        at.shift = run_lookaheads_[dy + 2] - dx;
+      } else {
+        at.source = AtSource::kOwnRow;
+      }
+    }
+  }
 
-bool CJBig2_GRDProc::UseTemplate23Opt3() const {
-  return (GBAT[0] == 2) && (GBAT[1] == -1) && !USESKIP;
-}
+  uint16_t tpgdon_context() const { return layout_.tpgdon_context; }
+
+  // Returns false if `arith_decoder` runs out of data.
+  bool DecodeRow(CJBig2_Image* image,
+                 uint32_t y,
+                 CJBig2_ArithDecoder* arith_decoder,
+                 pdfium::span<JBig2ArithCtx> contexts) {
+    switch (template_) {
+      case 0:
+        return DecodeRowForTemplate<0>(image, y, arith_decoder, contexts);
+      case 1:
+        return DecodeRowForTemplate<1>(image, y, arith_decoder, contexts);
+      case 2:
+        return DecodeRowForTemplate<2>(image, y, arith_decoder, contexts);
+      default:
+        return DecodeRowForTemplate<3>(image, y, arith_decoder, contexts);
+    }
+  }
 
-std::unique_ptr<CJBig2_Image> CJBig2_GRDProc::DecodeArith(
-    CJBig2_ArithDecoder* pArithDecoder,
-    pdfium::span<JBig2ArithCtx> gbContexts) {
-  if (!CJBig2_Image::IsValidImageSize(GBW, GBH)) {
-    return std::make_unique<CJBig2_Image>(GBW, GBH);
+ private:
+  enum class AtSource : uint8_t {
+    kZero,
+    kCurrentRow,
+    kCurrentRowMemory,
+    kRowAbove,
+    kRowTwoAbove,
+    kOwnRow,
+  };
+
+  struct AtPixel {
+    AtSource source = AtSource::kZero;
+    int dx = 0;
+    int dy = 0;
+    int shift = 0;
+    RowReader reader;  // Only used for kOwnRow.
+  };
+
+  // Whether the template has a run of pixels on row y + `dy`.
+  bool HasRun(int dy) const {
+    return (dy == -1 || dy == -2) && layout_.run_bits[dy + 2] > 0;
   }
 
-  switch (GBTEMPLATE) {
-    case 0:
-      return UseTemplate0Opt3()
-                 ? DecodeArithOpt3(pArithDecoder, gbContexts, 0)
-                 : DecodeArithTemplateUnopt(pArithDecoder, gbContexts, 0);
-    case 1:
-      return UseTemplate1Opt3()
-                 ? DecodeArithOpt3(pArithDecoder, gbContexts, 1)
-                 : DecodeArithTemplateUnopt(pArithDecoder, gbContexts, 1);
-    case 2:
-      return UseTemplate23Opt3()
-                 ? DecodeArithOpt3(pArithDecoder, gbContexts, 2)
-                 : DecodeArithTemplateUnopt(pArithDecoder, gbContexts, 2);
-    default:
-      return UseTemplate23Opt3()
-                 ? DecodeArithTemplate3Opt3(pArithDecoder, gbContexts)
-                 : DecodeArithTemplate3Unopt(pArithDecoder, gbContexts);
+  static pdfium::span<const uint8_t> GetRow(const CJBig2_Image* image,
+                                            int64_t y) {
+    if (y < 0 || y >= image->height()) {
+      return {};
+    }
+    // SAFETY: GetLine() returns rows of stride() bytes, which hold the whole
+    // bytes of the row.
+    return UNSAFE_BUFFERS(
+        pdfium::span(image->GetLine(static_cast<int32_t>(y)),
+                     static_cast<size_t>((image->width() + 7) / 8)));
   }
-}
 
-std::unique_ptr<CJBig2_Image> CJBig2_GRDProc::DecodeArithOpt3(
-    CJBig2_ArithDecoder* pArithDecoder,
-    pdfium::span<JBig2ArithCtx> gbContexts,
-    int OPT) {
-  auto GBREG = std::make_unique<CJBig2_Image>(GBW, GBH);
-  if (!GBREG->data()) {
-    return nullptr;
+  template <int kTemplate>
+  bool DecodeRowForTemplate(CJBig2_Image* image,
+                            uint32_t y,
+                            CJBig2_ArithDecoder* arith_decoder,
+                            pdfium::span<JBig2ArithCtx> contexts) {
+    // The nominal AT pixels are by far the most common, so they get code with
+    // fixed shifts.
+    return nominal_at_ ? DecodeRowWithAt<kTemplate, true>(image, y,
+                                                          arith_decoder,
+                                                          contexts)
+                       : DecodeRowWithAt<kTemplate, false>(image, y,
+                                                           arith_decoder,
+                                                           contexts);
   }
 
-  int LTP = 0;
-  uint8_t* pLine = GBREG->data();
-  int32_t nStride = GBREG->stride();
-  int32_t nStride2 = nStride << 1;
-  int32_t nLineBytes = ((GBW + 7) >> 3) - 1;
-  int32_t nBitsLeft = GBW - (nLineBytes << 3);
-  // TODO(npm): Why is the height only trimmed when OPT is 0?
-  uint32_t height = OPT == 0 ? GBH & 0x7fffffff : GBH;
-  UNSAFE_TODO({
-    for (uint32_t h = 0; h < height; ++h) {
-      if (TPGDON) {
-        if (pArithDecoder->IsComplete()) {
-          return nullptr;
-        }
+  template <int kTemplate, bool kNominalAt>
+  bool DecodeRowWithAt(CJBig2_Image* image,
+                       uint32_t y,
+                       CJBig2_ArithDecoder* arith_decoder,
+                       pdfium::span<JBig2ArithCtx> contexts) {
+    static constexpr TemplateLayout kLayout = kTemplateLayouts[kTemplate];
+    static constexpr bool kHasRowTwoAbove = kLayout.run_bits[0] > 0;
+    static constexpr uint32_t kCurrentRowMask =
+        (1u << kLayout.current_row_bits) - 1;
+    if (kNominalAt) {
+      DCHECK(run_lookaheads_ ==
+             GetRunLookaheads(kLayout, kLayout.nominal_at));
+    }
 
-        LTP = LTP ^ pArithDecoder->Decode(&gbContexts[kOptConstant1[OPT]]);
+    const uint32_t width = static_cast<uint32_t>(image->width());
+    RowReader row_two_above;
+    if (kHasRowTwoAbove) {
+      row_two_above.Init(GetRow(image, int64_t{y} - 2), width,
+                         run_lookaheads_[0]);
+    }
+    RowReader row_above;
+    row_above.Init(GetRow(image, int64_t{y} - 1), width, run_lookaheads_[1]);
+    const int row_two_above_shift =
+        GetLookahead<kTemplate, kNominalAt>(0) - kLayout.run_lookaheads[0];
+    const int row_above_shift =
+        GetLookahead<kTemplate, kNominalAt>(1) - kLayout.run_lookaheads[1];
+
+    bool needs_own_rows = false;
+    for (int i = 0; i < kLayout.at_count; ++i) {
+      AtPixel& at = at_pixels_[i];
+      if (at.source == AtSource::kOwnRow) {
+        at.reader.Init(GetRow(image, int64_t{y} + at.dy), width, at.dx);
+        needs_own_rows = true;
       }
-      if (LTP) {
-        GBREG->CopyLine(h, h - 1);
-      } else {
-        if (h > 1) {
-          uint8_t* pLine1 = pLine - nStride2;
-          uint8_t* pLine2 = pLine - nStride;
-          uint32_t line1 = (*pLine1++) << kOptConstant2[OPT];
-          uint32_t line2 = *pLine2++;
-          uint32_t CONTEXT =
-              (line1 & kOptConstant3[OPT]) |
-              ((line2 >> kOptConstant4[OPT]) & kOptConstant5[OPT]);
-          for (int32_t cc = 0; cc < nLineBytes; ++cc) {
-            line1 = (line1 << 8) | ((*pLine1++) << kOptConstant2[OPT]);
-            line2 = (line2 << 8) | (*pLine2++);
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; --k) {
-              if (pArithDecoder->IsComplete()) {
-                return nullptr;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT =
-                  (((CONTEXT & kOptConstant6[OPT]) << 1) | bVal |
-                   ((line1 >> k) & kOptConstant7[OPT]) |
-                   ((line2 >> (k + kOptConstant4[OPT])) & kOptConstant8[OPT]));
-            }
-            pLine[cc] = cVal;
-          }
-          line1 <<= 8;
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; ++k) {
-            if (pArithDecoder->IsComplete()) {
-              return nullptr;
-            }
+    }
+    RowReader skip_row;
+    if (skip_) {
+      skip_row.Init(GetRow(skip_, y), static_cast<uint32_t>(skip_->width()),
+                    0);
+    }
 
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = (((CONTEXT & kOptConstant6[OPT]) << 1) | bVal |
-                       ((line1 >> (7 - k)) & kOptConstant7[OPT]) |
-                       ((line2 >> (7 + kOptConstant4[OPT] - k)) &
-                        kOptConstant8[OPT]));
+    // SAFETY: GetLine() returns rows of stride() bytes, which hold the whole
+    // bytes of the row.
+    pdfium::span<uint8_t> row = UNSAFE_BUFFERS(
+        pdfium::span(image->GetLine(static_cast<int32_t>(y)),
+                     static_cast<size_t>((width + 7) / 8)));
+    // Bit i holds the pixel at column x - 1 - i.
+    uint64_t current_row = 0;
+    for (uint32_t x = 0; x < width; x += 32) {
+      if (kHasRowTwoAbove) {
+        row_two_above.Load(x);
+      }
+      row_above.Load(x);
+      if (needs_own_rows) {
+        for (int i = 0; i < kLayout.at_count; ++i) {
+          if (at_pixels_[i].source == AtSource::kOwnRow) {
+            at_pixels_[i].reader.Load(x);
           }
-          pLine[nLineBytes] = cVal1;
-        } else {
-          uint8_t* pLine2 = pLine - nStride;
-          uint32_t line2 = (h & 1) ? (*pLine2++) : 0;
-          uint32_t CONTEXT =
-              ((line2 >> kOptConstant4[OPT]) & kOptConstant5[OPT]);
-          for (int32_t cc = 0; cc < nLineBytes; ++cc) {
-            if (h & 1) {
-              line2 = (line2 << 8) | (*pLine2++);
-            }
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; --k) {
-              if (pArithDecoder->IsComplete()) {
-                return nullptr;
-              }
+        }
+      }
+      if (skip_) {
+        skip_row.Load(x);
+      }
 
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT =
-                  (((CONTEXT & kOptConstant6[OPT]) << 1) | bVal |
-                   ((line2 >> (k + kOptConstant4[OPT])) & kOptConstant8[OPT]));
+      const uint32_t count = std::min<uint32_t>(32, width - x);
+      for (uint32_t i = 0; i < count; ++i) {
+        if (kHasRowTwoAbove) {
+          row_two_above.Advance();
+        }
+        row_above.Advance();
+        if (needs_own_rows) {
+          for (int j = 0; j < kLayout.at_count; ++j) {
+            if (at_pixels_[j].source == AtSource::kOwnRow) {
+              at_pixels_[j].reader.Advance();
             }
-            pLine[cc] = cVal;
           }
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; ++k) {
-            if (pArithDecoder->IsComplete()) {
-              return nullptr;
-            }
+        }
+        if (skip_) {
+          skip_row.Advance();
+          if (skip_row.window() & 1) {
+            current_row <<= 1;
+            continue;
+          }
+        }
 
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = (((CONTEXT & kOptConstant6[OPT]) << 1) | bVal |
-                       (((line2 >> (7 + kOptConstant4[OPT] - k))) &
-                        kOptConstant8[OPT]));
+        uint32_t context = current_row & kCurrentRowMask;
+        context |= ((row_above.window() >> row_above_shift) &
+                    ((1u << kLayout.run_bits[1]) - 1))
+                   << kLayout.run_shifts[1];
+        if (kHasRowTwoAbove) {
+          context |= ((row_two_above.window() >> row_two_above_shift) &
+                      ((1u << kLayout.run_bits[0]) - 1))
+                     << kLayout.run_shifts[0];
+        }
+        if constexpr (kNominalAt) {
+          context |=
+              GetNominalAtPixel<kTemplate, 0>(row_two_above, row_above) |
+              GetNominalAtPixel<kTemplate, 1>(row_two_above, row_above) |
+              GetNominalAtPixel<kTemplate, 2>(row_two_above, row_above) |
+              GetNominalAtPixel<kTemplate, 3>(row_two_above, row_above);
+        } else {
+          for (int j = 0; j < kLayout.at_count; ++j) {
+            context |= GetAtPixel(at_pixels_[j], current_row, row_above,
+                                  row_two_above, row, x + i)
+                       << kLayout.at_shifts[j];
           }
-          pLine[nLineBytes] = cVal1;
         }
+        if (arith_decoder->IsComplete()) {
+          StoreColumns(current_row, i, row.subspan(x / 8));
+          return false;
+        }
+        current_row =
+            (current_row << 1) | arith_decoder->Decode(&contexts[context]);
       }
-      pLine += nStride;
+      StoreColumns(current_row, count, row.subspan(x / 8));
     }
-    return GBREG;
-  });
-}
-
-std::unique_ptr<CJBig2_Image> CJBig2_GRDProc::DecodeArithTemplateUnopt(
-    CJBig2_ArithDecoder* pArithDecoder,
-    pdfium::span<JBig2ArithCtx> gbContexts,
-    int UNOPT) {
-  auto GBREG = std::make_unique<CJBig2_Image>(GBW, GBH);
-  if (!GBREG->data()) {
-    return nullptr;
+    return true;
   }
 
-  GBREG->Fill(false);
-  int LTP = 0;
-  uint8_t MOD2 = UNOPT % 2;
-  uint8_t DIV2 = UNOPT / 2;
-  uint8_t SHIFT = 4 - UNOPT;
-  for (uint32_t h = 0; h < GBH; h++) {
-    if (TPGDON) {
-      if (pArithDecoder->IsComplete()) {
-        return nullptr;
-      }
-
-      LTP = LTP ^ pArithDecoder->Decode(&gbContexts[kOptConstant1[UNOPT]]);
+  // Returns the lookahead of the window for row y - 2 + `index`, which is
+  // known at compile time for the nominal AT pixels.
+  template <int kTemplate, bool kNominalAt>
+  int GetLookahead(int index) const {
+    if constexpr (kNominalAt) {
+      constexpr TemplateLayout kLayout = kTemplateLayouts[kTemplate];
+      constexpr std::array<int, 2> kLookaheads =
+          GetRunLookaheads(kLayout, kLayout.nominal_at);
+      return kLookaheads[index];
+    } else {
+      return run_lookaheads_[index];
     }
-    if (LTP) {
-      GBREG->CopyLine(h, h - 1);
-      continue;
+  }
+
+  // Returns nominal AT pixel `kIndex` of `kTemplate` in its context bit.
+  template <int kTemplate, int kIndex>
+  static uint32_t GetNominalAtPixel(const RowReader& row_two_above,
+                                    const RowReader& row_above) {
+    constexpr TemplateLayout kLayout = kTemplateLayouts[kTemplate];
+    if constexpr (kIndex >= kLayout.at_count) {
+      return 0;
+    } else {
+      constexpr int kDx = kLayout.nominal_at[2 * kIndex];
+      constexpr int kDy = kLayout.nominal_at[2 * kIndex + 1];
+      constexpr int kShift =
+          GetRunLookaheads(kLayout, kLayout.nominal_at)[kDy + 2] - kDx;
+      const uint64_t window =
+          kDy == -1 ? row_above.window() : row_two_above.window();
+      return static_cast<uint32_t>((window >> kShift) & 1)
+             << kLayout.at_shifts[kIndex];
     }
-    uint32_t line1 = GBREG->GetPixel(1 + MOD2, h - 2);
-    line1 |= GBREG->GetPixel(MOD2, h - 2) << 1;
-    if (UNOPT == 1) {
-      line1 |= GBREG->GetPixel(0, h - 2) << 2;
+  }
+
+  // Stores the last `count` pixels in `current_row`, up to 32, at the start of
+  // `dest`, with zero padding.
+  static void StoreColumns(uint64_t current_row,
+                           uint32_t count,
+                           pdfium::span<uint8_t> dest) {
+    if (count == 0) {
+      return;
     }
-    uint32_t line2 = GBREG->GetPixel(2 - DIV2, h - 1);
-    line2 |= GBREG->GetPixel(1 - DIV2, h - 1) << 1;
-    if (UNOPT < 2) {
-      line2 |= GBREG->GetPixel(0, h - 1) << 2;
+    const uint32_t bits = static_cast<uint32_t>(current_row) << (32 - count);
+    for (uint32_t i = 0; i < (count + 7) / 8; ++i) {
+      dest[i] = static_cast<uint8_t>(bits >> (24 - 8 * i));
     }
-    uint32_t line3 = 0;
-    for (uint32_t w = 0; w < GBW; w++) {
-      int bVal = 0;
-      if (!USESKIP || !SKIP->GetPixel(w, h)) {
-        if (pArithDecoder->IsComplete()) {
-          return nullptr;
-        }
+  }
 
-        uint32_t CONTEXT = line3;
-        CONTEXT |= GBREG->GetPixel(w + GBAT[0], h + GBAT[1]) << SHIFT;
-        CONTEXT |= line2 << (SHIFT + 1);
-        CONTEXT |= line1 << kOptConstant9[UNOPT];
-        if (UNOPT == 0) {
-          CONTEXT |= GBREG->GetPixel(w + GBAT[2], h + GBAT[3]) << 10;
-          CONTEXT |= GBREG->GetPixel(w + GBAT[4], h + GBAT[5]) << 11;
-          CONTEXT |= GBREG->GetPixel(w + GBAT[6], h + GBAT[7]) << 15;
-        }
-        bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-        if (bVal) {
-          GBREG->SetPixel(w, h, bVal);
+  static uint32_t GetAtPixel(const AtPixel& at,
+                             uint64_t current_row,
+                             const RowReader& row_above,
+                             const RowReader& row_two_above,
+                             pdfium::span<const uint8_t> row,
+                             uint32_t x) {
+    switch (at.source) {
+      case AtSource::kZero:
+        return 0;
+      case AtSource::kCurrentRow:
+        return (current_row >> at.shift) & 1;
+      case AtSource::kCurrentRowMemory: {
+        // Far enough left to have been stored already.
+        const int64_t at_x = int64_t{x} + at.dx;
+        if (at_x < 0) {
+          return 0;
         }
+        return (row[static_cast<size_t>(at_x / 8)] >> (7 - at_x % 8)) & 1;
       }
-      line1 = ((line1 << 1) | GBREG->GetPixel(w + 2 + MOD2, h - 2)) &
-              kOptConstant10[UNOPT];
-      line2 = ((line2 << 1) | GBREG->GetPixel(w + 3 - DIV2, h - 1)) &
-              kOptConstant11[UNOPT];
-      line3 = ((line3 << 1) | bVal) & kOptConstant12[UNOPT];
+      case AtSource::kRowAbove:
+        return (row_above.window() >> at.shift) & 1;
+      case AtSource::kRowTwoAbove:
+        return (row_two_above.window() >> at.shift) & 1;
+      case AtSource::kOwnRow:
+        return at.reader.window() & 1;
     }
   }
-  return GBREG;
-}
 
-std::unique_ptr<CJBig2_Image> CJBig2_GRDProc::DecodeArithTemplate3Opt3(
-    CJBig2_ArithDecoder* pArithDecoder,
-    pdfium::span<JBig2ArithCtx> gbContexts) {
-  auto GBREG = std::make_unique<CJBig2_Image>(GBW, GBH);
-  if (!GBREG->data()) {
-    return nullptr;
+  const uint8_t template_;
+  const TemplateLayout& layout_;
+  UnownedPtr<const CJBig2_Image> const skip_;
+  const std::array<int, 2> run_lookaheads_;
+  bool nominal_at_;
+  std::array<AtPixel, 4> at_pixels_;
+};
+
+// Decodes row `y`, including the TPGDON flag that says whether the row is the
+// same as the previous one.
+bool DecodeRegionRow(GenericRowDecoder& row_decoder,
+                     bool tpgdon,
+                     CJBig2_Image* image,
+                     uint32_t y,
+                     CJBig2_ArithDecoder* arith_decoder,
+                     pdfium::span<JBig2ArithCtx> contexts,
+                     int& ltp) {
+  if (tpgdon) {
+    if (arith_decoder->IsComplete()) {
+      return false;
+    }
+    ltp ^= arith_decoder->Decode(&contexts[row_decoder.tpgdon_context()]);
   }
+  if (ltp) {
+    image->CopyLine(y, y - 1);
+    return true;
+  }
+  return row_decoder.DecodeRow(image, y, arith_decoder, contexts);
+}
 
-  int LTP = 0;
-  uint8_t* pLine = GBREG->data();
-  int32_t nStride = GBREG->stride();
-  int32_t nLineBytes = ((GBW + 7) >> 3) - 1;
-  int32_t nBitsLeft = GBW - (nLineBytes << 3);
-
-  UNSAFE_TODO({
-    for (uint32_t h = 0; h < GBH; h++) {
-      if (TPGDON) {
-        if (pArithDecoder->IsComplete()) {
-          return nullptr;
-        }
-
-        LTP = LTP ^ pArithDecoder->Decode(&gbContexts[0x0195]);
-      }
-
-      if (LTP) {
-        GBREG->CopyLine(h, h - 1);
-      } else {
-        if (h > 0) {
-          uint8_t* pLine1 = pLine - nStride;
-          uint32_t line1 = *pLine1++;
-          uint32_t CONTEXT = (line1 >> 1) & 0x03f0;
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            line1 = (line1 << 8) | (*pLine1++);
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return nullptr;
-              }
+}  // namespace
 
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal |
-                        ((line1 >> (k + 1)) & 0x0010);
-            }
-            pLine[cc] = cVal;
-          }
-          line1 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return nullptr;
-            }
+CJBig2_GRDProc::ProgressiveArithDecodeState::ProgressiveArithDecodeState() =
+    default;
 
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal |
-                      ((line1 >> (8 - k)) & 0x0010);
-          }
-          pLine[nLineBytes] = cVal1;
-        } else {
-          uint32_t CONTEXT = 0;
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return nullptr;
-              }
+CJBig2_GRDProc::ProgressiveArithDecodeState::~ProgressiveArithDecodeState() =
+    default;
 
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal;
-            }
-            pLine[cc] = cVal;
-          }
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return nullptr;
-            }
+CJBig2_GRDProc::CJBig2_GRDProc() = default;
 
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal;
-          }
-          pLine[nLineBytes] = cVal1;
-        }
-      }
-      pLine += nStride;
-    }
-    return GBREG;
-  });
-}
+CJBig2_GRDProc::~CJBig2_GRDProc() = default;
 
-std::unique_ptr<CJBig2_Image> CJBig2_GRDProc::DecodeArithTemplate3Unopt(
+std::unique_ptr<CJBig2_Image> CJBig2_GRDProc::DecodeArith(
     CJBig2_ArithDecoder* pArithDecoder,
     pdfium::span<JBig2ArithCtx> gbContexts) {
+  if (!CJBig2_Image::IsValidImageSize(GBW, GBH)) {
+    return std::make_unique<CJBig2_Image>(GBW, GBH);
+  }
+
   auto GBREG = std::make_unique<CJBig2_Image>(GBW, GBH);
   if (!GBREG->data()) {
     return nullptr;
   }
 
   GBREG->Fill(false);
+  GenericRowDecoder row_decoder(GBTEMPLATE, GBAT,
+                                USESKIP ? SKIP.get() : nullptr);
   int LTP = 0;
-  for (uint32_t h = 0; h < GBH; h++) {
-    if (TPGDON) {
-      if (pArithDecoder->IsComplete()) {
-        return nullptr;
-      }
-
-      LTP = LTP ^ pArithDecoder->Decode(&gbContexts[0x0195]);
-    }
-    if (LTP == 1) {
-      GBREG->CopyLine(h, h - 1);
-    } else {
-      uint32_t line1 = GBREG->GetPixel(1, h - 1);
-      line1 |= GBREG->GetPixel(0, h - 1) << 1;
-      uint32_t line2 = 0;
-      for (uint32_t w = 0; w < GBW; w++) {
-        int bVal;
-        if (USESKIP && SKIP->GetPixel(w, h)) {
-          bVal = 0;
-        } else {
-          uint32_t CONTEXT = line2;
-          CONTEXT |= GBREG->GetPixel(w + GBAT[0], h + GBAT[1]) << 4;
-          CONTEXT |= line1 << 5;
-          if (pArithDecoder->IsComplete()) {
-            return nullptr;
-          }
-
-          bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-        }
-        if (bVal) {
-          GBREG->SetPixel(w, h, bVal);
-        }
-        line1 = ((line1 << 1) | GBREG->GetPixel(w + 2, h - 1)) & 0x1f;
-        line2 = ((line2 << 1) | bVal) & 0x0f;
-      }
+  for (uint32_t h = 0; h < GBH; ++h) {
+    if (!DecodeRegionRow(row_decoder, TPGDON, GBREG.get(), h, pArithDecoder,
+                         gbContexts, LTP)) {
+      return nullptr;
     }
   }
   return GBREG;
@@ -443,7 +519,6 @@ FXCODEC_STATUS CJBig2_GRDProc::StartDecodeArith(
   pImage->get()->Fill(false);
   decode_type_ = 1;
   ltp_ = 0;
-  line_ = nullptr;
   loop_index_ = 0;
   return ProgressiveDecodeArith(pState);
 }
@@ -451,34 +526,22 @@ FXCODEC_STATUS CJBig2_GRDProc::StartDecodeArith(
 FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArith(
     ProgressiveArithDecodeState* pState) {
   int iline = loop_index_;
-
-  using DecodeFunction = std::function<FXCODEC_STATUS(
-      CJBig2_GRDProc&, ProgressiveArithDecodeState*)>;
-  DecodeFunction func;
-  switch (GBTEMPLATE) {
-    case 0:
-      func = UseTemplate0Opt3()
-                 ? &CJBig2_GRDProc::ProgressiveDecodeArithTemplate0Opt3
-                 : &CJBig2_GRDProc::ProgressiveDecodeArithTemplate0Unopt;
-      break;
-    case 1:
-      func = UseTemplate1Opt3()
-                 ? &CJBig2_GRDProc::ProgressiveDecodeArithTemplate1Opt3
-                 : &CJBig2_GRDProc::ProgressiveDecodeArithTemplate1Unopt;
-      break;
-    case 2:
-      func = UseTemplate23Opt3()
-                 ? &CJBig2_GRDProc::ProgressiveDecodeArithTemplate2Opt3
-                 : &CJBig2_GRDProc::ProgressiveDecodeArithTemplate2Unopt;
+  CJBig2_Image* pImage = pState->pImage->get();
+  GenericRowDecoder row_decoder(GBTEMPLATE, GBAT,
+                                USESKIP ? SKIP.get() : nullptr);
+  progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
+  for (; loop_index_ < GBH; ++loop_index_) {
+    if (!DecodeRegionRow(row_decoder, TPGDON, pImage, loop_index_,
+                         pState->pArithDecoder, pState->gbContexts, ltp_)) {
+      progressive_status_ = FXCODEC_STATUS::kError;
       break;
-    default:
-      func = UseTemplate23Opt3()
-                 ? &CJBig2_GRDProc::ProgressiveDecodeArithTemplate3Opt3
-                 : &CJBig2_GRDProc::ProgressiveDecodeArithTemplate3Unopt;
+    }
+    if (pState->pPause && pState->pPause->NeedToPauseNow()) {
+      loop_index_++;
+      progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
       break;
+    }
   }
-  CJBig2_Image* pImage = pState->pImage->get();
-  progressive_status_ = func(*this, pState);
   replace_rect_.left = 0;
   replace_rect_.right = pImage->width();
   replace_rect_.top = iline;
@@ -523,652 +586,3 @@ FXCODEC_STATUS CJBig2_GRDProc::ContinueDecode(
   }
   return ProgressiveDecodeArith(pState);
 }
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate0Opt3(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  if (!line_) {
-    line_ = pImage->data();
-  }
-  int32_t nStride = pImage->stride();
-  int32_t nStride2 = nStride << 1;
-  int32_t nLineBytes = ((GBW + 7) >> 3) - 1;
-  int32_t nBitsLeft = GBW - (nLineBytes << 3);
-  uint32_t height = GBH & 0x7fffffff;
-
-  UNSAFE_TODO({
-    for (; loop_index_ < height; loop_index_++) {
-      if (TPGDON) {
-        if (pArithDecoder->IsComplete()) {
-          return FXCODEC_STATUS::kError;
-        }
-
-        ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x9b25]);
-      }
-      if (ltp_) {
-        pImage->CopyLine(loop_index_, loop_index_ - 1);
-      } else {
-        if (loop_index_ > 1) {
-          uint8_t* pLine1 = line_ - nStride2;
-          uint8_t* pLine2 = line_ - nStride;
-          uint32_t line1 = (*pLine1++) << 6;
-          uint32_t line2 = *pLine2++;
-          uint32_t CONTEXT = ((line1 & 0xf800) | (line2 & 0x07f0));
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            line1 = (line1 << 8) | ((*pLine1++) << 6);
-            line2 = (line2 << 8) | (*pLine2++);
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = (((CONTEXT & 0x7bf7) << 1) | bVal |
-                         ((line1 >> k) & 0x0800) | ((line2 >> k) & 0x0010));
-            }
-            line_[cc] = cVal;
-          }
-          line1 <<= 8;
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT =
-                (((CONTEXT & 0x7bf7) << 1) | bVal |
-                 ((line1 >> (7 - k)) & 0x0800) | ((line2 >> (7 - k)) & 0x0010));
-          }
-          line_[nLineBytes] = cVal1;
-        } else {
-          uint8_t* pLine2 = line_ - nStride;
-          uint32_t line2 = (loop_index_ & 1) ? (*pLine2++) : 0;
-          uint32_t CONTEXT = (line2 & 0x07f0);
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            if (loop_index_ & 1) {
-              line2 = (line2 << 8) | (*pLine2++);
-            }
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT =
-                  (((CONTEXT & 0x7bf7) << 1) | bVal | ((line2 >> k) & 0x0010));
-            }
-            line_[cc] = cVal;
-          }
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = (((CONTEXT & 0x7bf7) << 1) | bVal |
-                       ((line2 >> (7 - k)) & 0x0010));
-          }
-          line_[nLineBytes] = cVal1;
-        }
-      }
-      line_ += nStride;
-      if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-        loop_index_++;
-        progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-        return FXCODEC_STATUS::kDecodeToBeContinued;
-      }
-    }
-    progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-    return FXCODEC_STATUS::kDecodeFinished;
-  });
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate0Unopt(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  for (; loop_index_ < GBH; loop_index_++) {
-    if (TPGDON) {
-      if (pArithDecoder->IsComplete()) {
-        return FXCODEC_STATUS::kError;
-      }
-
-      ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x9b25]);
-    }
-    if (ltp_) {
-      pImage->CopyLine(loop_index_, loop_index_ - 1);
-    } else {
-      uint32_t line1 = pImage->GetPixel(1, loop_index_ - 2);
-      line1 |= pImage->GetPixel(0, loop_index_ - 2) << 1;
-      uint32_t line2 = pImage->GetPixel(2, loop_index_ - 1);
-      line2 |= pImage->GetPixel(1, loop_index_ - 1) << 1;
-      line2 |= pImage->GetPixel(0, loop_index_ - 1) << 2;
-      uint32_t line3 = 0;
-      for (uint32_t w = 0; w < GBW; w++) {
-        int bVal;
-        if (USESKIP && SKIP->GetPixel(w, loop_index_)) {
-          bVal = 0;
-        } else {
-          uint32_t CONTEXT = line3;
-          CONTEXT |= pImage->GetPixel(w + GBAT[0], loop_index_ + GBAT[1]) << 4;
-          CONTEXT |= line2 << 5;
-          CONTEXT |= pImage->GetPixel(w + GBAT[2], loop_index_ + GBAT[3]) << 10;
-          CONTEXT |= pImage->GetPixel(w + GBAT[4], loop_index_ + GBAT[5]) << 11;
-          CONTEXT |= line1 << 12;
-          CONTEXT |= pImage->GetPixel(w + GBAT[6], loop_index_ + GBAT[7]) << 15;
-          if (pArithDecoder->IsComplete()) {
-            return FXCODEC_STATUS::kError;
-          }
-
-          bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-        }
-        if (bVal) {
-          pImage->SetPixel(w, loop_index_, bVal);
-        }
-        line1 =
-            ((line1 << 1) | pImage->GetPixel(w + 2, loop_index_ - 2)) & 0x07;
-        line2 =
-            ((line2 << 1) | pImage->GetPixel(w + 3, loop_index_ - 1)) & 0x1f;
-        line3 = ((line3 << 1) | bVal) & 0x0f;
-      }
-    }
-    if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-      loop_index_++;
-      progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-      return FXCODEC_STATUS::kDecodeToBeContinued;
-    }
-  }
-  progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-  return FXCODEC_STATUS::kDecodeFinished;
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate1Opt3(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  if (!line_) {
-    line_ = pImage->data();
-  }
-  int32_t nStride = pImage->stride();
-  int32_t nStride2 = nStride << 1;
-  int32_t nLineBytes = ((GBW + 7) >> 3) - 1;
-  int32_t nBitsLeft = GBW - (nLineBytes << 3);
-
-  UNSAFE_TODO({
-    for (; loop_index_ < GBH; loop_index_++) {
-      if (TPGDON) {
-        if (pArithDecoder->IsComplete()) {
-          return FXCODEC_STATUS::kError;
-        }
-
-        ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x0795]);
-      }
-      if (ltp_) {
-        pImage->CopyLine(loop_index_, loop_index_ - 1);
-      } else {
-        if (loop_index_ > 1) {
-          uint8_t* pLine1 = line_ - nStride2;
-          uint8_t* pLine2 = line_ - nStride;
-          uint32_t line1 = (*pLine1++) << 4;
-          uint32_t line2 = *pLine2++;
-          uint32_t CONTEXT = (line1 & 0x1e00) | ((line2 >> 1) & 0x01f8);
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            line1 = (line1 << 8) | ((*pLine1++) << 4);
-            line2 = (line2 << 8) | (*pLine2++);
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x0efb) << 1) | bVal |
-                        ((line1 >> k) & 0x0200) | ((line2 >> (k + 1)) & 0x0008);
-            }
-            line_[cc] = cVal;
-          }
-          line1 <<= 8;
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x0efb) << 1) | bVal |
-                      ((line1 >> (7 - k)) & 0x0200) |
-                      ((line2 >> (8 - k)) & 0x0008);
-          }
-          line_[nLineBytes] = cVal1;
-        } else {
-          uint8_t* pLine2 = line_ - nStride;
-          uint32_t line2 = (loop_index_ & 1) ? (*pLine2++) : 0;
-          uint32_t CONTEXT = (line2 >> 1) & 0x01f8;
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            if (loop_index_ & 1) {
-              line2 = (line2 << 8) | (*pLine2++);
-            }
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x0efb) << 1) | bVal |
-                        ((line2 >> (k + 1)) & 0x0008);
-            }
-            line_[cc] = cVal;
-          }
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x0efb) << 1) | bVal |
-                      ((line2 >> (8 - k)) & 0x0008);
-          }
-          line_[nLineBytes] = cVal1;
-        }
-      }
-      line_ += nStride;
-      if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-        loop_index_++;
-        progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-        return FXCODEC_STATUS::kDecodeToBeContinued;
-      }
-    }
-    progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-    return FXCODEC_STATUS::kDecodeFinished;
-  });
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate1Unopt(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  for (uint32_t h = 0; h < GBH; h++) {
-    if (TPGDON) {
-      if (pArithDecoder->IsComplete()) {
-        return FXCODEC_STATUS::kError;
-      }
-
-      ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x0795]);
-    }
-    if (ltp_) {
-      pImage->CopyLine(h, h - 1);
-    } else {
-      uint32_t line1 = pImage->GetPixel(2, h - 2);
-      line1 |= pImage->GetPixel(1, h - 2) << 1;
-      line1 |= pImage->GetPixel(0, h - 2) << 2;
-      uint32_t line2 = pImage->GetPixel(2, h - 1);
-      line2 |= pImage->GetPixel(1, h - 1) << 1;
-      line2 |= pImage->GetPixel(0, h - 1) << 2;
-      uint32_t line3 = 0;
-      for (uint32_t w = 0; w < GBW; w++) {
-        int bVal;
-        if (USESKIP && SKIP->GetPixel(w, h)) {
-          bVal = 0;
-        } else {
-          uint32_t CONTEXT = line3;
-          CONTEXT |= pImage->GetPixel(w + GBAT[0], h + GBAT[1]) << 3;
-          CONTEXT |= line2 << 4;
-          CONTEXT |= line1 << 9;
-          if (pArithDecoder->IsComplete()) {
-            return FXCODEC_STATUS::kError;
-          }
-
-          bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-        }
-        if (bVal) {
-          pImage->SetPixel(w, h, bVal);
-        }
-        line1 = ((line1 << 1) | pImage->GetPixel(w + 3, h - 2)) & 0x0f;
-        line2 = ((line2 << 1) | pImage->GetPixel(w + 3, h - 1)) & 0x1f;
-        line3 = ((line3 << 1) | bVal) & 0x07;
-      }
-    }
-    if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-      loop_index_++;
-      progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-      return FXCODEC_STATUS::kDecodeToBeContinued;
-    }
-  }
-  progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-  return FXCODEC_STATUS::kDecodeFinished;
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate2Opt3(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  if (!line_) {
-    line_ = pImage->data();
-  }
-  int32_t nStride = pImage->stride();
-  int32_t nStride2 = nStride << 1;
-  int32_t nLineBytes = ((GBW + 7) >> 3) - 1;
-  int32_t nBitsLeft = GBW - (nLineBytes << 3);
-  UNSAFE_TODO({
-    for (; loop_index_ < GBH; loop_index_++) {
-      if (TPGDON) {
-        if (pArithDecoder->IsComplete()) {
-          return FXCODEC_STATUS::kError;
-        }
-
-        ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x00e5]);
-      }
-      if (ltp_) {
-        pImage->CopyLine(loop_index_, loop_index_ - 1);
-      } else {
-        if (loop_index_ > 1) {
-          uint8_t* pLine1 = line_ - nStride2;
-          uint8_t* pLine2 = line_ - nStride;
-          uint32_t line1 = (*pLine1++) << 1;
-          uint32_t line2 = *pLine2++;
-          uint32_t CONTEXT = (line1 & 0x0380) | ((line2 >> 3) & 0x007c);
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            line1 = (line1 << 8) | ((*pLine1++) << 1);
-            line2 = (line2 << 8) | (*pLine2++);
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x01bd) << 1) | bVal |
-                        ((line1 >> k) & 0x0080) | ((line2 >> (k + 3)) & 0x0004);
-            }
-            line_[cc] = cVal;
-          }
-          line1 <<= 8;
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x01bd) << 1) | bVal |
-                      ((line1 >> (7 - k)) & 0x0080) |
-                      ((line2 >> (10 - k)) & 0x0004);
-          }
-          line_[nLineBytes] = cVal1;
-        } else {
-          uint8_t* pLine2 = line_ - nStride;
-          uint32_t line2 = (loop_index_ & 1) ? (*pLine2++) : 0;
-          uint32_t CONTEXT = (line2 >> 3) & 0x007c;
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            if (loop_index_ & 1) {
-              line2 = (line2 << 8) | (*pLine2++);
-            }
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x01bd) << 1) | bVal |
-                        ((line2 >> (k + 3)) & 0x0004);
-            }
-            line_[cc] = cVal;
-          }
-          line2 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x01bd) << 1) | bVal |
-                      (((line2 >> (10 - k))) & 0x0004);
-          }
-          line_[nLineBytes] = cVal1;
-        }
-      }
-      line_ += nStride;
-      if (pState->pPause && loop_index_ % 50 == 0 &&
-          pState->pPause->NeedToPauseNow()) {
-        loop_index_++;
-        progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-        return FXCODEC_STATUS::kDecodeToBeContinued;
-      }
-    }
-    progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-    return FXCODEC_STATUS::kDecodeFinished;
-  })
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate2Unopt(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  for (; loop_index_ < GBH; loop_index_++) {
-    if (TPGDON) {
-      if (pArithDecoder->IsComplete()) {
-        return FXCODEC_STATUS::kError;
-      }
-
-      ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x00e5]);
-    }
-    if (ltp_) {
-      pImage->CopyLine(loop_index_, loop_index_ - 1);
-    } else {
-      uint32_t line1 = pImage->GetPixel(1, loop_index_ - 2);
-      line1 |= pImage->GetPixel(0, loop_index_ - 2) << 1;
-      uint32_t line2 = pImage->GetPixel(1, loop_index_ - 1);
-      line2 |= pImage->GetPixel(0, loop_index_ - 1) << 1;
-      uint32_t line3 = 0;
-      for (uint32_t w = 0; w < GBW; w++) {
-        int bVal;
-        if (USESKIP && SKIP->GetPixel(w, loop_index_)) {
-          bVal = 0;
-        } else {
-          uint32_t CONTEXT = line3;
-          CONTEXT |= pImage->GetPixel(w + GBAT[0], loop_index_ + GBAT[1]) << 2;
-          CONTEXT |= line2 << 3;
-          CONTEXT |= line1 << 7;
-          if (pArithDecoder->IsComplete()) {
-            return FXCODEC_STATUS::kError;
-          }
-
-          bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-        }
-        if (bVal) {
-          pImage->SetPixel(w, loop_index_, bVal);
-        }
-        line1 =
-            ((line1 << 1) | pImage->GetPixel(w + 2, loop_index_ - 2)) & 0x07;
-        line2 =
-            ((line2 << 1) | pImage->GetPixel(w + 2, loop_index_ - 1)) & 0x0f;
-        line3 = ((line3 << 1) | bVal) & 0x03;
-      }
-    }
-    if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-      loop_index_++;
-      progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-      return FXCODEC_STATUS::kDecodeToBeContinued;
-    }
-  }
-  progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-  return FXCODEC_STATUS::kDecodeFinished;
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate3Opt3(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  if (!line_) {
-    line_ = pImage->data();
-  }
-  int32_t nStride = pImage->stride();
-  int32_t nLineBytes = ((GBW + 7) >> 3) - 1;
-  int32_t nBitsLeft = GBW - (nLineBytes << 3);
-  UNSAFE_TODO({
-    for (; loop_index_ < GBH; loop_index_++) {
-      if (TPGDON) {
-        if (pArithDecoder->IsComplete()) {
-          return FXCODEC_STATUS::kError;
-        }
-
-        ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x0195]);
-      }
-      if (ltp_) {
-        pImage->CopyLine(loop_index_, loop_index_ - 1);
-      } else {
-        if (loop_index_ > 0) {
-          uint8_t* pLine1 = line_ - nStride;
-          uint32_t line1 = *pLine1++;
-          uint32_t CONTEXT = (line1 >> 1) & 0x03f0;
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            line1 = (line1 << 8) | (*pLine1++);
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal |
-                        ((line1 >> (k + 1)) & 0x0010);
-            }
-            line_[cc] = cVal;
-          }
-          line1 <<= 8;
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal |
-                      ((line1 >> (8 - k)) & 0x0010);
-          }
-          line_[nLineBytes] = cVal1;
-        } else {
-          uint32_t CONTEXT = 0;
-          for (int32_t cc = 0; cc < nLineBytes; cc++) {
-            uint8_t cVal = 0;
-            for (int32_t k = 7; k >= 0; k--) {
-              if (pArithDecoder->IsComplete()) {
-                return FXCODEC_STATUS::kError;
-              }
-
-              int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-              cVal |= bVal << k;
-              CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal;
-            }
-            line_[cc] = cVal;
-          }
-          uint8_t cVal1 = 0;
-          for (int32_t k = 0; k < nBitsLeft; k++) {
-            if (pArithDecoder->IsComplete()) {
-              return FXCODEC_STATUS::kError;
-            }
-
-            int bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-            cVal1 |= bVal << (7 - k);
-            CONTEXT = ((CONTEXT & 0x01f7) << 1) | bVal;
-          }
-          line_[nLineBytes] = cVal1;
-        }
-      }
-      line_ += nStride;
-      if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-        loop_index_++;
-        progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-        return FXCODEC_STATUS::kDecodeToBeContinued;
-      }
-    }
-    progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-    return FXCODEC_STATUS::kDecodeFinished;
-  });
-}
-
-FXCODEC_STATUS CJBig2_GRDProc::ProgressiveDecodeArithTemplate3Unopt(
-    ProgressiveArithDecodeState* pState) {
-  CJBig2_Image* pImage = pState->pImage->get();
-  pdfium::span<JBig2ArithCtx> gbContexts = pState->gbContexts;
-  CJBig2_ArithDecoder* pArithDecoder = pState->pArithDecoder;
-  for (; loop_index_ < GBH; loop_index_++) {
-    if (TPGDON) {
-      if (pArithDecoder->IsComplete()) {
-        return FXCODEC_STATUS::kError;
-      }
-
-      ltp_ = ltp_ ^ pArithDecoder->Decode(&gbContexts[0x0195]);
-    }
-    if (ltp_) {
-      pImage->CopyLine(loop_index_, loop_index_ - 1);
-    } else {
-      uint32_t line1 = pImage->GetPixel(1, loop_index_ - 1);
-      line1 |= pImage->GetPixel(0, loop_index_ - 1) << 1;
-      uint32_t line2 = 0;
-      for (uint32_t w = 0; w < GBW; w++) {
-        int bVal;
-        if (USESKIP && SKIP->GetPixel(w, loop_index_)) {
-          bVal = 0;
-        } else {
-          uint32_t CONTEXT = line2;
-          CONTEXT |= pImage->GetPixel(w + GBAT[0], loop_index_ + GBAT[1]) << 4;
-          CONTEXT |= line1 << 5;
-          if (pArithDecoder->IsComplete()) {
-            return FXCODEC_STATUS::kError;
-          }
-
-          bVal = pArithDecoder->Decode(&gbContexts[CONTEXT]);
-        }
-        if (bVal) {
-          pImage->SetPixel(w, loop_index_, bVal);
-        }
-        line1 =
-            ((line1 << 1) | pImage->GetPixel(w + 2, loop_index_ - 1)) & 0x1f;
-        line2 = ((line2 << 1) | bVal) & 0x0f;
-      }
-    }
-    if (pState->pPause && pState->pPause->NeedToPauseNow()) {
-      loop_index_++;
-      progressive_status_ = FXCODEC_STATUS::kDecodeToBeContinued;
-      return FXCODEC_STATUS::kDecodeToBeContinued;
-    }
-  }
-  progressive_status_ = FXCODEC_STATUS::kDecodeFinished;
-  return FXCODEC_STATUS::kDecodeFinished;
-}
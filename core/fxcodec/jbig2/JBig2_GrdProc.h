@@ -16,7 +16,6 @@
 #include "core/fxcrt/fx_coordinates.h"
 #include "core/fxcrt/span.h"
 #include "core/fxcrt/unowned_ptr.h"
-#include "core/fxcrt/unowned_ptr_exclusion.h"
 
 class CJBig2_ArithDecoder;
 class CJBig2_BitStream;
@@ -60,45 +59,9 @@ class CJBig2_GRDProc {
   std::array<int8_t, 8> GBAT;
 
  private:
-  bool UseTemplate0Opt3() const;
-  bool UseTemplate1Opt3() const;
-  bool UseTemplate23Opt3() const;
-
   FXCODEC_STATUS ProgressiveDecodeArith(ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate0Opt3(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate0Unopt(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate1Opt3(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate1Unopt(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate2Opt3(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate2Unopt(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate3Opt3(
-      ProgressiveArithDecodeState* pState);
-  FXCODEC_STATUS ProgressiveDecodeArithTemplate3Unopt(
-      ProgressiveArithDecodeState* pState);
-
-  std::unique_ptr<CJBig2_Image> DecodeArithOpt3(
-      CJBig2_ArithDecoder* pArithDecoder,
-      pdfium::span<JBig2ArithCtx> gbContexts,
-      int OPT);
-  std::unique_ptr<CJBig2_Image> DecodeArithTemplateUnopt(
-      CJBig2_ArithDecoder* pArithDecoder,
-      pdfium::span<JBig2ArithCtx> gbContexts,
-      int UNOPT);
-  std::unique_ptr<CJBig2_Image> DecodeArithTemplate3Opt3(
-      CJBig2_ArithDecoder* pArithDecoder,
-      pdfium::span<JBig2ArithCtx> gbContexts);
-  std::unique_ptr<CJBig2_Image> DecodeArithTemplate3Unopt(
-      CJBig2_ArithDecoder* pArithDecoder,
-      pdfium::span<JBig2ArithCtx> gbContexts);
 
   uint32_t loop_index_ = 0;
-  UNOWNED_PTR_EXCLUSION uint8_t* line_ = nullptr;
   FXCODEC_STATUS progressive_status_;
   uint16_t decode_type_ = 0;
   int ltp_ = 0;
@@ -0,0 +1,255 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/jbig2/JBig2_GrdProc.h"
+
+#include <stdint.h>
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/fxcodec/jbig2/JBig2_ArithDecoder.h"
+#include "core/fxcodec/jbig2/JBig2_BitStream.h"
+#include "core/fxcodec/jbig2/JBig2_Image.h"
+#include "core/fxcrt/pauseindicator_iface.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+using PixelOffset = std::pair<int, int>;
+
+// The context pixels of each template from Figures 3 to 6 of the JBIG2 spec,
+// starting with the least significant bit. {0, 0} stands for the next AT
+// pixel.
+const std::vector<PixelOffset> kTemplatePixels[] = {
+    {{-1, 0},
+     {-2, 0},
+     {-3, 0},
+     {-4, 0},
+     {0, 0},
+     {2, -1},
+     {1, -1},
+     {0, -1},
+     {-1, -1},
+     {-2, -1},
+     {0, 0},
+     {0, 0},
+     {1, -2},
+     {0, -2},
+     {-1, -2},
+     {0, 0}},
+    {{-1, 0},
+     {-2, 0},
+     {-3, 0},
+     {0, 0},
+     {2, -1},
+     {1, -1},
+     {0, -1},
+     {-1, -1},
+     {-2, -1},
+     {2, -2},
+     {1, -2},
+     {0, -2},
+     {-1, -2}},
+    {{-1, 0},
+     {-2, 0},
+     {0, 0},
+     {1, -1},
+     {0, -1},
+     {-1, -1},
+     {-2, -1},
+     {1, -2},
+     {0, -2},
+     {-1, -2}},
+    {{-1, 0},
+     {-2, 0},
+     {-3, 0},
+     {-4, 0},
+     {0, 0},
+     {1, -1},
+     {0, -1},
+     {-1, -1},
+     {-2, -1},
+     {-3, -1}},
+};
+
+constexpr uint16_t kTpgdonContexts[] = {0x9b25, 0x0795, 0x00e5, 0x0195};
+
+// Deterministic filler so that failures are reproducible.
+class TestData {
+ public:
+  uint32_t Next() {
+    state_ = state_ * 1103515245 + 12345;
+    return state_ >> 8;
+  }
+
+  // Avoids 0xff, so that the arithmetic decoder does not find a marker and
+  // stop early.
+  std::vector<uint8_t> Bytes(size_t count) {
+    std::vector<uint8_t> result(count);
+    for (uint8_t& byte : result) {
+      byte = static_cast<uint8_t>(Next() % 255);
+    }
+    return result;
+  }
+
+ private:
+  uint32_t state_ = 1;
+};
+
+// Decodes one pixel at a time as in 6.2.5.7 of the JBIG2 spec.
+std::unique_ptr<CJBig2_Image> ReferenceDecode(
+    const CJBig2_GRDProc& grd,
+    CJBig2_ArithDecoder* arith_decoder,
+    pdfium::span<JBig2ArithCtx> contexts) {
+  auto image = std::make_unique<CJBig2_Image>(grd.GBW, grd.GBH);
+  image->Fill(false);
+  const int width = static_cast<int>(grd.GBW);
+  const int height = static_cast<int>(grd.GBH);
+  int ltp = 0;
+  for (int y = 0; y < height; ++y) {
+    if (grd.TPGDON) {
+      ltp ^= arith_decoder->Decode(&contexts[kTpgdonContexts[grd.GBTEMPLATE]]);
+    }
+    if (ltp) {
+      image->CopyLine(y, y - 1);
+      continue;
+    }
+    for (int x = 0; x < width; ++x) {
+      if (grd.USESKIP && grd.SKIP->GetPixel(x, y)) {
+        continue;
+      }
+      uint32_t context = 0;
+      size_t at_index = 0;
+      const std::vector<PixelOffset>& pixels =
+          kTemplatePixels[grd.GBTEMPLATE];
+      for (size_t bit = 0; bit < pixels.size(); ++bit) {
+        PixelOffset offset = pixels[bit];
+        if (offset == PixelOffset(0, 0)) {
+          offset = {grd.GBAT[2 * at_index], grd.GBAT[2 * at_index + 1]};
+          ++at_index;
+        }
+        context |= image->GetPixel(x + offset.first, y + offset.second)
+                   << bit;
+      }
+      image->SetPixel(x, y, arith_decoder->Decode(&contexts[context]));
+    }
+  }
+  return image;
+}
+
+void ExpectImagesEqual(const CJBig2_Image& expected,
+                       const CJBig2_Image& actual) {
+  ASSERT_EQ(expected.width(), actual.width());
+  ASSERT_EQ(expected.height(), actual.height());
+  for (int32_t y = 0; y < expected.height(); ++y) {
+    for (int32_t x = 0; x < expected.width(); ++x) {
+      ASSERT_EQ(expected.GetPixel(x, y), actual.GetPixel(x, y))
+          << "at " << x << " " << y;
+    }
+  }
+}
+
+class AlwaysPause final : public PauseIndicatorIface {
+ public:
+  bool NeedToPauseNow() override { return true; }
+};
+
+struct GrdParams {
+  uint8_t gbtemplate;
+  std::array<int8_t, 8> gbat;
+};
+
+const GrdParams kParams[] = {
+    // Nominal AT pixels.
+    {0, {3, -1, -3, -1, 2, -2, -2, -2}},
+    {1, {3, -1, 0, 0, 0, 0, 0, 0}},
+    {2, {2, -1, 0, 0, 0, 0, 0, 0}},
+    {3, {2, -1, 0, 0, 0, 0, 0, 0}},
+    // AT pixels on the current row, including undecoded ones and ones far to
+    // the left, and on rows the templates do not otherwise use.
+    {0, {-1, 0, -70, 0, 5, 0, -128, -128}},
+    {0, {-100, -1, 100, -2, 0, -3, 127, -1}},
+    {1, {-65, 0, 0, 0, 0, 0, 0, 0}},
+    {1, {-128, -1, 0, 0, 0, 0, 0, 0}},
+    {2, {60, -2, 0, 0, 0, 0, 0, 0}},
+    {2, {-4, -5, 0, 0, 0, 0, 0, 0}},
+    {3, {-3, -2, 0, 0, 0, 0, 0, 0}},
+    {3, {-64, 0, 0, 0, 0, 0, 0, 0}},
+};
+
+}  // namespace
+
+TEST(CJBig2GRDProc, DecodeArith) {
+  TestData data;
+  for (const GrdParams& params : kParams) {
+    for (uint32_t width : {1u, 7u, 31u, 32u, 33u, 64u, 100u, 257u}) {
+      for (bool tpgdon : {false, true}) {
+        for (bool use_skip : {false, true}) {
+          SCOPED_TRACE(testing::Message()
+                       << static_cast<int>(params.gbtemplate) << " " << width
+                       << " " << tpgdon << " " << use_skip);
+          const std::vector<uint8_t> encoded = data.Bytes(2000);
+          CJBig2_Image skip(width, 20);
+          for (int32_t y = 0; y < skip.height(); ++y) {
+            for (int32_t x = 0; x < skip.width(); ++x) {
+              skip.SetPixel(x, y, data.Next() % 4 == 0);
+            }
+          }
+
+          CJBig2_GRDProc grd;
+          grd.MMR = false;
+          grd.TPGDON = tpgdon;
+          grd.USESKIP = use_skip;
+          grd.GBTEMPLATE = params.gbtemplate;
+          grd.GBW = width;
+          grd.GBH = 20;
+          grd.SKIP = &skip;
+          grd.GBAT = params.gbat;
+
+          std::vector<JBig2ArithCtx> expected_contexts(65536);
+          CJBig2_BitStream expected_stream(encoded, 0);
+          CJBig2_ArithDecoder expected_decoder(&expected_stream);
+          std::unique_ptr<CJBig2_Image> expected =
+              ReferenceDecode(grd, &expected_decoder, expected_contexts);
+          ASSERT_FALSE(expected_decoder.IsComplete());
+
+          std::vector<JBig2ArithCtx> contexts(65536);
+          CJBig2_BitStream stream(encoded, 0);
+          CJBig2_ArithDecoder decoder(&stream);
+          std::unique_ptr<CJBig2_Image> image =
+              grd.DecodeArith(&decoder, contexts);
+          ASSERT_TRUE(image);
+          ExpectImagesEqual(*expected, *image);
+
+          // Decoding progressively, one row at a time, gives the same result.
+          std::vector<JBig2ArithCtx> progressive_contexts(65536);
+          CJBig2_BitStream progressive_stream(encoded, 0);
+          CJBig2_ArithDecoder progressive_decoder(&progressive_stream);
+          std::unique_ptr<CJBig2_Image> progressive_image;
+          AlwaysPause pause;
+          CJBig2_GRDProc::ProgressiveArithDecodeState state;
+          state.pImage = &progressive_image;
+          state.pArithDecoder = &progressive_decoder;
+          state.gbContexts = progressive_contexts;
+          state.pPause = &pause;
+          FXCODEC_STATUS status = grd.StartDecodeArith(&state);
+          uint32_t rows = 0;
+          while (status == FXCODEC_STATUS::kDecodeToBeContinued) {
+            ++rows;
+            EXPECT_EQ(static_cast<int32_t>(rows),
+                      grd.GetReplaceRect().bottom);
+            status = grd.ContinueDecode(&state);
+          }
+          EXPECT_EQ(FXCODEC_STATUS::kDecodeFinished, status);
+          EXPECT_EQ(grd.GBH, rows);
+          ASSERT_TRUE(progressive_image);
+          ExpectImagesEqual(*expected, *progressive_image);
+        }
+      }
+    }
+  }
+}
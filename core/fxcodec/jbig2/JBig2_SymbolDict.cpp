@@ -22,3 +22,17 @@ std::unique_ptr<CJBig2_SymbolDict> CJBig2_SymbolDict::DeepCopy() const {
   dst->gr_contexts_ = gr_contexts_;
   return dst;
 }
+
+size_t CJBig2_SymbolDict::GetMemorySize() const {
+  size_t size = sizeof(*this) +
+                (gb_contexts_.size() + gr_contexts_.size()) *
+                    sizeof(JBig2ArithCtx) +
+                sdexsyms_.size() * sizeof(std::unique_ptr<CJBig2_Image>);
+  for (const auto& image : sdexsyms_) {
+    if (image) {
+      size += sizeof(CJBig2_Image) + static_cast<size_t>(image->stride()) *
+                                         static_cast<size_t>(image->height());
+    }
+  }
+  return size;
+}
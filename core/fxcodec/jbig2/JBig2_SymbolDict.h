@@ -7,6 +7,8 @@
 #ifndef CORE_FXCODEC_JBIG2_JBIG2_SYMBOLDICT_H_
 #define CORE_FXCODEC_JBIG2_JBIG2_SYMBOLDICT_H_
 
+#include <stddef.h>
+
 #include <memory>
 #include <utility>
 #include <vector>
@@ -22,6 +24,9 @@ class CJBig2_SymbolDict {
 
   std::unique_ptr<CJBig2_SymbolDict> DeepCopy() const;
 
+  // Returns roughly how many bytes the dictionary takes up.
+  size_t GetMemorySize() const;
+
   void AddImage(std::unique_ptr<CJBig2_Image> image) {
     sdexsyms_.push_back(std::move(image));
   }
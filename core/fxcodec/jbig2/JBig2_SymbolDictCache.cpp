@@ -0,0 +1,70 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/jbig2/JBig2_SymbolDictCache.h"
+
+#include "core/fxcodec/jbig2/JBig2_Image.h"
+#include "core/fxcodec/jbig2/JBig2_SymbolDict.h"
+#include "core/fxcrt/check.h"
+
+CJBig2_SymbolDictCache::Entry::Entry(const CJBig2_CompoundKey& key,
+                                     std::unique_ptr<CJBig2_SymbolDict> dict,
+                                     size_t bytes)
+    : key(key), dict(std::move(dict)), bytes(bytes) {}
+
+CJBig2_SymbolDictCache::Entry::~Entry() = default;
+
+CJBig2_SymbolDictCache::CJBig2_SymbolDictCache(size_t max_bytes)
+    : max_bytes_(max_bytes) {}
+
+CJBig2_SymbolDictCache::~CJBig2_SymbolDictCache() = default;
+
+std::unique_ptr<CJBig2_SymbolDict> CJBig2_SymbolDictCache::Lookup(
+    const CJBig2_CompoundKey& key) {
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->dict->DeepCopy();
+}
+
+void CJBig2_SymbolDictCache::Insert(const CJBig2_CompoundKey& key,
+                                    std::unique_ptr<CJBig2_SymbolDict> dict) {
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    stats_.bytes -= it->second->bytes;
+    --stats_.entries;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+  const size_t bytes = dict->GetMemorySize();
+  if (bytes > max_bytes_) {
+    return;
+  }
+  EvictUntilFits(max_bytes_ - bytes);
+  entries_.emplace_front(key, std::move(dict), bytes);
+  index_[key] = entries_.begin();
+  stats_.bytes += bytes;
+  ++stats_.entries;
+}
+
+void CJBig2_SymbolDictCache::SetMaxBytes(size_t max_bytes) {
+  max_bytes_ = max_bytes;
+  EvictUntilFits(max_bytes_);
+}
+
+void CJBig2_SymbolDictCache::EvictUntilFits(size_t max_bytes) {
+  while (stats_.bytes > max_bytes) {
+    DCHECK(!entries_.empty());
+    const Entry& entry = entries_.back();
+    stats_.bytes -= entry.bytes;
+    --stats_.entries;
+    ++stats_.evictions;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
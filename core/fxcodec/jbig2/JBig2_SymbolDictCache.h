@@ -0,0 +1,75 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FXCODEC_JBIG2_JBIG2_SYMBOLDICTCACHE_H_
+#define CORE_FXCODEC_JBIG2_JBIG2_SYMBOLDICTCACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+
+class CJBig2_SymbolDict;
+
+// Cache is keyed by both the key of a stream and an index within the stream.
+using CJBig2_CompoundKey = std::pair<uint64_t, uint32_t>;
+
+// Least recently used (LRU) cache of decoded symbol dictionaries. It is very
+// common for a JBIG2 dictionary in the JBIG2Globals stream to be shared by
+// every page of a scanned document, so the cache holds as many dictionaries
+// as fit into its memory budget rather than a fixed number of them.
+class CJBig2_SymbolDictCache {
+ public:
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+  };
+
+  static constexpr size_t kDefaultMaxBytes = 32 * 1024 * 1024;
+
+  explicit CJBig2_SymbolDictCache(size_t max_bytes = kDefaultMaxBytes);
+  ~CJBig2_SymbolDictCache();
+
+  // Returns a copy of the dictionary for `key`, or nullptr if it is not
+  // cached.
+  std::unique_ptr<CJBig2_SymbolDict> Lookup(const CJBig2_CompoundKey& key);
+
+  // Caches `dict` for `key`, evicting the least recently used dictionaries as
+  // needed. Dictionaries larger than the whole budget are not cached.
+  void Insert(const CJBig2_CompoundKey& key,
+              std::unique_ptr<CJBig2_SymbolDict> dict);
+
+  // Evicts dictionaries until the cache fits into `max_bytes`.
+  void SetMaxBytes(size_t max_bytes);
+
+  const Stats& GetStats() const { return stats_; }
+
+ private:
+  struct Entry {
+    Entry(const CJBig2_CompoundKey& key,
+          std::unique_ptr<CJBig2_SymbolDict> dict,
+          size_t bytes);
+    ~Entry();
+
+    const CJBig2_CompoundKey key;
+    const std::unique_ptr<CJBig2_SymbolDict> dict;
+    const size_t bytes;
+  };
+
+  void EvictUntilFits(size_t max_bytes);
+
+  size_t max_bytes_;
+  Stats stats_;
+  // Freshest entries at the front.
+  std::list<Entry> entries_;
+  std::map<CJBig2_CompoundKey, std::list<Entry>::iterator> index_;
+};
+
+#endif  // CORE_FXCODEC_JBIG2_JBIG2_SYMBOLDICTCACHE_H_
@@ -0,0 +1,115 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/jbig2/JBig2_SymbolDictCache.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+
+#include "core/fxcodec/jbig2/JBig2_Image.h"
+#include "core/fxcodec/jbig2/JBig2_SymbolDict.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Returns a dictionary with one `width` x 10 symbol, whose top left pixel is
+// set when `marked`.
+std::unique_ptr<CJBig2_SymbolDict> CreateDict(int32_t width, bool marked) {
+  auto image = std::make_unique<CJBig2_Image>(width, 10);
+  image->Fill(false);
+  image->SetPixel(0, 0, marked);
+  auto dict = std::make_unique<CJBig2_SymbolDict>();
+  dict->AddImage(std::move(image));
+  return dict;
+}
+
+}  // namespace
+
+TEST(CJBig2SymbolDictCache, LookupReturnsCopy) {
+  CJBig2_SymbolDictCache cache;
+  const CJBig2_CompoundKey key(1, 0);
+  EXPECT_FALSE(cache.Lookup(key));
+
+  cache.Insert(key, CreateDict(100, true));
+  std::unique_ptr<CJBig2_SymbolDict> dict = cache.Lookup(key);
+  ASSERT_TRUE(dict);
+  ASSERT_EQ(1u, dict->NumImages());
+  EXPECT_EQ(100, dict->GetImage(0)->width());
+  EXPECT_EQ(1, dict->GetImage(0)->GetPixel(0, 0));
+
+  // Changing the copy does not affect the cached dictionary.
+  dict->GetImage(0)->SetPixel(0, 0, false);
+  dict = cache.Lookup(key);
+  ASSERT_TRUE(dict);
+  EXPECT_EQ(1, dict->GetImage(0)->GetPixel(0, 0));
+
+  // Keys differing only in the offset within the stream are distinct.
+  EXPECT_FALSE(cache.Lookup(CJBig2_CompoundKey(1, 1)));
+
+  const CJBig2_SymbolDictCache::Stats& stats = cache.GetStats();
+  EXPECT_EQ(2u, stats.hits);
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(0u, stats.evictions);
+  EXPECT_EQ(1u, stats.entries);
+  EXPECT_EQ(CreateDict(100, true)->GetMemorySize(), stats.bytes);
+}
+
+TEST(CJBig2SymbolDictCache, EvictsLeastRecentlyUsed) {
+  const size_t dict_size = CreateDict(800, false)->GetMemorySize();
+  CJBig2_SymbolDictCache cache(3 * dict_size);
+  for (uint64_t i = 1; i <= 3; ++i) {
+    cache.Insert(CJBig2_CompoundKey(i, 0), CreateDict(800, false));
+  }
+  EXPECT_EQ(3u, cache.GetStats().entries);
+  EXPECT_EQ(3 * dict_size, cache.GetStats().bytes);
+
+  // Using the oldest entry makes the second one the least recently used.
+  EXPECT_TRUE(cache.Lookup(CJBig2_CompoundKey(1, 0)));
+  cache.Insert(CJBig2_CompoundKey(4, 0), CreateDict(800, false));
+  EXPECT_EQ(1u, cache.GetStats().evictions);
+  EXPECT_EQ(3u, cache.GetStats().entries);
+  EXPECT_TRUE(cache.Lookup(CJBig2_CompoundKey(1, 0)));
+  EXPECT_FALSE(cache.Lookup(CJBig2_CompoundKey(2, 0)));
+  EXPECT_TRUE(cache.Lookup(CJBig2_CompoundKey(3, 0)));
+  EXPECT_TRUE(cache.Lookup(CJBig2_CompoundKey(4, 0)));
+
+  // A larger dictionary pushes out as many entries as needed.
+  const size_t large_size = CreateDict(2400, false)->GetMemorySize();
+  ASSERT_GT(large_size, 2 * dict_size);
+  ASSERT_LE(large_size, 3 * dict_size);
+  cache.Insert(CJBig2_CompoundKey(5, 0), CreateDict(2400, false));
+  EXPECT_EQ(1u, cache.GetStats().entries);
+  EXPECT_EQ(large_size, cache.GetStats().bytes);
+  EXPECT_EQ(4u, cache.GetStats().evictions);
+
+  cache.SetMaxBytes(0);
+  EXPECT_EQ(0u, cache.GetStats().entries);
+  EXPECT_EQ(0u, cache.GetStats().bytes);
+  EXPECT_FALSE(cache.Lookup(CJBig2_CompoundKey(5, 0)));
+}
+
+TEST(CJBig2SymbolDictCache, TooLarge) {
+  const size_t dict_size = CreateDict(100, false)->GetMemorySize();
+  CJBig2_SymbolDictCache cache(dict_size);
+  cache.Insert(CJBig2_CompoundKey(1, 0), CreateDict(100, false));
+  cache.Insert(CJBig2_CompoundKey(2, 0), CreateDict(200, false));
+  EXPECT_TRUE(cache.Lookup(CJBig2_CompoundKey(1, 0)));
+  EXPECT_FALSE(cache.Lookup(CJBig2_CompoundKey(2, 0)));
+  EXPECT_EQ(0u, cache.GetStats().evictions);
+}
+
+TEST(CJBig2SymbolDictCache, Replace) {
+  CJBig2_SymbolDictCache cache;
+  const CJBig2_CompoundKey key(1, 0);
+  cache.Insert(key, CreateDict(100, false));
+  cache.Insert(key, CreateDict(200, true));
+  EXPECT_EQ(1u, cache.GetStats().entries);
+  EXPECT_EQ(CreateDict(200, true)->GetMemorySize(), cache.GetStats().bytes);
+  std::unique_ptr<CJBig2_SymbolDict> dict = cache.Lookup(key);
+  ASSERT_TRUE(dict);
+  EXPECT_EQ(200, dict->GetImage(0)->width());
+}
@@ -5,6 +5,7 @@
 #include "public/cpp/fpdf_scopers.h"
 #include "testing/embedder_test.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/utils/benchmark_timer.h"
 
 class JBig2EmbedderTest : public EmbedderTest {};
 
@@ -23,3 +24,31 @@ TEST_F(JBig2EmbedderTest, MAYBE_Bug631912) {
   ScopedFPDFBitmap bitmap = RenderLoadedPage(page.get());
   CompareBitmap(bitmap.get(), 691, 432, "726c2b8c89df0ab40627322d1dddd521");
 }
+
+// Not run by default. Use --gtest_also_run_disabled_tests to time loading and
+// rendering the JBIG2 test documents, which is dominated by decoding their
+// generic regions.
+TEST_F(JBig2EmbedderTest, DISABLED_DecodeBenchmark) {
+  static constexpr int kIterations = 20;
+  static constexpr const char* kFiles[] = {
+      "bug_552046.pdf",
+      "bug_631912.pdf",
+      "bug_674771.pdf",
+      "pixel/bug_867501.pdf",
+      "pixel/bug_1087.pdf",
+  };
+  for (const char* file : kFiles) {
+    ScopedBenchmarkTimer timer(file, kIterations);
+    for (int i = 0; i < kIterations; ++i) {
+      // Reopen the document every time, so that nothing decoded is cached.
+      ASSERT_TRUE(OpenDocument(file));
+      for (int page_index = 0; page_index < GetPageCount(); ++page_index) {
+        ScopedPage page = LoadScopedPage(page_index);
+        ASSERT_TRUE(page);
+        ScopedFPDFBitmap bitmap = RenderLoadedPage(page.get());
+        ASSERT_TRUE(bitmap);
+      }
+      CloseDocument();
+    }
+  }
+}
@@ -45,6 +45,25 @@ int jpeg_common_read_scanlines(JpegCommon* jpeg_common,
   return jpeg_read_scanlines(&jpeg_common->cinfo, buf, count);
 }
 
+#if defined(LIBJPEG_TURBO_VERSION)
+boolean jpeg_common_crop_scanline(JpegCommon* jpeg_common,
+                                  JDIMENSION* xoffset,
+                                  JDIMENSION* width) {
+  if (setjmp(jpeg_common->jmpbuf) == -1) {
+    return FALSE;
+  }
+  jpeg_crop_scanline(&jpeg_common->cinfo, xoffset, width);
+  return TRUE;
+}
+
+int jpeg_common_skip_scanlines(JpegCommon* jpeg_common, JDIMENSION count) {
+  if (setjmp(jpeg_common->jmpbuf) == -1) {
+    return -1;
+  }
+  return jpeg_skip_scanlines(&jpeg_common->cinfo, count);
+}
+#endif
+
 void jpeg_common_src_do_nothing(j_decompress_ptr cinfo) {}
 
 boolean jpeg_common_src_fill_buffer(j_decompress_ptr cinfo) {
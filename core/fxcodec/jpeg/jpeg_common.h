@@ -49,6 +49,12 @@ int jpeg_common_read_header(JpegCommon* jpeg_common, boolean flag);
 int jpeg_common_read_scanlines(JpegCommon* jpeg_common,
                                void* buf,
                                unsigned int count);
+#if defined(LIBJPEG_TURBO_VERSION)
+boolean jpeg_common_crop_scanline(JpegCommon* jpeg_common,
+                                  JDIMENSION* xoffset,
+                                  JDIMENSION* width);
+int jpeg_common_skip_scanlines(JpegCommon* jpeg_common, JDIMENSION count);
+#endif
 
 //  Callbacks.
 void jpeg_common_src_do_nothing(j_decompress_ptr cinfo);
@@ -6,6 +6,8 @@
 
 #include "core/fxcodec/jpeg/jpegmodule.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <type_traits>
@@ -81,6 +83,8 @@ namespace {
 
 constexpr size_t kKnownBadHeaderWithInvalidHeightByteOffsetStarts[] = {94, 163};
 
+std::atomic<size_t> g_decoded_line_count = 0;
+
 class JpegDecoder final : public ScanlineDecoder {
  public:
   JpegDecoder();
@@ -90,17 +94,21 @@ class JpegDecoder final : public ScanlineDecoder {
               uint32_t width,
               uint32_t height,
               int nComps,
-              bool ColorTransform);
+              bool ColorTransform,
+              uint8_t resolution_levels_to_skip,
+              const FX_RECT& decode_area);
 
   // ScanlineDecoder:
   [[nodiscard]] bool Rewind() override;
   pdfium::span<uint8_t> GetNextLine() override;
+  void SkipNextLines(int count) override;
   uint32_t GetSrcOffset() override;
 
   bool InitDecode(bool bAcceptKnownBadHeader);
 
  private:
   void CalcPitch();
+  void CalcOutputSize();
   void InitDecompressSrc();
 
   // Only called when initial jpeg_read_header() fails.
@@ -128,7 +136,15 @@ class JpegDecoder final : public ScanlineDecoder {
   bool decompress_created_ = false;
   bool started_ = false;
   bool jpeg_transform_ = false;
-  uint32_t default_scale_denom_ = 1;
+  unsigned int scale_denom_ = 1;
+  // Columns to decode at the output size, or all when `crop_right_` is 0.
+  uint32_t crop_left_ = 0;
+  uint32_t crop_right_ = 0;
+  // Where the decoded columns start after libjpeg aligned the crop.
+  uint32_t decoded_left_ = 0;
+  // Set when libjpeg failed while skipping lines, which leaves it in an
+  // unknown state, so no more lines get decoded until Rewind().
+  bool skip_failed_ = false;
 };
 
 JpegDecoder::JpegDecoder() = default;
@@ -191,9 +207,7 @@ bool JpegDecoder::InitDecode(bool bAcceptKnownBadHeader) {
 
   orig_width_ = common_.cinfo.image_width;
   orig_height_ = common_.cinfo.image_height;
-  output_width_ = orig_width_;
-  output_height_ = orig_height_;
-  default_scale_denom_ = common_.cinfo.scale_denom;
+  CalcOutputSize();
   return true;
 }
 
@@ -201,7 +215,10 @@ bool JpegDecoder::Create(pdfium::span<const uint8_t> src_span,
                          uint32_t width,
                          uint32_t height,
                          int nComps,
-                         bool ColorTransform) {
+                         bool ColorTransform,
+                         uint8_t resolution_levels_to_skip,
+                         const FX_RECT& decode_area) {
+  CHECK_LE(resolution_levels_to_skip, JpegModule::kMaxResolutionLevelsToSkip);
   src_span_ = JpegScanSOI(src_span);
   if (src_span_.size() < 2) {
     return false;
@@ -220,6 +237,7 @@ bool JpegDecoder::Create(pdfium::span<const uint8_t> src_span,
   common_.source_mgr.fill_input_buffer = jpeg_common_src_fill_buffer;
   common_.source_mgr.resync_to_restart = jpeg_common_src_resync;
   jpeg_transform_ = ColorTransform;
+  scale_denom_ = 1u << resolution_levels_to_skip;
   output_width_ = orig_width_ = width;
   output_height_ = orig_height_ = height;
   if (!InitDecode(/*bAcceptKnownBadHeader=*/true)) {
@@ -234,6 +252,20 @@ bool JpegDecoder::Create(pdfium::span<const uint8_t> src_span,
     return false;
   }
 
+  if (!decode_area.IsEmpty()) {
+    const uint32_t left =
+        static_cast<uint32_t>(std::max(decode_area.left, 0)) / scale_denom_;
+    const uint32_t right = std::min<uint32_t>(
+        (static_cast<uint32_t>(std::max(decode_area.right, 0)) +
+         scale_denom_ - 1) /
+            scale_denom_,
+        output_width_);
+    if (left < right && right - left < static_cast<uint32_t>(output_width_)) {
+      crop_left_ = left;
+      crop_right_ = right;
+    }
+  }
+
   CalcPitch();
   scanline_buf_ = DataVector<uint8_t>(pitch_);
   comps_ = common_.cinfo.num_components;
@@ -249,27 +281,68 @@ bool JpegDecoder::Rewind() {
       return false;
     }
   }
-  common_.cinfo.scale_denom = default_scale_denom_;
-  output_width_ = orig_width_;
-  output_height_ = orig_height_;
+  common_.cinfo.scale_num = 1;
+  common_.cinfo.scale_denom = scale_denom_;
+  CalcOutputSize();
   if (!jpeg_common_start_decompress(&common_)) {
     jpeg_common_destroy_decompress(&common_);
     return false;
   }
-  CHECK_LE(static_cast<int>(common_.cinfo.output_width), orig_width_);
+  CHECK_LE(static_cast<int>(common_.cinfo.output_width), output_width_);
+  decoded_left_ = 0;
+#if defined(LIBJPEG_TURBO_VERSION)
+  if (crop_right_) {
+    JDIMENSION xoffset = crop_left_;
+    JDIMENSION width = crop_right_ - crop_left_;
+    if (!jpeg_common_crop_scanline(&common_, &xoffset, &width)) {
+      jpeg_common_destroy_decompress(&common_);
+      return false;
+    }
+    decoded_left_ = xoffset;
+  }
+#endif
+  skip_failed_ = false;
   started_ = true;
   return true;
 }
 
 pdfium::span<uint8_t> JpegDecoder::GetNextLine() {
-  uint8_t* row_array[] = {scanline_buf_.data()};
+  if (skip_failed_) {
+    return pdfium::span<uint8_t>();
+  }
+
+  // Cropped lines land at their usual place, so other columns keep zeros.
+  pdfium::span<uint8_t> decoded_columns = pdfium::span(scanline_buf_).subspan(
+      decoded_left_ * common_.cinfo.output_components,
+      common_.cinfo.output_width * common_.cinfo.output_components);
+  uint8_t* row_array[] = {decoded_columns.data()};
   int nlines = jpeg_common_read_scanlines(&common_, row_array, 1u);
   if (nlines <= 0) {
     return pdfium::span<uint8_t>();
   }
+  ++g_decoded_line_count;
   return scanline_buf_;
 }
 
+void JpegDecoder::SkipNextLines(int count) {
+#if defined(LIBJPEG_TURBO_VERSION)
+  // Skipped lines still need entropy decoding, but not the inverse DCT,
+  // upsampling or color conversion.
+  const int skipped = jpeg_common_skip_scanlines(&common_, count);
+  if (skipped < 0) {
+    skip_failed_ = true;
+    return;
+  }
+  if (skipped < count) {
+    // libjpeg stopped early, e.g. at the end of the data. Decode the rest as
+    // usual, which copes with that the same way as when not skipping.
+    ScanlineDecoder::SkipNextLines(count - skipped);
+  }
+#else
+  ScanlineDecoder::SkipNextLines(count);
+#endif
+}
+
 uint32_t JpegDecoder::GetSrcOffset() {
   return static_cast<uint32_t>(src_span_.size() -
                                common_.source_mgr.bytes_in_buffer);
@@ -283,6 +356,16 @@ void JpegDecoder::CalcPitch() {
   pitch_ *= 4;
 }
 
+void JpegDecoder::CalcOutputSize() {
+  // Matches how libjpeg rounds the output size when DCT scaling.
+  output_width_ = static_cast<int>(
+      (static_cast<unsigned int>(orig_width_) + scale_denom_ - 1) /
+      scale_denom_);
+  output_height_ = static_cast<int>(
+      (static_cast<unsigned int>(orig_height_) + scale_denom_ - 1) /
+      scale_denom_);
+}
+
 void JpegDecoder::InitDecompressSrc() {
   common_.cinfo.src = &common_.source_mgr;
   common_.source_mgr.bytes_in_buffer = src_span_.size();
@@ -354,11 +437,14 @@ std::unique_ptr<ScanlineDecoder> JpegModule::CreateDecoder(
     uint32_t width,
     uint32_t height,
     int nComps,
-    bool ColorTransform) {
+    bool ColorTransform,
+    uint8_t resolution_levels_to_skip,
+    const FX_RECT& decode_area) {
   DCHECK(!src_span.empty());
 
   auto pDecoder = std::make_unique<JpegDecoder>();
-  if (!pDecoder->Create(src_span, width, height, nComps, ColorTransform)) {
+  if (!pDecoder->Create(src_span, width, height, nComps, ColorTransform,
+                        resolution_levels_to_skip, decode_area)) {
     return nullptr;
   }
 
@@ -376,6 +462,11 @@ std::optional<JpegModule::ImageInfo> JpegModule::LoadInfo(
   return info;
 }
 
+// static
+size_t JpegModule::GetDecodedLineCountForTesting() {
+  return g_decoded_line_count;
+}
+
 #if BUILDFLAG(IS_WIN)
 bool JpegModule::JpegEncode(const RetainPtr<const CFX_DIBBase>& pSource,
                             uint8_t** dest_buf,
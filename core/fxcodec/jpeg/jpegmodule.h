@@ -14,6 +14,7 @@
 #include <optional>
 
 #include "build/build_config.h"
+#include "core/fxcrt/fx_coordinates.h"
 #include "core/fxcrt/span.h"
 
 #if BUILDFLAG(IS_WIN)
@@ -37,16 +38,34 @@ class JpegModule {
     bool color_transform;
   };
 
+  // libjpeg can scale images down by up to 1/8 while decoding.
+  static constexpr uint8_t kMaxResolutionLevelsToSkip = 3;
+
+  // Decodes at 1 / 2^`resolution_levels_to_skip` of the full size, rounded
+  // up, using DCT scaling. The decoder's GetWidth() and GetHeight() return
+  // the scaled size. `resolution_levels_to_skip` may be at most
+  // kMaxResolutionLevelsToSkip.
+  //
+  // A non-empty `decode_area`, in pixels of the full size image, allows the
+  // decoder to leave columns outside of it undecoded where libjpeg supports
+  // that. Lines above it are skipped more cheaply, so callers should avoid
+  // requesting lines outside of it.
   static std::unique_ptr<ScanlineDecoder> CreateDecoder(
       pdfium::span<const uint8_t> src_span,
       uint32_t width,
       uint32_t height,
       int nComps,
-      bool ColorTransform);
+      bool ColorTransform,
+      uint8_t resolution_levels_to_skip,
+      const FX_RECT& decode_area);
 
   static std::optional<ImageInfo> LoadInfo(
       pdfium::span<const uint8_t> src_span);
 
+  // Returns how many lines all decoders have decoded in full, as opposed to
+  // skipped.
+  static size_t GetDecodedLineCountForTesting();
+
 #if BUILDFLAG(IS_WIN)
   UNSAFE_BUFFER_USAGE static bool JpegEncode(
       const RetainPtr<const CFX_DIBBase>& pSource,
@@ -0,0 +1,76 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcodec/jpeg/jpegmodule.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "core/fxcodec/scanlinedecoder.h"
+#include "core/fxcrt/fx_coordinates.h"
+#include "core/fxcrt/span.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/utils/file_util.h"
+#include "testing/utils/path_service.h"
+
+namespace {
+
+std::unique_ptr<ScanlineDecoder> CreateDecoder(
+    pdfium::span<const uint8_t> data) {
+  std::optional<JpegModule::ImageInfo> info = JpegModule::LoadInfo(data);
+  if (!info.has_value()) {
+    return nullptr;
+  }
+  return JpegModule::CreateDecoder(data, info->width, info->height,
+                                   info->num_components, info->color_transform,
+                                   /*resolution_levels_to_skip=*/0, FX_RECT());
+}
+
+// Returns the lines of `decoder` decoded one after the other, with empty
+// lines for the ones that fail to decode.
+std::vector<std::vector<uint8_t>> DecodeAllLines(ScanlineDecoder& decoder) {
+  std::vector<std::vector<uint8_t>> lines;
+  for (int y = 0; y < decoder.GetHeight(); ++y) {
+    pdfium::span<const uint8_t> line = decoder.GetScanline(y);
+    lines.emplace_back(line.begin(), line.end());
+  }
+  return lines;
+}
+
+}  // namespace
+
+TEST(JpegModule, SkipLinesInTruncatedData) {
+  std::string path = PathService::GetTestFilePath("mona_lisa.jpg");
+  ASSERT_FALSE(path.empty());
+  const std::vector<uint8_t> contents = GetFileContents(path.c_str());
+  ASSERT_FALSE(contents.empty());
+
+  for (size_t size : {contents.size() / 2, contents.size() * 3 / 4,
+                      contents.size() - 10}) {
+    SCOPED_TRACE(size);
+    // The decoders patch up the end of the data they decode.
+    std::vector<uint8_t> truncated(contents.begin(), contents.begin() + size);
+    std::unique_ptr<ScanlineDecoder> decoder = CreateDecoder(truncated);
+    ASSERT_TRUE(decoder);
+    const std::vector<std::vector<uint8_t>> expected =
+        DecodeAllLines(*decoder);
+
+    // Skipping to a line must give the same result as decoding all the lines
+    // up to it, including past the end of the data.
+    const int height = decoder->GetHeight();
+    for (int line : {1, height / 3, height / 2, height - 1}) {
+      SCOPED_TRACE(line);
+      std::unique_ptr<ScanlineDecoder> skipping_decoder =
+          CreateDecoder(truncated);
+      ASSERT_TRUE(skipping_decoder);
+      pdfium::span<const uint8_t> actual = skipping_decoder->GetScanline(line);
+      EXPECT_EQ(expected[line],
+                std::vector<uint8_t>(actual.begin(), actual.end()));
+    }
+  }
+}
@@ -9,12 +9,14 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "core/fxcodec/jpx/jpx_decode_utils.h"
+#include "core/fxcrt/cfx_threadpool.h"
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/fx_safe_types.h"
 #include "core/fxcrt/numerics/safe_conversions.h"
@@ -32,6 +34,20 @@ namespace fxcodec {
 
 namespace {
 
+// Returns the ParallelFor() grain size for converting an image of `width` x
+// `height` pixels, which keeps small images on the calling thread.
+size_t GetRowsPerRange(uint32_t width, uint32_t height) {
+  return CFX_ThreadPool::ShouldSplitImage(width, height)
+             ? CFX_ThreadPool::kImageRowsPerRange
+             : height;
+}
+
+// Codestreams smaller than this decode too quickly for OpenJPEG's own worker
+// threads, which it starts for every image, to pay off.
+constexpr size_t kMinSizeForDecodeThreads = 64 * 1024;
+
+std::atomic<size_t> g_threaded_decoder_count = 0;
+
 // Used with std::unique_ptr to call opj_image_data_free on raw memory.
 struct OpjImageDataDeleter {
   inline void operator()(void* ptr) const { opj_image_data_free(ptr); }
@@ -106,6 +122,43 @@ pdfium::span<opj_image_comp_t> components_span(opj_image_t* img) {
   return UNSAFE_BUFFERS(pdfium::span(img->comps, img->numcomps));
 }
 
+// Converts `width` x `height` samples from `y`, `cb` and `cr` into `rgb`. Each
+// chroma sample covers `1 << x_shift` columns and `1 << y_shift` rows, and
+// chroma rows are `chroma_width` samples apart. Row bands are converted in
+// parallel.
+void sycc_plane_to_rgb(int offset,
+                       int upb,
+                       const int* y,
+                       const int* cb,
+                       const int* cr,
+                       uint32_t width,
+                       uint32_t height,
+                       uint32_t chroma_width,
+                       int x_shift,
+                       int y_shift,
+                       OpjImageRgbData& rgb) {
+  int* r = rgb.r.get();
+  int* g = rgb.g.get();
+  int* b = rgb.b.get();
+  CFX_ThreadPool::ParallelFor(
+      height, GetRowsPerRange(width, height), [&](size_t begin, size_t end) {
+        // SAFETY: callers ensure that the luma and RGB planes hold `width` x
+        // `height` samples, and that the chroma planes hold all samples that
+        // the subsampling maps them to.
+        UNSAFE_TODO({
+          for (size_t row = begin; row < end; ++row) {
+            const size_t index = row * width;
+            const size_t chroma_index = (row >> y_shift) * chroma_width;
+            for (uint32_t col = 0; col < width; ++col) {
+              const size_t chroma = chroma_index + (col >> x_shift);
+              sycc_to_rgb(offset, upb, y[index + col], cb[chroma], cr[chroma],
+                          &r[index + col], &g[index + col], &b[index + col]);
+            }
+          }
+        });
+      });
+}
+
 void sycc444_to_rgb(opj_image_t* img) {
   auto components = components_span(img);
   int prec = components[0].prec;
@@ -138,13 +191,8 @@ void sycc444_to_rgb(opj_image_t* img) {
     return;
   }
 
-  int* r = data.value().r.get();
-  int* g = data.value().g.get();
-  int* b = data.value().b.get();
-  max_size /= sizeof(int);
-  for (size_t i = 0; i < max_size.ValueOrDie(); ++i) {
-    UNSAFE_TODO(sycc_to_rgb(offset, upb, *y++, *cb++, *cr++, r++, g++, b++));
-  }
+  sycc_plane_to_rgb(offset, upb, y, cb, cr, maxw, maxh, maxw, /*x_shift=*/0,
+                    /*y_shift=*/0, data.value());
   opj_image_data_free(components[0].data);
   opj_image_data_free(components[1].data);
   opj_image_data_free(components[2].data);
@@ -166,10 +214,6 @@ bool sycc420_size_is_valid(pdfium::span<opj_image_comp_t> components) {
          (components[0].h + 1) / 2 == components[1].h;
 }
 
-bool sycc420_must_extend_cbcr(OPJ_UINT32 y, OPJ_UINT32 cbcr) {
-  return (y & 1) && (cbcr == y / 2);
-}
-
 void sycc420_to_rgb(opj_image_t* img) {
   if (!img) {
     return;
@@ -188,10 +232,6 @@ void sycc420_to_rgb(opj_image_t* img) {
   OPJ_UINT32 yw = components[0].w;
   OPJ_UINT32 yh = components[0].h;
   OPJ_UINT32 cbw = components[1].w;
-  OPJ_UINT32 cbh = components[1].h;
-  OPJ_UINT32 crw = components[2].w;
-  bool extw = sycc420_must_extend_cbcr(yw, cbw);
-  bool exth = sycc420_must_extend_cbcr(yh, cbh);
   FX_SAFE_UINT32 safe_size = yw;
   safe_size *= yh;
   safe_size *= sizeof(int);
@@ -211,96 +251,10 @@ void sycc420_to_rgb(opj_image_t* img) {
     return;
   }
 
-  int* r = data.value().r.get();
-  int* g = data.value().g.get();
-  int* b = data.value().b.get();
-  const int* ny = nullptr;
-  int* nr = nullptr;
-  int* ng = nullptr;
-  int* nb = nullptr;
-  OPJ_UINT32 i = 0;
-  OPJ_UINT32 j = 0;
-  UNSAFE_TODO({
-    for (i = 0; i < (yh & ~(OPJ_UINT32)1); i += 2) {
-      ny = y + yw;
-      nr = r + yw;
-      ng = g + yw;
-      nb = b + yw;
-      for (j = 0; j < (yw & ~(OPJ_UINT32)1); j += 2) {
-        sycc_to_rgb(offset, upb, *y, *cb, *cr, r, g, b);
-        ++y;
-        ++r;
-        ++g;
-        ++b;
-        sycc_to_rgb(offset, upb, *y, *cb, *cr, r, g, b);
-        ++y;
-        ++r;
-        ++g;
-        ++b;
-        sycc_to_rgb(offset, upb, *ny, *cb, *cr, nr, ng, nb);
-        ++ny;
-        ++nr;
-        ++ng;
-        ++nb;
-        sycc_to_rgb(offset, upb, *ny, *cb, *cr, nr, ng, nb);
-        ++ny;
-        ++nr;
-        ++ng;
-        ++nb;
-        ++cb;
-        ++cr;
-      }
-      if (j < yw) {
-        if (extw) {
-          --cb;
-          --cr;
-        }
-        sycc_to_rgb(offset, upb, *y, *cb, *cr, r, g, b);
-        ++y;
-        ++r;
-        ++g;
-        ++b;
-        sycc_to_rgb(offset, upb, *ny, *cb, *cr, nr, ng, nb);
-        ++ny;
-        ++nr;
-        ++ng;
-        ++nb;
-        ++cb;
-        ++cr;
-      }
-      y += yw;
-      r += yw;
-      g += yw;
-      b += yw;
-    }
-    if (i < yh) {
-      if (exth) {
-        cb -= cbw;
-        cr -= crw;
-      }
-      for (j = 0; j < (yw & ~(OPJ_UINT32)1); j += 2) {
-        sycc_to_rgb(offset, upb, *y, *cb, *cr, r, g, b);
-        ++y;
-        ++r;
-        ++g;
-        ++b;
-        sycc_to_rgb(offset, upb, *y, *cb, *cr, r, g, b);
-        ++y;
-        ++r;
-        ++g;
-        ++b;
-        ++cb;
-        ++cr;
-      }
-      if (j < yw) {
-        if (extw) {
-          --cb;
-          --cr;
-        }
-        sycc_to_rgb(offset, upb, *y, *cb, *cr, r, g, b);
-      }
-    }
-  });
+  // Valid sizes round the chroma planes up, so odd trailing luma columns and
+  // rows map to the last chroma sample.
+  sycc_plane_to_rgb(offset, upb, y, cb, cr, yw, yh, cbw, /*x_shift=*/1,
+                    /*y_shift=*/1, data.value());
   opj_image_data_free(components[0].data);
   opj_image_data_free(components[1].data);
   opj_image_data_free(components[2].data);
@@ -358,21 +312,8 @@ void sycc422_to_rgb(opj_image_t* img) {
     return;
   }
 
-  int* r = data.value().r.get();
-  int* g = data.value().g.get();
-  int* b = data.value().b.get();
-  UNSAFE_TODO({
-    for (uint32_t i = 0; i < maxh; ++i) {
-      OPJ_UINT32 j;
-      for (j = 0; j < (maxw & ~static_cast<OPJ_UINT32>(1)); j += 2) {
-        sycc_to_rgb(offset, upb, *y++, *cb, *cr, r++, g++, b++);
-        sycc_to_rgb(offset, upb, *y++, *cb++, *cr++, r++, g++, b++);
-      }
-      if (j < maxw) {
-        sycc_to_rgb(offset, upb, *y++, *cb++, *cr++, r++, g++, b++);
-      }
-    }
-  });
+  sycc_plane_to_rgb(offset, upb, y, cb, cr, maxw, maxh, components[1].w,
+                    /*x_shift=*/1, /*y_shift=*/0, data.value());
   opj_image_data_free(components[0].data);
   opj_image_data_free(components[1].data);
   opj_image_data_free(components[2].data);
@@ -407,6 +348,18 @@ bool is_sycc444(pdfium::span<opj_image_comp_t> components) {
          components[2].dx == 1 && components[2].dy == 1;
 }
 
+// Returns where OpenJPEG places `coordinate` on the reference grid in a
+// component with `subsampling`, when decoding with `reduce_factor`.
+uint32_t ReducedCoordinate(uint32_t coordinate,
+                           uint32_t subsampling,
+                           uint32_t reduce_factor) {
+  const uint64_t component_coordinate =
+      (uint64_t{coordinate} + subsampling - 1) / subsampling;
+  return static_cast<uint32_t>(
+      (component_coordinate + (uint64_t{1} << reduce_factor) - 1) >>
+      reduce_factor);
+}
+
 void color_sycc_to_rgb(opj_image_t* img) {
   auto components = components_span(img);
   if (components.size() < 3) {
@@ -446,6 +399,11 @@ void CJPX_Decoder::Sycc420ToRgbForTesting(opj_image_t* img) {
   sycc420_to_rgb(img);
 }
 
+// static
+size_t CJPX_Decoder::GetThreadedDecoderCountForTesting() {
+  return g_threaded_decoder_count;
+}
+
 CJPX_Decoder::CJPX_Decoder(ColorSpaceOption option)
     : color_space_option_(option) {}
 
@@ -499,6 +457,15 @@ bool CJPX_Decoder::Init(pdfium::span<const uint8_t> src_data,
     CHECK(opj_decoder_set_strict_mode(codec_.get(), false));
   }
 
+  // Match the embedder's worker thread count. OpenJPEG runs its own threads,
+  // which must be requested before reading the header.
+  const size_t concurrency = CFX_ThreadPool::GetConcurrency();
+  if (concurrency > 1 && src_data.size() >= kMinSizeForDecodeThreads &&
+      opj_codec_set_threads(codec_.get(),
+                            pdfium::checked_cast<int>(concurrency))) {
+    ++g_threaded_decoder_count;
+  }
+
   opj_image_t* pTempImage = nullptr;
   if (!opj_read_header(stream_.get(), codec_.get(), &pTempImage)) {
     return false;
@@ -508,7 +475,48 @@ bool CJPX_Decoder::Init(pdfium::span<const uint8_t> src_data,
   return true;
 }
 
+void CJPX_Decoder::SetDecodeArea(const FX_RECT& area) {
+  const uint32_t width = image_->x1 - image_->x0;
+  const uint32_t height = image_->y1 - image_->y0;
+  FX_RECT clipped_area = area;
+  clipped_area.Intersect(0, 0, pdfium::saturated_cast<int>(width),
+                         pdfium::saturated_cast<int>(height));
+  if (clipped_area.IsEmpty() ||
+      (clipped_area.Width() == static_cast<int>(width) &&
+       clipped_area.Height() == static_cast<int>(height))) {
+    return;
+  }
+
+  // Align the area to whole pixels at the decoded resolution, so that pixels
+  // partially within the area get decoded too.
+  const opj_image_comp_t& component = components_span(image_.get())[0];
+  const uint32_t reduce = parameters_.cp_reduce;
+  const uint64_t align_x = uint64_t{component.dx} << reduce;
+  const uint64_t align_y = uint64_t{component.dy} << reduce;
+  const uint64_t x0 = image_->x0 + static_cast<uint32_t>(clipped_area.left);
+  const uint64_t y0 = image_->y0 + static_cast<uint32_t>(clipped_area.top);
+  const uint64_t x1 = image_->x0 + static_cast<uint32_t>(clipped_area.right);
+  const uint64_t y1 = image_->y0 + static_cast<uint32_t>(clipped_area.bottom);
+  parameters_.DA_x0 = static_cast<uint32_t>(x0 - x0 % align_x);
+  parameters_.DA_y0 = static_cast<uint32_t>(y0 - y0 % align_y);
+  parameters_.DA_x1 = static_cast<uint32_t>(
+      std::min<uint64_t>((x1 + align_x - 1) / align_x * align_x, image_->x1));
+  parameters_.DA_y1 = static_cast<uint32_t>(
+      std::min<uint64_t>((y1 + align_y - 1) / align_y * align_y, image_->y1));
+  parameters_.DA_x0 = std::max(parameters_.DA_x0, image_->x0);
+  parameters_.DA_y0 = std::max(parameters_.DA_y0, image_->y0);
+
+  image_width_ = ReducedCoordinate(image_->x1, component.dx, reduce) -
+                 ReducedCoordinate(image_->x0, component.dx, reduce);
+  image_height_ = ReducedCoordinate(image_->y1, component.dy, reduce) -
+                  ReducedCoordinate(image_->y0, component.dy, reduce);
+  has_decode_area_ = true;
+}
+
 bool CJPX_Decoder::StartDecode() {
+  // opj_set_decode_area() shrinks `image_` to the decoded area.
+  const uint32_t image_x0 = image_->x0;
+  const uint32_t image_y0 = image_->y0;
   if (!parameters_.nb_tile_to_decode) {
     if (!opj_set_decode_area(codec_.get(), image_.get(), parameters_.DA_x0,
                              parameters_.DA_y0, parameters_.DA_x1,
@@ -528,6 +536,14 @@ bool CJPX_Decoder::StartDecode() {
 
   stream_.reset();
   auto components = components_span(image_.get());
+  if (has_decode_area_) {
+    // The component origins are in full resolution component coordinates.
+    const opj_image_comp_t& component = components[0];
+    area_left_ = ReducedCoordinate(component.x0, 1, component.factor) -
+                 ReducedCoordinate(image_x0, component.dx, component.factor);
+    area_top_ = ReducedCoordinate(component.y0, 1, component.factor) -
+                ReducedCoordinate(image_y0, component.dy, component.factor);
+  }
   if (image_->color_space != OPJ_CLRSPC_SYCC && components.size() == 3 &&
       components[0].dx == components[0].dy && components[1].dx != 1) {
     image_->color_space = OPJ_CLRSPC_SYCC;
@@ -558,6 +574,11 @@ bool CJPX_Decoder::StartDecode() {
 
 CJPX_Decoder::JpxImageInfo CJPX_Decoder::GetInfo() const {
   const auto components = components_span(image_.get());
+  if (has_decode_area_) {
+    return {image_width_, image_height_,
+            pdfium::checked_cast<uint32_t>(components.size()),
+            image_->color_space};
+  }
   return {components[0].w, components[0].h,
           pdfium::checked_cast<uint32_t>(components.size()),
           image_->color_space};
@@ -575,8 +596,9 @@ bool CJPX_Decoder::Decode(pdfium::span<uint8_t> dest_buf,
     channel_count = 4;
   }
 
+  const JpxImageInfo info = GetInfo();
   std::optional<uint32_t> calculated_pitch =
-      fxge::CalculatePitch32(8 * channel_count, image_->comps[0].w);
+      fxge::CalculatePitch32(8 * channel_count, info.width);
   if (!calculated_pitch.has_value() || pitch < calculated_pitch.value()) {
     return false;
   }
@@ -590,13 +612,19 @@ bool CJPX_Decoder::Decode(pdfium::span<uint8_t> dest_buf,
   // the color component data if `image_->numcomps` > `component_count`.
   // Currently only the color component data is used for rendering.
   // TODO(crbug.com/pdfium/1747): Make full use of the component information.
-  std::ranges::fill(dest_buf.first(image_->comps[0].h * pitch), 0xff);
-  std::vector<uint8_t*> channel_bufs(image_->numcomps);
-  std::vector<int> adjust_comps(image_->numcomps);
+  std::ranges::fill(dest_buf.first(info.height * pitch), 0xff);
   const pdfium::span<opj_image_comp_t> components =
       components_span(image_.get());
+  if (components[0].w > info.width - area_left_ ||
+      components[0].h > info.height - area_top_) {
+    return false;
+  }
+  pdfium::span<uint8_t> area_buf =
+      dest_buf.subspan(area_top_ * pitch + area_left_ * channel_count);
+  std::vector<uint8_t*> channel_bufs(image_->numcomps);
+  std::vector<int> adjust_comps(image_->numcomps);
   for (size_t i = 0; i < components.size(); i++) {
-    channel_bufs[i] = dest_buf.subspan(i).data();
+    channel_bufs[i] = area_buf.subspan(i).data();
     adjust_comps[i] = components[i].prec - 8;
     if (i > 0) {
       if (components[i].dx != components[i - 1].dx ||
@@ -610,52 +638,55 @@ bool CJPX_Decoder::Decode(pdfium::span<uint8_t> dest_buf,
     std::swap(channel_bufs[0], channel_bufs[2]);
   }
 
-  uint32_t width = components[0].w;
-  uint32_t height = components[0].h;
-  for (uint32_t channel = 0; channel < channel_count; ++channel) {
-    uint8_t* pChannel = channel_bufs[channel];
-    const int adjust = adjust_comps[channel];
-    const opj_image_comp_t& comps = components[channel];
-    if (!comps.data) {
-      continue;
-    }
+  const uint32_t width = components[0].w;
+  const uint32_t height = components[0].h;
+  CFX_ThreadPool::ParallelFor(height, GetRowsPerRange(width, height),
+                              [&](size_t begin, size_t end) {
+    for (uint32_t channel = 0; channel < channel_count; ++channel) {
+      uint8_t* pChannel = channel_bufs[channel];
+      const int adjust = adjust_comps[channel];
+      const opj_image_comp_t& comps = components[channel];
+      if (!comps.data) {
+        continue;
+      }
 
-    // Perfomance-sensitive code below. Combining these 3 for-loops below will
-    // cause a slowdown.
-    UNSAFE_TODO({
-      const uint32_t src_offset = comps.sgnd ? 1 << (comps.prec - 1) : 0;
-      if (adjust < 0) {
-        for (uint32_t row = 0; row < height; ++row) {
-          uint8_t* pScanline = pChannel + row * pitch;
-          for (uint32_t col = 0; col < width; ++col) {
-            uint8_t* pPixel = pScanline + col * channel_count;
-            int src = comps.data[row * width + col] + src_offset;
-            *pPixel = static_cast<uint8_t>(src << -adjust);
+      // Perfomance-sensitive code below. Combining these 3 for-loops below
+      // will cause a slowdown.
+      UNSAFE_TODO({
+        const uint32_t src_offset = comps.sgnd ? 1 << (comps.prec - 1) : 0;
+        if (adjust < 0) {
+          for (size_t row = begin; row < end; ++row) {
+            uint8_t* pScanline = pChannel + row * pitch;
+            for (uint32_t col = 0; col < width; ++col) {
+              uint8_t* pPixel = pScanline + col * channel_count;
+              int src = comps.data[row * width + col] + src_offset;
+              *pPixel = static_cast<uint8_t>(src << -adjust);
+            }
           }
-        }
-      } else if (adjust == 0) {
-        for (uint32_t row = 0; row < height; ++row) {
-          uint8_t* pScanline = pChannel + row * pitch;
-          for (uint32_t col = 0; col < width; ++col) {
-            uint8_t* pPixel = pScanline + col * channel_count;
-            int src = comps.data[row * width + col] + src_offset;
-            *pPixel = static_cast<uint8_t>(src);
+        } else if (adjust == 0) {
+          for (size_t row = begin; row < end; ++row) {
+            uint8_t* pScanline = pChannel + row * pitch;
+            for (uint32_t col = 0; col < width; ++col) {
+              uint8_t* pPixel = pScanline + col * channel_count;
+              int src = comps.data[row * width + col] + src_offset;
+              *pPixel = static_cast<uint8_t>(src);
+            }
           }
-        }
-      } else {
-        for (uint32_t row = 0; row < height; ++row) {
-          uint8_t* pScanline = pChannel + row * pitch;
-          for (uint32_t col = 0; col < width; ++col) {
-            uint8_t* pPixel = pScanline + col * channel_count;
-            int src = comps.data[row * width + col] + src_offset;
-            int pixel = (src >> adjust) + ((src >> (adjust - 1)) % 2);
-            pixel = std::clamp(pixel, 0, 255);
-            *pPixel = static_cast<uint8_t>(pixel);
+        } else {
+          for (size_t row = begin; row < end; ++row) {
+            uint8_t* pScanline = pChannel + row * pitch;
+            for (uint32_t col = 0; col < width; ++col) {
+              uint8_t* pPixel = pScanline + col * channel_count;
+              int src = comps.data[row * width + col] + src_offset;
+              int pixel = (src >> adjust) + ((src >> (adjust - 1)) % 2);
+              pixel = std::clamp(pixel, 0, 255);
+              *pPixel = static_cast<uint8_t>(pixel);
+            }
           }
         }
-      }
-    });
-  }
+      });
+    }
+  });
   return true;
 }
 
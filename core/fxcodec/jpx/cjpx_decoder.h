@@ -7,10 +7,12 @@
 #ifndef CORE_FXCODEC_JPX_CJPX_DECODER_H_
 #define CORE_FXCODEC_JPX_CJPX_DECODER_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <memory>
 
+#include "core/fxcrt/fx_coordinates.h"
 #include "core/fxcrt/raw_span.h"
 #include "core/fxcrt/span.h"
 
@@ -51,9 +53,19 @@ class CJPX_Decoder {
 
   static void Sycc420ToRgbForTesting(opj_image_t* img);
 
+  // Returns how many decoders have had OpenJPEG decode on worker threads.
+  static size_t GetThreadedDecoderCountForTesting();
+
   ~CJPX_Decoder();
 
   JpxImageInfo GetInfo() const;
+
+  // Restricts decoding to `area`, given in pixels of the full resolution
+  // image, to save time when only part of the image is visible. Must be called
+  // before StartDecode(). GetInfo() and Decode() still cover the whole image,
+  // but Decode() leaves pixels outside the area set to 0xff.
+  void SetDecodeArea(const FX_RECT& area);
+
   bool StartDecode();
 
   // `swap_rgb` can only be set when an image's color space type contains at
@@ -101,6 +113,14 @@ class CJPX_Decoder {
   std::unique_ptr<opj_stream_t, StreamDeleter> stream_;
   std::unique_ptr<opj_image_t, ImageDeleter> image_;
   opj_dparameters_t parameters_ = {};
+
+  // Only set with a decode area. The size of the whole image and the position
+  // of the decoded pixels within it, at the decoded resolution.
+  bool has_decode_area_ = false;
+  uint32_t image_width_ = 0;
+  uint32_t image_height_ = 0;
+  uint32_t area_left_ = 0;
+  uint32_t area_top_ = 0;
 };
 
 }  // namespace fxcodec
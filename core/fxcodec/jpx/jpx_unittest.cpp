@@ -8,13 +8,21 @@
 #include <algorithm>
 #include <array>
 #include <limits>
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "core/fxcodec/jpx/cjpx_decoder.h"
 #include "core/fxcodec/jpx/jpx_decode_utils.h"
+#include "core/fxcrt/cfx_threadpool.h"
+#include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/fx_memcpy_wrappers.h"
 #include "core/fxcrt/fx_memory.h"
+#include "core/fxge/calculate_pitch.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/utils/benchmark_timer.h"
 #include "third_party/libopenjpeg/opj_malloc.h"
 
 namespace fxcodec {
@@ -31,6 +39,151 @@ constexpr auto kStreamData = std::to_array<const uint8_t>({
     // clang-format on
 });
 
+// Allocates the planes of a YCbCr 4:2:0 image with `width` x `height` luma
+// samples, filled with varying samples.
+void InitYuv420Image(uint32_t width,
+                     uint32_t height,
+                     pdfium::span<opj_image_comp_t, 3> components) {
+  const uint32_t chroma_width = (width + 1) / 2;
+  const uint32_t chroma_height = (height + 1) / 2;
+  for (size_t i = 0; i < components.size(); ++i) {
+    opj_image_comp_t& component = components[i];
+    component = {};
+    component.dx = i == 0 ? 1 : 2;
+    component.dy = i == 0 ? 1 : 2;
+    component.w = i == 0 ? width : chroma_width;
+    component.h = i == 0 ? height : chroma_height;
+    component.prec = 8;
+    const size_t size = component.w * component.h;
+    component.data = static_cast<OPJ_INT32*>(
+        opj_image_data_alloc(size * sizeof(OPJ_INT32)));
+    for (size_t j = 0; j < size; ++j) {
+      UNSAFE_TODO(component.data[j] =
+                      static_cast<OPJ_INT32>((j * 37 + i * 101) % 256));
+    }
+  }
+}
+
+// Creates the thread pool, and destroys it again when going out of scope,
+// including when a test assertion fails.
+class ScopedThreadPool {
+ public:
+  explicit ScopedThreadPool(unsigned int thread_count) {
+    CFX_ThreadPool::InitializeGlobals(thread_count);
+  }
+  ~ScopedThreadPool() { CFX_ThreadPool::DestroyGlobals(); }
+};
+
+// The codestream written by EncodeTiledImage().
+struct EncodeData {
+  std::vector<uint8_t> bytes;
+  size_t offset = 0;
+};
+
+OPJ_SIZE_T WriteEncodeData(void* buffer, OPJ_SIZE_T size, void* user_data) {
+  EncodeData* data = static_cast<EncodeData*>(user_data);
+  if (data->bytes.size() < data->offset + size) {
+    data->bytes.resize(data->offset + size);
+  }
+  UNSAFE_TODO(FXSYS_memcpy(data->bytes.data() + data->offset, buffer, size));
+  data->offset += size;
+  return size;
+}
+
+OPJ_OFF_T SkipEncodeData(OPJ_OFF_T size, void* user_data) {
+  static_cast<EncodeData*>(user_data)->offset += size;
+  return size;
+}
+
+OPJ_BOOL SeekEncodeData(OPJ_OFF_T offset, void* user_data) {
+  static_cast<EncodeData*>(user_data)->offset = offset;
+  return OPJ_TRUE;
+}
+
+// Returns a lossless JPEG2000 codestream of a `size` x `size` RGB image, made
+// of `tile_size` x `tile_size` tiles, or an empty vector on failure. The
+// image is noisy, so the codestream is large enough for OpenJPEG to decode on
+// worker threads.
+std::vector<uint8_t> EncodeTiledImage(uint32_t size, uint32_t tile_size) {
+  std::array<opj_image_cmptparm_t, 3> component_params = {};
+  for (opj_image_cmptparm_t& params : component_params) {
+    params.dx = 1;
+    params.dy = 1;
+    params.w = size;
+    params.h = size;
+    params.prec = 8;
+  }
+  std::unique_ptr<opj_image_t, decltype(&opj_image_destroy)> image(
+      opj_image_create(component_params.size(), component_params.data(),
+                       OPJ_CLRSPC_SRGB),
+      opj_image_destroy);
+  if (!image) {
+    return {};
+  }
+  image->x1 = size;
+  image->y1 = size;
+  uint32_t noise = 1;
+  for (uint32_t i = 0; i < image->numcomps; ++i) {
+    OPJ_INT32* samples = UNSAFE_TODO(image->comps[i].data);
+    for (uint32_t y = 0; y < size; ++y) {
+      for (uint32_t x = 0; x < size; ++x) {
+        noise = noise * 1103515245 + 12345;
+        UNSAFE_TODO(samples[y * size + x] = static_cast<OPJ_INT32>(
+                        ((x + y * (i + 1)) & 0xf0) | (noise >> 28)));
+      }
+    }
+  }
+
+  opj_cparameters_t parameters;
+  opj_set_default_encoder_parameters(&parameters);
+  parameters.tcp_numlayers = 1;
+  parameters.cp_disto_alloc = 1;
+  parameters.tcp_mct = 1;
+  parameters.tile_size_on = OPJ_TRUE;
+  parameters.cp_tdx = static_cast<int>(tile_size);
+  parameters.cp_tdy = static_cast<int>(tile_size);
+  std::unique_ptr<opj_codec_t, decltype(&opj_destroy_codec)> codec(
+      opj_create_compress(OPJ_CODEC_J2K), opj_destroy_codec);
+  if (!codec || !opj_setup_encoder(codec.get(), &parameters, image.get())) {
+    return {};
+  }
+
+  EncodeData data;
+  std::unique_ptr<opj_stream_t, decltype(&opj_stream_destroy)> stream(
+      opj_stream_create(OPJ_J2K_STREAM_CHUNK_SIZE, /*p_is_input=*/OPJ_FALSE),
+      opj_stream_destroy);
+  if (!stream) {
+    return {};
+  }
+  opj_stream_set_user_data(stream.get(), &data, nullptr);
+  opj_stream_set_write_function(stream.get(), WriteEncodeData);
+  opj_stream_set_skip_function(stream.get(), SkipEncodeData);
+  opj_stream_set_seek_function(stream.get(), SeekEncodeData);
+  if (!opj_start_compress(codec.get(), image.get(), stream.get()) ||
+      !opj_encode(codec.get(), stream.get()) ||
+      !opj_end_compress(codec.get(), stream.get())) {
+    return {};
+  }
+  return std::move(data.bytes);
+}
+
+// Decodes `data` into `buffer`, with one byte per channel and 4-byte aligned
+// rows.
+bool DecodeImage(pdfium::span<const uint8_t> data,
+                 DataVector<uint8_t>& buffer) {
+  std::unique_ptr<CJPX_Decoder> decoder = CJPX_Decoder::Create(
+      data, CJPX_Decoder::ColorSpaceOption::kNormal,
+      /*resolution_levels_to_skip=*/0, /*strict_mode=*/true);
+  if (!decoder || !decoder->StartDecode()) {
+    return false;
+  }
+  const CJPX_Decoder::JpxImageInfo info = decoder->GetInfo();
+  const uint32_t pitch = fxge::CalculatePitch32OrDie(
+      8 * static_cast<int>(info.channels), static_cast<int>(info.width));
+  buffer.resize(pitch * info.height);
+  return decoder->Decode(buffer, pitch, /*swap_rgb=*/false, info.channels);
+}
+
 }  // namespace
 
 TEST(fxcodec, DecodeDataNullDecodeData) {
@@ -463,4 +616,92 @@ TEST(fxcodec, YUV420ToRGB) {
   FX_Free(img.comps);
 }
 
+TEST(fxcodec, YUV420ToRGBWithThreadPool) {
+  // Large enough for CFX_ThreadPool::ShouldSplitImage(), and odd sized.
+  static constexpr uint32_t kWidth = 701;
+  static constexpr uint32_t kHeight = 401;
+  std::array<opj_image_comp_t, 3> expected_components;
+  std::array<opj_image_comp_t, 3> components;
+  InitYuv420Image(kWidth, kHeight, expected_components);
+  InitYuv420Image(kWidth, kHeight, components);
+
+  opj_image_t img = {};  // Aggregate initialization.
+  img.numcomps = 3;
+  img.color_space = OPJ_CLRSPC_SYCC;
+  img.comps = expected_components.data();
+  CJPX_Decoder::Sycc420ToRgbForTesting(&img);
+
+  CFX_ThreadPool::InitializeGlobals(3);
+  img.comps = components.data();
+  CJPX_Decoder::Sycc420ToRgbForTesting(&img);
+  CFX_ThreadPool::DestroyGlobals();
+
+  for (size_t i = 0; i < components.size(); ++i) {
+    ASSERT_EQ(kWidth, components[i].w);
+    ASSERT_EQ(kHeight, components[i].h);
+    UNSAFE_TODO({
+      EXPECT_TRUE(std::equal(components[i].data,
+                             components[i].data + kWidth * kHeight,
+                             expected_components[i].data))
+          << i;
+    });
+    opj_image_data_free(components[i].data);
+    opj_image_data_free(expected_components[i].data);
+  }
+}
+
+TEST(fxcodec, DecodeTiledImageWithThreadPool) {
+  // Large enough for CFX_ThreadPool::ShouldSplitImage().
+  const std::vector<uint8_t> contents =
+      EncodeTiledImage(/*size=*/512, /*tile_size=*/128);
+  ASSERT_FALSE(contents.empty());
+  DataVector<uint8_t> expected;
+  ASSERT_TRUE(DecodeImage(contents, expected));
+
+  ScopedThreadPool thread_pool(3);
+  const size_t threaded_decoder_count =
+      CJPX_Decoder::GetThreadedDecoderCountForTesting();
+  const size_t split_count = CFX_ThreadPool::GetSplitCountForTesting();
+  DataVector<uint8_t> actual;
+  ASSERT_TRUE(DecodeImage(contents, actual));
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(threaded_decoder_count + 1,
+            CJPX_Decoder::GetThreadedDecoderCountForTesting());
+  EXPECT_LT(split_count, CFX_ThreadPool::GetSplitCountForTesting());
+}
+
+// Not run by default. Use --gtest_also_run_disabled_tests to time decoding a
+// large tiled JPEG2000 image, both on the calling thread alone and with worker
+// threads.
+TEST(fxcodec, DISABLED_JpxDecodeBenchmark) {
+  static constexpr int kIterations = 10;
+  const std::vector<uint8_t> contents =
+      EncodeTiledImage(/*size=*/2048, /*tile_size=*/256);
+  ASSERT_FALSE(contents.empty());
+
+  for (unsigned int thread_count : {0u, 3u}) {
+    ScopedThreadPool thread_pool(thread_count);
+    const size_t threaded_decoder_count =
+        CJPX_Decoder::GetThreadedDecoderCountForTesting();
+    const size_t split_count = CFX_ThreadPool::GetSplitCountForTesting();
+    {
+      ScopedBenchmarkTimer timer(
+          "2048x2048 in 256x256 tiles, " + std::to_string(thread_count) +
+              " worker threads",
+          kIterations);
+      for (int i = 0; i < kIterations; ++i) {
+        DataVector<uint8_t> buffer;
+        ASSERT_TRUE(DecodeImage(contents, buffer));
+      }
+    }
+
+    // Make sure the timings are for the intended code paths.
+    const size_t expected_threaded_count = thread_count ? kIterations : 0;
+    EXPECT_EQ(threaded_decoder_count + expected_threaded_count,
+              CJPX_Decoder::GetThreadedDecoderCountForTesting());
+    EXPECT_EQ(split_count + expected_threaded_count,
+              CFX_ThreadPool::GetSplitCountForTesting());
+  }
+}
+
 }  // namespace fxcodec
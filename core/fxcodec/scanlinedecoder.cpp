@@ -6,10 +6,20 @@
 
 #include "core/fxcodec/scanlinedecoder.h"
 
+#include <algorithm>
+
 #include "core/fxcrt/pauseindicator_iface.h"
 
 namespace fxcodec {
 
+namespace {
+
+// Skipping is cheap per line, so check for pauses less often than once per
+// line.
+constexpr int kSkipLinesBetweenPauses = 32;
+
+}  // namespace
+
 ScanlineDecoder::ScanlineDecoder() : ScanlineDecoder(0, 0, 0, 0, 0, 0, 0) {}
 
 ScanlineDecoder::ScanlineDecoder(int nOrigWidth,
@@ -30,7 +40,7 @@ ScanlineDecoder::ScanlineDecoder(int nOrigWidth,
 ScanlineDecoder::~ScanlineDecoder() = default;
 
 pdfium::span<const uint8_t> ScanlineDecoder::GetScanline(int line) {
-  if (next_line_ == line + 1) {
+  if (next_line_ == line + 1 && !last_line_skipped_) {
     return last_scanline_;
   }
 
@@ -40,11 +50,12 @@ pdfium::span<const uint8_t> ScanlineDecoder::GetScanline(int line) {
     }
     next_line_ = 0;
   }
-  while (next_line_ < line) {
-    GetNextLine();
-    next_line_++;
+  if (next_line_ < line) {
+    SkipNextLines(line - next_line_);
+    next_line_ = line;
   }
   last_scanline_ = GetNextLine();
+  last_line_skipped_ = false;
   next_line_++;
   return last_scanline_;
 }
@@ -62,8 +73,10 @@ bool ScanlineDecoder::SkipToScanline(int line, PauseIndicatorIface* pPause) {
   }
   last_scanline_ = pdfium::span<uint8_t>();
   while (next_line_ < line) {
-    last_scanline_ = GetNextLine();
-    next_line_++;
+    const int count = std::min(line - next_line_, kSkipLinesBetweenPauses);
+    SkipNextLines(count);
+    next_line_ += count;
+    last_line_skipped_ = true;
     if (pPause && pPause->NeedToPauseNow()) {
       return true;
     }
@@ -71,4 +84,10 @@ bool ScanlineDecoder::SkipToScanline(int line, PauseIndicatorIface* pPause) {
   return false;
 }
 
+void ScanlineDecoder::SkipNextLines(int count) {
+  for (int i = 0; i < count; ++i) {
+    GetNextLine();
+  }
+}
+
 }  // namespace fxcodec
@@ -42,6 +42,10 @@ class ScanlineDecoder {
   [[nodiscard]] virtual bool Rewind() = 0;
   virtual pdfium::span<uint8_t> GetNextLine() = 0;
 
+  // Moves past the next `count` lines without returning them. Decoders that
+  // can skip some of the work for such lines should override this.
+  virtual void SkipNextLines(int count);
+
   int orig_width_;
   int orig_height_;
   int output_width_;
@@ -50,6 +54,9 @@ class ScanlineDecoder {
   int bpc_;
   uint32_t pitch_;
   int next_line_ = -1;
+  // Set when SkipToScanline() skipped the line before `next_line_`, so
+  // `last_scanline_` does not hold it.
+  bool last_line_skipped_ = false;
   pdfium::raw_span<uint8_t> last_scanline_;
 };
 
@@ -0,0 +1,181 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcrt/cfx_threadpool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "core/fxcrt/check.h"
+
+namespace {
+
+// More threads than this only add contention for the shared task queue.
+constexpr unsigned int kMaxThreadCount = 64;
+
+// Images smaller than this, such as thumbnails, take about as long to split
+// up and hand to other threads as to process on the calling thread.
+constexpr size_t kMinSplitImagePixels = 256 * 1024;
+
+CFX_ThreadPool* g_thread_pool = nullptr;
+
+std::atomic<size_t> g_split_count = 0;
+
+}  // namespace
+
+// One ParallelFor() call. Shared between the calling thread and the tasks it
+// posts, since a task may only get to run after all ranges are finished.
+struct CFX_ThreadPool::Job {
+  Job(size_t count, size_t grain_size, const RangeCallback& callback)
+      : count(count),
+        grain_size(grain_size),
+        range_count((count + grain_size - 1) / grain_size),
+        callback(callback) {}
+
+  // Claims and runs ranges until none are left.
+  void RunRanges() {
+    while (true) {
+      const size_t range = next_range.fetch_add(1);
+      if (range >= range_count) {
+        return;
+      }
+      // Only touch `callback` after claiming a range, as the ParallelFor()
+      // call that owns it cannot return before the range finishes.
+      const size_t begin = range * grain_size;
+      callback(begin, std::min(begin + grain_size, count));
+      if (finished_ranges.fetch_add(1) + 1 == range_count) {
+        std::lock_guard<std::mutex> guard(lock);
+        all_finished.notify_all();
+      }
+    }
+  }
+
+  void WaitUntilFinished() {
+    std::unique_lock<std::mutex> guard(lock);
+    all_finished.wait(guard,
+                      [this] { return finished_ranges.load() == range_count; });
+  }
+
+  const size_t count;
+  const size_t grain_size;
+  const size_t range_count;
+  const RangeCallback& callback;
+  std::atomic<size_t> next_range{0};
+  std::atomic<size_t> finished_ranges{0};
+  std::mutex lock;
+  std::condition_variable all_finished;
+};
+
+// static
+void CFX_ThreadPool::InitializeGlobals(unsigned int thread_count) {
+  CHECK(!g_thread_pool);
+  if (thread_count > 0) {
+    g_thread_pool =
+        new CFX_ThreadPool(std::min(thread_count, kMaxThreadCount));
+  }
+}
+
+// static
+void CFX_ThreadPool::DestroyGlobals() {
+  delete g_thread_pool;
+  g_thread_pool = nullptr;
+}
+
+// static
+CFX_ThreadPool* CFX_ThreadPool::GetInstance() {
+  return g_thread_pool;
+}
+
+// static
+size_t CFX_ThreadPool::GetConcurrency() {
+  return g_thread_pool ? g_thread_pool->thread_count() + 1 : 1;
+}
+
+// static
+void CFX_ThreadPool::ParallelFor(size_t count,
+                                 size_t grain_size,
+                                 const RangeCallback& callback) {
+  if (count == 0) {
+    return;
+  }
+  grain_size = std::max<size_t>(grain_size, 1);
+  if (!g_thread_pool || count <= grain_size) {
+    for (size_t begin = 0; begin < count; begin += grain_size) {
+      callback(begin, std::min(begin + grain_size, count));
+    }
+    return;
+  }
+
+  ++g_split_count;
+  auto job = std::make_shared<Job>(count, grain_size, callback);
+  const size_t helper_count =
+      std::min(g_thread_pool->thread_count(), job->range_count - 1);
+  for (size_t i = 0; i < helper_count; ++i) {
+    g_thread_pool->PostTask([job] { job->RunRanges(); });
+  }
+  // Working on the job here, rather than just waiting, guarantees progress
+  // even when every worker is busy, e.g. with nested ParallelFor() calls.
+  job->RunRanges();
+  job->WaitUntilFinished();
+}
+
+// static
+bool CFX_ThreadPool::ShouldSplitImage(size_t width, size_t height) {
+  if (GetConcurrency() < 2 || width == 0) {
+    return false;
+  }
+  // Same as `width * height >= kMinSplitImagePixels`, without overflowing.
+  return height >= (kMinSplitImagePixels + width - 1) / width;
+}
+
+// static
+size_t CFX_ThreadPool::GetSplitCountForTesting() {
+  return g_split_count;
+}
+
+CFX_ThreadPool::CFX_ThreadPool(unsigned int thread_count) {
+  threads_.reserve(thread_count);
+  for (unsigned int i = 0; i < thread_count; ++i) {
+    threads_.emplace_back(&CFX_ThreadPool::WorkerMain, this);
+  }
+}
+
+CFX_ThreadPool::~CFX_ThreadPool() {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    shutting_down_ = true;
+  }
+  task_posted_.notify_all();
+  for (std::thread& thread : threads_) {
+    thread.join();
+  }
+}
+
+void CFX_ThreadPool::PostTask(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    tasks_.push_back(std::move(task));
+  }
+  task_posted_.notify_one();
+}
+
+void CFX_ThreadPool::WorkerMain() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> guard(lock_);
+      task_posted_.wait(guard,
+                        [this] { return shutting_down_ || !tasks_.empty(); });
+      // Drain pending tasks before shutting down.
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
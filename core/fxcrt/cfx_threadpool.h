@@ -0,0 +1,80 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FXCRT_CFX_THREADPOOL_H_
+#define CORE_FXCRT_CFX_THREADPOOL_H_
+
+#include <stddef.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Process-wide pool of worker threads for splitting CPU-heavy work, such as
+// processing the rows of a large image, into independent chunks. The pool
+// only exists when the embedder asks for worker threads, so by default all
+// work runs on the calling thread.
+//
+// Work run on the pool must not touch state shared with other chunks. In
+// particular, this includes the reference counts of Retainable objects, which
+// are not thread-safe, so chunks must not copy or destroy RetainPtrs.
+class CFX_ThreadPool {
+ public:
+  // Called with a [begin, end) sub-range of the items to process.
+  using RangeCallback = std::function<void(size_t, size_t)>;
+
+  // Grain size for ParallelFor() calls that process the rows of an image, which
+  // keeps the cost of scheduling a range small next to the work on its rows.
+  static constexpr size_t kImageRowsPerRange = 16;
+
+  // Creates the pool if `thread_count` is non-zero.
+  static void InitializeGlobals(unsigned int thread_count);
+  static void DestroyGlobals();
+
+  // Returns nullptr when no pool was requested.
+  static CFX_ThreadPool* GetInstance();
+
+  // Returns the number of threads that ParallelFor() may use, including the
+  // calling thread.
+  static size_t GetConcurrency();
+
+  // Splits [0, `count`) into consecutive ranges of `grain_size` items (the
+  // last one may be shorter) and calls `callback` once per range, using the
+  // pool's threads as well as the calling thread. Returns after all calls
+  // finish. Runs everything on the calling thread when there is no pool or
+  // only one range, and may safely be called from within a callback.
+  static void ParallelFor(size_t count,
+                          size_t grain_size,
+                          const RangeCallback& callback);
+
+  // Returns whether processing an image of `width` x `height` pixels on
+  // multiple threads is likely to pay off, i.e. whether there is a pool and
+  // the image is large enough.
+  static bool ShouldSplitImage(size_t width, size_t height);
+
+  // Returns how many ParallelFor() calls have handed ranges to the pool.
+  static size_t GetSplitCountForTesting();
+
+  size_t thread_count() const { return threads_.size(); }
+
+ private:
+  struct Job;
+
+  explicit CFX_ThreadPool(unsigned int thread_count);
+  ~CFX_ThreadPool();
+
+  void PostTask(std::function<void()> task);
+  void WorkerMain();
+
+  std::mutex lock_;
+  std::condition_variable task_posted_;
+  std::deque<std::function<void()>> tasks_;
+  bool shutting_down_ = false;
+  std::vector<std::thread> threads_;
+};
+
+#endif  // CORE_FXCRT_CFX_THREADPOOL_H_
@@ -0,0 +1,79 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxcrt/cfx_threadpool.h"
+
+#include <atomic>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Returns how often each item in [0, `count`) was visited.
+std::vector<int> VisitAll(size_t count, size_t grain_size) {
+  std::vector<std::atomic<int>> visits(count);
+  CFX_ThreadPool::ParallelFor(count, grain_size,
+                              [&visits](size_t begin, size_t end) {
+                                for (size_t i = begin; i < end; ++i) {
+                                  ++visits[i];
+                                }
+                              });
+  std::vector<int> result;
+  for (const auto& visit : visits) {
+    result.push_back(visit.load());
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(CFXThreadPool, NoPool) {
+  ASSERT_FALSE(CFX_ThreadPool::GetInstance());
+  EXPECT_EQ(1u, CFX_ThreadPool::GetConcurrency());
+  EXPECT_EQ(std::vector<int>(100, 1), VisitAll(100, 7));
+  EXPECT_TRUE(VisitAll(0, 7).empty());
+}
+
+TEST(CFXThreadPool, ZeroThreads) {
+  CFX_ThreadPool::InitializeGlobals(0);
+  EXPECT_FALSE(CFX_ThreadPool::GetInstance());
+  CFX_ThreadPool::DestroyGlobals();
+}
+
+TEST(CFXThreadPool, ParallelFor) {
+  CFX_ThreadPool::InitializeGlobals(3);
+  ASSERT_TRUE(CFX_ThreadPool::GetInstance());
+  EXPECT_EQ(4u, CFX_ThreadPool::GetConcurrency());
+  EXPECT_EQ(std::vector<int>(1000, 1), VisitAll(1000, 7));
+  EXPECT_EQ(std::vector<int>(5, 1), VisitAll(5, 0));
+  EXPECT_EQ(std::vector<int>(5, 1), VisitAll(5, 100));
+  CFX_ThreadPool::DestroyGlobals();
+  EXPECT_FALSE(CFX_ThreadPool::GetInstance());
+}
+
+TEST(CFXThreadPool, NestedParallelFor) {
+  CFX_ThreadPool::InitializeGlobals(2);
+  std::atomic<int> visits{0};
+  CFX_ThreadPool::ParallelFor(8, 1, [&visits](size_t begin, size_t end) {
+    CFX_ThreadPool::ParallelFor(
+        50, 3, [&visits](size_t inner_begin, size_t inner_end) {
+          visits += static_cast<int>(inner_end - inner_begin);
+        });
+  });
+  EXPECT_EQ(400, visits.load());
+  CFX_ThreadPool::DestroyGlobals();
+}
+
+TEST(CFXThreadPool, ShouldSplitImage) {
+  EXPECT_FALSE(CFX_ThreadPool::ShouldSplitImage(5000, 5000));
+
+  CFX_ThreadPool::InitializeGlobals(2);
+  EXPECT_TRUE(CFX_ThreadPool::ShouldSplitImage(5000, 5000));
+  EXPECT_TRUE(CFX_ThreadPool::ShouldSplitImage(1024 * 1024, 1));
+  EXPECT_FALSE(CFX_ThreadPool::ShouldSplitImage(200, 150));
+  EXPECT_FALSE(CFX_ThreadPool::ShouldSplitImage(0, 5000));
+  EXPECT_FALSE(CFX_ThreadPool::ShouldSplitImage(5000, 0));
+  CFX_ThreadPool::DestroyGlobals();
+}
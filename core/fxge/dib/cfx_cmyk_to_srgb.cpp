@@ -12,6 +12,10 @@
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/fx_system.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace fxge {
 
 namespace {
@@ -1665,69 +1669,167 @@ constexpr inline int IndexFromCMYK(int c, int m, int y, int k) {
   return 9 * 9 * 9 * c + 9 * 9 * m + 9 * y + k;
 }
 
+// Where one component falls on the grid of `kCMYK`: the nearest node, the
+// node next to it to interpolate towards, and how far towards it to go.
+struct GridStep {
+  uint8_t index;
+  uint8_t neighbor;
+  int16_t rate;
+};
+
+constexpr GridStep GridStepFromComponent(uint8_t value) {
+  const int fix = value << 8;
+  const int index = (fix + 4096) >> 13;
+  int neighbor = fix >> 13;
+  if (neighbor == index) {
+    neighbor = neighbor == 8 ? neighbor - 1 : neighbor + 1;
+  }
+  return {static_cast<uint8_t>(index), static_cast<uint8_t>(neighbor),
+          static_cast<int16_t>((fix - (index << 13)) * (index - neighbor))};
+}
+
+// The same for all components, so they are only worked out once.
+constexpr std::array<GridStep, 256> kGridSteps = [] {
+  std::array<GridStep, 256> steps = {};
+  for (int i = 0; i < 256; ++i) {
+    steps[i] = GridStepFromComponent(static_cast<uint8_t>(i));
+  }
+  return steps;
+}();
+
+// Distances in `kCMYK` between neighboring nodes along each component.
+constexpr int kCyanStride = IndexFromCMYK(1, 0, 0, 0);
+constexpr int kMagentaStride = IndexFromCMYK(0, 1, 0, 0);
+constexpr int kYellowStride = IndexFromCMYK(0, 0, 1, 0);
+constexpr int kKeyStride = IndexFromCMYK(0, 0, 0, 1);
+
+// The `kCMYK` indices of the node nearest to a color, followed by those of
+// its neighbors along each component.
+struct GridNodes {
+  int start;
+  std::array<int, 4> neighbors;
+  std::array<int, 4> rates;
+};
+
+GridNodes GridNodesFromCMYK(uint8_t c, uint8_t m, uint8_t y, uint8_t k) {
+  const GridStep& c_step = kGridSteps[c];
+  const GridStep& m_step = kGridSteps[m];
+  const GridStep& y_step = kGridSteps[y];
+  const GridStep& k_step = kGridSteps[k];
+  const int start = IndexFromCMYK(c_step.index, m_step.index, y_step.index,
+                                  k_step.index);
+  return {
+      start,
+      {start + (c_step.neighbor - c_step.index) * kCyanStride,
+       start + (m_step.neighbor - m_step.index) * kMagentaStride,
+       start + (y_step.neighbor - y_step.index) * kYellowStride,
+       start + (k_step.neighbor - k_step.index) * kKeyStride},
+      {c_step.rate, m_step.rate, y_step.rate, k_step.rate},
+  };
+}
+
+#if defined(__SSE2__)
+// `kCMYK` with each node padded to 32 bits in blue, green, red order, so a
+// node can be loaded into a vector register in one go.
+constexpr std::array<uint32_t, 9 * 9 * 9 * 9> kPaddedBGR = [] {
+  std::array<uint32_t, 9 * 9 * 9 * 9> nodes = {};
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    nodes[i] = kCMYK[i].blue | (kCMYK[i].green << 8) | (kCMYK[i].red << 16);
+  }
+  return nodes;
+}();
+
+// Returns `(a - b) * rate / 32` for the 16-bit lanes of `a` and `b`, with the
+// products of the low 4 lanes in `lo` and those of the high 4 lanes in `hi`.
+void ScaledDifferences(__m128i a,
+                       __m128i b,
+                       __m128i rate,
+                       __m128i& lo,
+                       __m128i& hi) {
+  const __m128i diff = _mm_sub_epi16(a, b);
+  const __m128i prod_lo = _mm_mullo_epi16(diff, rate);
+  const __m128i prod_hi = _mm_mulhi_epi16(diff, rate);
+  lo = _mm_unpacklo_epi16(prod_lo, prod_hi);
+  hi = _mm_unpackhi_epi16(prod_lo, prod_hi);
+  // Division rounds towards zero, so negative values need a bias first.
+  lo = _mm_srai_epi32(
+      _mm_add_epi32(lo, _mm_srli_epi32(_mm_srai_epi32(lo, 31), 27)), 5);
+  hi = _mm_srai_epi32(
+      _mm_add_epi32(hi, _mm_srli_epi32(_mm_srai_epi32(hi, 31), 27)), 5);
+}
+
+// Loads the nodes at `index_lo` and `index_hi` as 16-bit lanes.
+__m128i LoadNodePair(int index_lo, int index_hi) {
+  return _mm_unpacklo_epi8(
+      _mm_set_epi32(0, 0, kPaddedBGR[index_hi], kPaddedBGR[index_lo]),
+      _mm_setzero_si128());
+}
+
+// Does the work of AdobeCMYK_to_sRGB1() for all 3 channels at once, returning
+// blue, green and red in the low 3 bytes.
+uint32_t ConvertPixel(const FX_CMYK_STRUCT<uint8_t>& cmyk) {
+  const GridNodes nodes =
+      GridNodesFromCMYK(cmyk.cyan, cmyk.magenta, cmyk.yellow, cmyk.key);
+  const __m128i start = LoadNodePair(nodes.start, nodes.start);
+  const __m128i cm_rates =
+      _mm_unpacklo_epi64(_mm_set1_epi16(nodes.rates[0]),
+                         _mm_set1_epi16(nodes.rates[1]));
+  const __m128i yk_rates =
+      _mm_unpacklo_epi64(_mm_set1_epi16(nodes.rates[2]),
+                         _mm_set1_epi16(nodes.rates[3]));
+  __m128i c;
+  __m128i m;
+  __m128i y;
+  __m128i k;
+  ScaledDifferences(start,
+                    LoadNodePair(nodes.neighbors[0], nodes.neighbors[1]),
+                    cm_rates, c, m);
+  ScaledDifferences(start,
+                    LoadNodePair(nodes.neighbors[2], nodes.neighbors[3]),
+                    yk_rates, y, k);
+  __m128i sum =
+      _mm_slli_epi32(_mm_unpacklo_epi16(start, _mm_setzero_si128()), 8);
+  sum = _mm_add_epi32(_mm_add_epi32(sum, c),
+                      _mm_add_epi32(m, _mm_add_epi32(y, k)));
+  // Clamp negative sums to 0.
+  sum = _mm_andnot_si128(_mm_srai_epi32(sum, 31), sum);
+  sum = _mm_srli_epi32(sum, 8);
+  sum = _mm_packs_epi32(sum, sum);
+  return _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+}
+#endif  // defined(__SSE2__)
+
+FX_BGR_STRUCT<uint8_t> ConvertToBGR(const FX_CMYK_STRUCT<uint8_t>& cmyk) {
+#if defined(__SSE2__)
+  // The result has blue, green and red in its low 3 bytes.
+  const uint32_t bgr = ConvertPixel(cmyk);
+  return {static_cast<uint8_t>(bgr), static_cast<uint8_t>(bgr >> 8),
+          static_cast<uint8_t>(bgr >> 16)};
+#else
+  const FX_RGB_STRUCT<uint8_t> rgb =
+      AdobeCMYK_to_sRGB1(cmyk.cyan, cmyk.magenta, cmyk.yellow, cmyk.key);
+  return {rgb.blue, rgb.green, rgb.red};
+#endif
+}
+
 }  // namespace
 
 FX_RGB_STRUCT<uint8_t> AdobeCMYK_to_sRGB1(uint8_t c,
                                           uint8_t m,
                                           uint8_t y,
                                           uint8_t k) {
-  int fix_c = c << 8;
-  int fix_m = m << 8;
-  int fix_y = y << 8;
-  int fix_k = k << 8;
-  int c_index = (fix_c + 4096) >> 13;
-  int m_index = (fix_m + 4096) >> 13;
-  int y_index = (fix_y + 4096) >> 13;
-  int k_index = (fix_k + 4096) >> 13;
-  const auto& start_rgb =
-      kCMYK[IndexFromCMYK(c_index, m_index, y_index, k_index)];
+  const GridNodes nodes = GridNodesFromCMYK(c, m, y, k);
+  const auto& start_rgb = kCMYK[nodes.start];
   int fix_r = start_rgb.red << 8;
   int fix_g = start_rgb.green << 8;
   int fix_b = start_rgb.blue << 8;
-  int c1_index = fix_c >> 13;
-  if (c1_index == c_index) {
-    c1_index = c1_index == 8 ? c1_index - 1 : c1_index + 1;
+  for (size_t i = 0; i < nodes.neighbors.size(); ++i) {
+    const auto& neighbor_rgb = kCMYK[nodes.neighbors[i]];
+    const int rate = nodes.rates[i];
+    fix_r += (start_rgb.red - neighbor_rgb.red) * rate / 32;
+    fix_g += (start_rgb.green - neighbor_rgb.green) * rate / 32;
+    fix_b += (start_rgb.blue - neighbor_rgb.blue) * rate / 32;
   }
-  int m1_index = fix_m >> 13;
-  if (m1_index == m_index) {
-    m1_index = m1_index == 8 ? m1_index - 1 : m1_index + 1;
-  }
-  int y1_index = fix_y >> 13;
-  if (y1_index == y_index) {
-    y1_index = y1_index == 8 ? y1_index - 1 : y1_index + 1;
-  }
-  int k1_index = fix_k >> 13;
-  if (k1_index == k_index) {
-    k1_index = k1_index == 8 ? k1_index - 1 : k1_index + 1;
-  }
-
-  const auto& c1_rgb =
-      kCMYK[IndexFromCMYK(c1_index, m_index, y_index, k_index)];
-  const int c_rate = (fix_c - (c_index << 13)) * (c_index - c1_index);
-  fix_r += (start_rgb.red - c1_rgb.red) * c_rate / 32;
-  fix_g += (start_rgb.green - c1_rgb.green) * c_rate / 32;
-  fix_b += (start_rgb.blue - c1_rgb.blue) * c_rate / 32;
-
-  const auto& m1_rgb =
-      kCMYK[IndexFromCMYK(c_index, m1_index, y_index, k_index)];
-  const int m_rate = (fix_m - (m_index << 13)) * (m_index - m1_index);
-  fix_r += (start_rgb.red - m1_rgb.red) * m_rate / 32;
-  fix_g += (start_rgb.green - m1_rgb.green) * m_rate / 32;
-  fix_b += (start_rgb.blue - m1_rgb.blue) * m_rate / 32;
-
-  const auto& y1_rgb =
-      kCMYK[IndexFromCMYK(c_index, m_index, y1_index, k_index)];
-  const int y_rate = (fix_y - (y_index << 13)) * (y_index - y1_index);
-  fix_r += (start_rgb.red - y1_rgb.red) * y_rate / 32;
-  fix_g += (start_rgb.green - y1_rgb.green) * y_rate / 32;
-  fix_b += (start_rgb.blue - y1_rgb.blue) * y_rate / 32;
-
-  const auto& k1_rgb =
-      kCMYK[IndexFromCMYK(c_index, m_index, y_index, k1_index)];
-  const int k_rate = (fix_k - (k_index << 13)) * (k_index - k1_index);
-  fix_r += (start_rgb.red - k1_rgb.red) * k_rate / 32;
-  fix_g += (start_rgb.green - k1_rgb.green) * k_rate / 32;
-  fix_b += (start_rgb.blue - k1_rgb.blue) * k_rate / 32;
 
   fix_r = std::max(fix_r, 0) >> 8;
   fix_g = std::max(fix_g, 0) >> 8;
@@ -1737,6 +1839,27 @@ FX_RGB_STRUCT<uint8_t> AdobeCMYK_to_sRGB1(uint8_t c,
           static_cast<uint8_t>(fix_b)};
 }
 
+void AdobeCMYK_to_sRGB1Row(pdfium::span<const FX_CMYK_STRUCT<uint8_t>> src,
+                           pdfium::span<FX_BGR_STRUCT<uint8_t>> dest) {
+  if (src.empty()) {
+    return;
+  }
+
+  dest = dest.first(src.size());
+  // Images often have runs of one color, which only need converting once.
+  FX_CMYK_STRUCT<uint8_t> last_cmyk = src.front();
+  FX_BGR_STRUCT<uint8_t> last_bgr = ConvertToBGR(last_cmyk);
+  for (size_t i = 0; i < src.size(); ++i) {
+    const FX_CMYK_STRUCT<uint8_t> cmyk = src[i];
+    if (cmyk.cyan != last_cmyk.cyan || cmyk.magenta != last_cmyk.magenta ||
+        cmyk.yellow != last_cmyk.yellow || cmyk.key != last_cmyk.key) {
+      last_cmyk = cmyk;
+      last_bgr = ConvertToBGR(cmyk);
+    }
+    dest[i] = last_bgr;
+  }
+}
+
 FX_RGB_STRUCT<float> AdobeCMYK_to_sRGB(float c, float m, float y, float k) {
   // Convert to uint8_t with round-to-nearest. Avoid using FXSYS_roundf because
   // it is incredibly expensive with VC++ (tested on VC++ 2015) because round()
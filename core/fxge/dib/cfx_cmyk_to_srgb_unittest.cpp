@@ -4,8 +4,43 @@
 
 #include "core/fxge/dib/cfx_cmyk_to_srgb.h"
 
+#include <stdint.h>
+
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 
+namespace {
+
+// Returns `count` pixels of pseudo-random CMYK colors.
+std::vector<FX_CMYK_STRUCT<uint8_t>> CreateRandomPixels(size_t count) {
+  std::vector<FX_CMYK_STRUCT<uint8_t>> pixels(count);
+  uint32_t state = 1;
+  for (auto& pixel : pixels) {
+    state = state * 1103515245 + 12345;
+    pixel = {static_cast<uint8_t>(state >> 24),
+             static_cast<uint8_t>(state >> 16),
+             static_cast<uint8_t>(state >> 8), static_cast<uint8_t>(state)};
+  }
+  return pixels;
+}
+
+// Checks that converting `src` as a row gives the same colors as converting
+// each of its pixels.
+void CheckRowMatchesPixels(const std::vector<FX_CMYK_STRUCT<uint8_t>>& src) {
+  std::vector<FX_BGR_STRUCT<uint8_t>> dest(src.size());
+  AdobeCMYK_to_sRGB1Row(src, dest);
+  for (size_t i = 0; i < src.size(); ++i) {
+    const FX_RGB_STRUCT<uint8_t> rgb = AdobeCMYK_to_sRGB1(
+        src[i].cyan, src[i].magenta, src[i].yellow, src[i].key);
+    ASSERT_EQ(rgb.red, dest[i].red) << i;
+    ASSERT_EQ(rgb.green, dest[i].green) << i;
+    ASSERT_EQ(rgb.blue, dest[i].blue) << i;
+  }
+}
+
+}  // namespace
+
 union Float_t {
   Float_t(float num = 0.0f) : f(num) {}
 
@@ -28,3 +63,37 @@ TEST(fxge, CMYKRounding) {
   // Check various other 'special' numbers.
   rgb = AdobeCMYK_to_sRGB(0.0f, 0.25f, 0.5f, 1.0f);
 }
+
+TEST(fxge, CMYKRow) {
+  // Every grid node, the values either side of them, and the extremes.
+  std::vector<FX_CMYK_STRUCT<uint8_t>> src;
+  static constexpr uint8_t kValues[] = {0,   1,   15,  16,  17,  31,  32,
+                                        33,  100, 127, 128, 129, 200, 223,
+                                        224, 225, 239, 240, 254, 255};
+  for (uint8_t c : kValues) {
+    for (uint8_t m : kValues) {
+      for (uint8_t y : kValues) {
+        for (uint8_t k : kValues) {
+          src.push_back({c, m, y, k});
+        }
+      }
+    }
+  }
+  CheckRowMatchesPixels(src);
+  CheckRowMatchesPixels(CreateRandomPixels(100000));
+
+  // Runs of one color.
+  src = CreateRandomPixels(100);
+  for (size_t i = 0; i + 1 < src.size(); i += 3) {
+    src[i + 1] = src[i];
+  }
+  CheckRowMatchesPixels(src);
+
+  // Only writes as many pixels as there are in `src`.
+  std::vector<FX_BGR_STRUCT<uint8_t>> dest(3, {1, 2, 3});
+  AdobeCMYK_to_sRGB1Row(pdfium::span(src).first(2u), dest);
+  EXPECT_EQ(1, dest[2].blue);
+  EXPECT_EQ(2, dest[2].green);
+  EXPECT_EQ(3, dest[2].red);
+  AdobeCMYK_to_sRGB1Row({}, dest);
+}
@@ -13,6 +13,7 @@
 #include <memory>
 #include <utility>
 
+#include "core/fxcrt/cfx_threadpool.h"
 #include "core/fxcrt/check.h"
 #include "core/fxcrt/compiler_specific.h"
 #include "core/fxcrt/fx_system.h"
@@ -111,29 +112,40 @@ void DoBilinearLoop(const CFX_ImageTransformer::CalcData& calc_data,
                     const FX_RECT& clip_rect,
                     int increment,
                     const F& func) {
-  CFX_BilinearMatrix matrix_fix(calc_data.matrix);
-  for (int row = 0; row < result_rect.Height(); row++) {
-    uint8_t* dest = calc_data.bitmap->GetWritableScanline(row).data();
-    for (int col = 0; col < result_rect.Width(); col++) {
-      CFX_ImageTransformer::BilinearData d;
-      d.res_x = 0;
-      d.res_y = 0;
-      d.src_col_l = 0;
-      d.src_row_l = 0;
-      matrix_fix.Transform(col, row, &d.src_col_l, &d.src_row_l, &d.res_x,
-                           &d.res_y);
-      if (LIKELY(InStretchBounds(clip_rect, d.src_col_l, d.src_row_l))) {
-        AdjustCoords(clip_rect, &d.src_col_l, &d.src_row_l);
-        d.src_col_r = d.src_col_l + 1;
-        d.src_row_r = d.src_row_l + 1;
-        AdjustCoords(clip_rect, &d.src_col_r, &d.src_row_r);
-        d.row_offset_l = d.src_row_l * calc_data.pitch;
-        d.row_offset_r = d.src_row_r * calc_data.pitch;
-        func(d, dest);
-      }
-      UNSAFE_TODO(dest += increment);
-    }
-  }
+  const CFX_BilinearMatrix matrix_fix(calc_data.matrix);
+  // Rows are independent, so spread large images over the thread pool, if
+  // any. `func` must therefore only read shared state.
+  const size_t rows = result_rect.Height();
+  const size_t rows_per_range =
+      CFX_ThreadPool::ShouldSplitImage(result_rect.Width(), rows)
+          ? CFX_ThreadPool::kImageRowsPerRange
+          : rows;
+  CFX_ThreadPool::ParallelFor(
+      rows, rows_per_range, [&](size_t begin, size_t end) {
+        for (int row = static_cast<int>(begin); row < static_cast<int>(end);
+             row++) {
+          uint8_t* dest = calc_data.bitmap->GetWritableScanline(row).data();
+          for (int col = 0; col < result_rect.Width(); col++) {
+            CFX_ImageTransformer::BilinearData d;
+            d.res_x = 0;
+            d.res_y = 0;
+            d.src_col_l = 0;
+            d.src_row_l = 0;
+            matrix_fix.Transform(col, row, &d.src_col_l, &d.src_row_l,
+                                 &d.res_x, &d.res_y);
+            if (LIKELY(InStretchBounds(clip_rect, d.src_col_l, d.src_row_l))) {
+              AdjustCoords(clip_rect, &d.src_col_l, &d.src_row_l);
+              d.src_col_r = d.src_col_l + 1;
+              d.src_row_r = d.src_row_l + 1;
+              AdjustCoords(clip_rect, &d.src_col_r, &d.src_row_r);
+              d.row_offset_l = d.src_row_l * calc_data.pitch;
+              d.row_offset_r = d.src_row_r * calc_data.pitch;
+              func(d, dest);
+            }
+            UNSAFE_TODO(dest += increment);
+          }
+        }
+      });
 }
 
 }  // namespace
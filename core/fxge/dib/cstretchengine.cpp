@@ -9,17 +9,21 @@
 #include <math.h>
 
 #include <algorithm>
+#include <array>
 #include <type_traits>
 #include <utility>
 
+#include "core/fxcrt/cfx_threadpool.h"
 #include "core/fxcrt/check.h"
 #include "core/fxcrt/fx_safe_types.h"
 #include "core/fxcrt/fx_system.h"
 #include "core/fxcrt/pauseindicator_iface.h"
+#include "core/fxcrt/span_util.h"
 #include "core/fxge/calculate_pitch.h"
 #include "core/fxge/dib/cfx_dibbase.h"
 #include "core/fxge/dib/cfx_dibitmap.h"
 #include "core/fxge/dib/fx_dib.h"
+#include "core/fxge/dib/resample_filter.h"
 #include "core/fxge/dib/scanlinecomposer_iface.h"
 
 static_assert(
@@ -320,8 +324,11 @@ bool CStretchEngine::ContinueStretchHorz(PauseIndicatorIface* pPause) {
   if (source_->SkipToScanline(cur_row_, pPause)) {
     return true;
   }
+  if (CFX_ThreadPool::ShouldSplitImage(dest_clip_.Width(),
+                                       src_clip_.Height())) {
+    return ContinueStretchHorzInBands(pPause);
+  }
 
-  int Bpp = dest_bpp_ / 8;
   static const int kStrechPauseRows = 10;
   int rows_to_go = kStrechPauseRows;
   for (; cur_row_ < src_clip_.bottom; ++cur_row_) {
@@ -333,115 +340,139 @@ bool CStretchEngine::ContinueStretchHorz(PauseIndicatorIface* pPause) {
       rows_to_go = kStrechPauseRows;
     }
 
-    const uint8_t* src_scan = source_->GetScanline(cur_row_).data();
-    pdfium::span<uint8_t> dest_span = inter_buf_.subspan(
-        (cur_row_ - src_clip_.top) * inter_pitch_, inter_pitch_);
-    size_t dest_span_index = 0;
-    // TODO(npm): reduce duplicated code here
-    UNSAFE_TODO({
-      switch (trans_method_) {
-        case TransformMethod::k1BppTo8Bpp:
-        case TransformMethod::k1BppToManyBpp: {
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
-            uint32_t dest_a = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              if (src_scan[j / 8] & (1 << (7 - j % 8))) {
-                dest_a += pixel_weight * 255;
-              }
-            }
-            dest_span[dest_span_index++] = PixelFromFixed(dest_a);
+    StretchHorzRow(source_->GetScanline(cur_row_),
+                   inter_buf_.subspan((cur_row_ - src_clip_.top) * inter_pitch_,
+                                      inter_pitch_));
+    rows_to_go--;
+  }
+  return false;
+}
+
+bool CStretchEngine::ContinueStretchHorzInBands(PauseIndicatorIface* pPause) {
+  // Sources may decode rows on demand into a single buffer, so fetch each band
+  // of rows sequentially, then filter the band in parallel.
+  const size_t src_pitch = source_->GetPitch();
+  const int band_rows = static_cast<int>(CFX_ThreadPool::kImageRowsPerRange *
+                                         CFX_ThreadPool::GetConcurrency());
+  DataVector<uint8_t> band(band_rows * src_pitch);
+  while (cur_row_ < src_clip_.bottom) {
+    const int rows = std::min(band_rows, src_clip_.bottom - cur_row_);
+    for (int i = 0; i < rows; ++i) {
+      pdfium::span<const uint8_t> scanline = source_->GetScanline(cur_row_ + i);
+      fxcrt::spancpy(
+          pdfium::span(band).subspan(i * src_pitch, src_pitch),
+          scanline.first(std::min(scanline.size(), src_pitch)));
+    }
+    const int band_top = cur_row_;
+    CFX_ThreadPool::ParallelFor(
+        rows, CFX_ThreadPool::kImageRowsPerRange,
+        [this, &band, src_pitch, band_top](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            const int row = band_top + static_cast<int>(i);
+            StretchHorzRow(pdfium::span(band).subspan(i * src_pitch, src_pitch),
+                           inter_buf_.subspan(
+                               (row - src_clip_.top) * inter_pitch_,
+                               inter_pitch_));
           }
-          break;
-        }
-        case TransformMethod::k8BppTo8Bpp: {
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
-            uint32_t dest_a = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              dest_a += pixel_weight * src_scan[j];
+        });
+    cur_row_ += rows;
+    if (cur_row_ < src_clip_.bottom && pPause && pPause->NeedToPauseNow()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CStretchEngine::StretchHorzRow(pdfium::span<const uint8_t> src_span,
+                                    pdfium::span<uint8_t> dest_span) const {
+  const int Bpp = dest_bpp_ / 8;
+  const uint8_t* src_scan = src_span.data();
+  size_t dest_span_index = 0;
+  // TODO(npm): reduce duplicated code here
+  UNSAFE_TODO({
+    switch (trans_method_) {
+      case TransformMethod::k1BppTo8Bpp:
+      case TransformMethod::k1BppToManyBpp: {
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          const PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
+          uint32_t dest_a = 0;
+          for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
+            uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
+            if (src_scan[j / 8] & (1 << (7 - j % 8))) {
+              dest_a += pixel_weight * 255;
             }
-            dest_span[dest_span_index++] = PixelFromFixed(dest_a);
           }
-          break;
+          dest_span[dest_span_index++] = PixelFromFixed(dest_a);
         }
-        case TransformMethod::k8BppToManyBpp: {
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
-            uint32_t dest_r = 0;
-            uint32_t dest_g = 0;
-            uint32_t dest_b = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              FX_ARGB argb = src_palette_[src_scan[j]];
-              if (dest_format_ == FXDIB_Format::kBgr) {
-                dest_r += pixel_weight * static_cast<uint8_t>(argb >> 16);
-                dest_g += pixel_weight * static_cast<uint8_t>(argb >> 8);
-                dest_b += pixel_weight * static_cast<uint8_t>(argb);
-              } else {
-                dest_b += pixel_weight * static_cast<uint8_t>(argb >> 24);
-                dest_g += pixel_weight * static_cast<uint8_t>(argb >> 16);
-                dest_r += pixel_weight * static_cast<uint8_t>(argb >> 8);
-              }
-            }
-            dest_span[dest_span_index++] = PixelFromFixed(dest_b);
-            dest_span[dest_span_index++] = PixelFromFixed(dest_g);
-            dest_span[dest_span_index++] = PixelFromFixed(dest_r);
-          }
-          break;
+        break;
+      }
+      case TransformMethod::k8BppTo8Bpp: {
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          const PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
+          uint32_t dest_a = fxge::WeightedSum8(
+              src_span.subspan(static_cast<size_t>(pWeights->src_start_)),
+              pWeights->GetWeights());
+          dest_span[dest_span_index++] = PixelFromFixed(dest_a);
         }
-        case TransformMethod::kManyBpptoManyBpp: {
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
-            uint32_t dest_r = 0;
-            uint32_t dest_g = 0;
-            uint32_t dest_b = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              const uint8_t* src_pixel = src_scan + j * Bpp;
-              dest_b += pixel_weight * (*src_pixel++);
-              dest_g += pixel_weight * (*src_pixel++);
-              dest_r += pixel_weight * (*src_pixel);
+        break;
+      }
+      case TransformMethod::k8BppToManyBpp: {
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          const PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
+          uint32_t dest_r = 0;
+          uint32_t dest_g = 0;
+          uint32_t dest_b = 0;
+          for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
+            uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
+            FX_ARGB argb = src_palette_[src_scan[j]];
+            if (dest_format_ == FXDIB_Format::kBgr) {
+              dest_r += pixel_weight * static_cast<uint8_t>(argb >> 16);
+              dest_g += pixel_weight * static_cast<uint8_t>(argb >> 8);
+              dest_b += pixel_weight * static_cast<uint8_t>(argb);
+            } else {
+              dest_b += pixel_weight * static_cast<uint8_t>(argb >> 24);
+              dest_g += pixel_weight * static_cast<uint8_t>(argb >> 16);
+              dest_r += pixel_weight * static_cast<uint8_t>(argb >> 8);
             }
-            dest_span[dest_span_index++] = PixelFromFixed(dest_b);
-            dest_span[dest_span_index++] = PixelFromFixed(dest_g);
-            dest_span[dest_span_index++] = PixelFromFixed(dest_r);
-            dest_span_index += Bpp - 3;
           }
-          break;
+          dest_span[dest_span_index++] = PixelFromFixed(dest_b);
+          dest_span[dest_span_index++] = PixelFromFixed(dest_g);
+          dest_span[dest_span_index++] = PixelFromFixed(dest_r);
         }
-        case TransformMethod::kManyBpptoManyBppWithAlpha: {
-          DCHECK(has_alpha_);
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
-            uint32_t dest_a = 0;
-            uint32_t dest_r = 0;
-            uint32_t dest_g = 0;
-            uint32_t dest_b = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              const uint8_t* src_pixel = src_scan + j * Bpp;
-              uint32_t pixel_weight =
-                  pWeights->GetWeightForPosition(j) * src_pixel[3] / 255;
-              dest_b += pixel_weight * (*src_pixel++);
-              dest_g += pixel_weight * (*src_pixel++);
-              dest_r += pixel_weight * (*src_pixel);
-              dest_a += pixel_weight;
-            }
-            dest_span[dest_span_index++] = PixelFromFixed(dest_b);
-            dest_span[dest_span_index++] = PixelFromFixed(dest_g);
-            dest_span[dest_span_index++] = PixelFromFixed(dest_r);
-            dest_span[dest_span_index] = PixelFromFixed(255 * dest_a);
-            dest_span_index += Bpp - 3;
-          }
-          break;
+        break;
+      }
+      case TransformMethod::kManyBpptoManyBpp: {
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          const PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
+          std::array<uint32_t, 3> dest_bgr = fxge::WeightedSumBgr(
+              src_span.subspan(
+                  static_cast<size_t>(pWeights->src_start_ * Bpp)),
+              Bpp, pWeights->GetWeights());
+          dest_span[dest_span_index++] = PixelFromFixed(dest_bgr[0]);
+          dest_span[dest_span_index++] = PixelFromFixed(dest_bgr[1]);
+          dest_span[dest_span_index++] = PixelFromFixed(dest_bgr[2]);
+          dest_span_index += Bpp - 3;
         }
+        break;
       }
-    });
-    rows_to_go--;
-  }
-  return false;
+      case TransformMethod::kManyBpptoManyBppWithAlpha: {
+        DCHECK(has_alpha_);
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          const PixelWeight* pWeights = weight_table_.GetPixelWeight(col);
+          std::array<uint32_t, 4> dest_bgra = fxge::AlphaWeightedSumBgra(
+              src_span.subspan(
+                  static_cast<size_t>(pWeights->src_start_ * Bpp)),
+              pWeights->GetWeights());
+          dest_span[dest_span_index++] = PixelFromFixed(dest_bgra[0]);
+          dest_span[dest_span_index++] = PixelFromFixed(dest_bgra[1]);
+          dest_span[dest_span_index++] = PixelFromFixed(dest_bgra[2]);
+          dest_span[dest_span_index] = PixelFromFixed(255 * dest_bgra[3]);
+          dest_span_index += Bpp - 3;
+        }
+        break;
+      }
+    }
+  });
 }
 
 void CStretchEngine::StretchVert() {
@@ -456,87 +487,113 @@ void CStretchEngine::StretchVert() {
     return;
   }
 
-  const int DestBpp = dest_bpp_ / 8;
-  UNSAFE_TODO({
+  const size_t dest_bytes = static_cast<size_t>(dest_clip_.Width()) *
+                            static_cast<size_t>(dest_bpp_ / 8);
+  const int dest_rows = dest_clip_.Height();
+  if (!CFX_ThreadPool::ShouldSplitImage(dest_clip_.Width(), dest_rows)) {
+    DataVector<uint32_t> sums(dest_bytes);
     for (int row = dest_clip_.top; row < dest_clip_.bottom; ++row) {
-      unsigned char* dest_scan = dest_scanline_.data();
-      PixelWeight* pWeights = table.GetPixelWeight(row);
-      switch (trans_method_) {
-        case TransformMethod::k1BppTo8Bpp:
-        case TransformMethod::k1BppToManyBpp:
-        case TransformMethod::k8BppTo8Bpp: {
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            pdfium::span<const uint8_t> src_span =
-                inter_buf_.subspan((col - dest_clip_.left) * DestBpp);
-            uint32_t dest_a = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              dest_a +=
-                  pixel_weight * src_span[(j - src_clip_.top) * inter_pitch_];
-            }
-            *dest_scan = PixelFromFixed(dest_a);
-            dest_scan += DestBpp;
+      StretchVertRow(*table.GetPixelWeight(row), sums, dest_scanline_);
+      dest_bitmap_->ComposeScanline(row - dest_clip_.top, dest_scanline_);
+    }
+    return;
+  }
+
+  // Filter bands of rows in parallel, but compose them in order. Each band row
+  // starts out like `dest_scanline_`, as bytes not written by StretchVertRow()
+  // must keep their initial values.
+  const size_t dest_pitch = dest_scanline_.size();
+  const int band_rows = static_cast<int>(CFX_ThreadPool::kImageRowsPerRange *
+                                         CFX_ThreadPool::GetConcurrency());
+  DataVector<uint8_t> band(band_rows * dest_pitch);
+  for (int i = 0; i < band_rows; ++i) {
+    fxcrt::spancpy(pdfium::span(band).subspan(i * dest_pitch, dest_pitch),
+                   pdfium::span(dest_scanline_));
+  }
+  for (int band_top = 0; band_top < dest_rows; band_top += band_rows) {
+    const int rows = std::min(band_rows, dest_rows - band_top);
+    CFX_ThreadPool::ParallelFor(
+        rows, CFX_ThreadPool::kImageRowsPerRange,
+        [this, &table, &band, dest_bytes, dest_pitch, band_top](size_t begin,
+                                                                 size_t end) {
+          DataVector<uint32_t> sums(dest_bytes);
+          for (size_t i = begin; i < end; ++i) {
+            const int row = dest_clip_.top + band_top + static_cast<int>(i);
+            StretchVertRow(
+                *table.GetPixelWeight(row), sums,
+                pdfium::span(band).subspan(i * dest_pitch, dest_pitch));
           }
-          break;
+        });
+    for (int i = 0; i < rows; ++i) {
+      dest_bitmap_->ComposeScanline(
+          band_top + i,
+          pdfium::span(band).subspan(i * dest_pitch, dest_pitch));
+    }
+  }
+}
+
+void CStretchEngine::StretchVertRow(const PixelWeight& weights,
+                                    pdfium::span<uint32_t> sums,
+                                    pdfium::span<uint8_t> dest_span) const {
+  // Filter every byte of the intermediate rows at once, then pick out the
+  // channels each format needs.
+  fxge::WeightedColumnSums(
+      inter_buf_.subspan(static_cast<size_t>(
+          (weights.src_start_ - src_clip_.top) * inter_pitch_)),
+      inter_pitch_, weights.GetWeights(), sums);
+
+  const int DestBpp = dest_bpp_ / 8;
+  const uint32_t* sum = sums.data();
+  UNSAFE_TODO({
+    unsigned char* dest_scan = dest_span.data();
+    switch (trans_method_) {
+      case TransformMethod::k1BppTo8Bpp:
+      case TransformMethod::k1BppToManyBpp:
+      case TransformMethod::k8BppTo8Bpp: {
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          *dest_scan = PixelFromFixed(*sum);
+          dest_scan += DestBpp;
+          sum += DestBpp;
         }
-        case TransformMethod::k8BppToManyBpp:
-        case TransformMethod::kManyBpptoManyBpp: {
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            pdfium::span<const uint8_t> src_span =
-                inter_buf_.subspan((col - dest_clip_.left) * DestBpp);
-            uint32_t dest_r = 0;
-            uint32_t dest_g = 0;
-            uint32_t dest_b = 0;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              pdfium::span<const uint8_t> src_pixel = src_span.subspan(
-                  static_cast<size_t>((j - src_clip_.top) * inter_pitch_), 3u);
-              dest_b += pixel_weight * src_pixel[0];
-              dest_g += pixel_weight * src_pixel[1];
-              dest_r += pixel_weight * src_pixel[2];
-            }
-            dest_scan[0] = PixelFromFixed(dest_b);
-            dest_scan[1] = PixelFromFixed(dest_g);
-            dest_scan[2] = PixelFromFixed(dest_r);
-            dest_scan += DestBpp;
-          }
-          break;
+        break;
+      }
+      case TransformMethod::k8BppToManyBpp:
+      case TransformMethod::kManyBpptoManyBpp: {
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          dest_scan[0] = PixelFromFixed(sum[0]);
+          dest_scan[1] = PixelFromFixed(sum[1]);
+          dest_scan[2] = PixelFromFixed(sum[2]);
+          dest_scan += DestBpp;
+          sum += DestBpp;
         }
-        case TransformMethod::kManyBpptoManyBppWithAlpha: {
-          DCHECK(has_alpha_);
-          for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
-            pdfium::span<const uint8_t> src_span =
-                inter_buf_.subspan((col - dest_clip_.left) * DestBpp);
-            uint32_t dest_a = 0;
-            uint32_t dest_r = 0;
-            uint32_t dest_g = 0;
-            uint32_t dest_b = 0;
-            static constexpr size_t kPixelBytes = 4;
-            for (int j = pWeights->src_start_; j <= pWeights->src_end_; ++j) {
-              uint32_t pixel_weight = pWeights->GetWeightForPosition(j);
-              pdfium::span<const uint8_t> src_pixel = src_span.subspan(
-                  static_cast<size_t>((j - src_clip_.top) * inter_pitch_),
-                  kPixelBytes);
-              dest_b += pixel_weight * src_pixel[0];
-              dest_g += pixel_weight * src_pixel[1];
-              dest_r += pixel_weight * src_pixel[2];
-              dest_a += pixel_weight * src_pixel[3];
-            }
-            if (dest_a) {
-              int r = static_cast<uint32_t>(dest_r) * 255 / dest_a;
-              int g = static_cast<uint32_t>(dest_g) * 255 / dest_a;
-              int b = static_cast<uint32_t>(dest_b) * 255 / dest_a;
-              dest_scan[0] = std::clamp(b, 0, 255);
-              dest_scan[1] = std::clamp(g, 0, 255);
-              dest_scan[2] = std::clamp(r, 0, 255);
-            }
-            dest_scan[3] = PixelFromFixed(dest_a);
-            dest_scan += DestBpp;
+        break;
+      }
+      case TransformMethod::kManyBpptoManyBppWithAlpha: {
+        DCHECK(has_alpha_);
+        for (int col = dest_clip_.left; col < dest_clip_.right; ++col) {
+          const uint32_t dest_b = sum[0];
+          const uint32_t dest_g = sum[1];
+          const uint32_t dest_r = sum[2];
+          const uint32_t dest_a = sum[3];
+          // Fully transparent pixels get zero color rather than whatever the
+          // row above left behind, so rows do not depend on each other.
+          int r = 0;
+          int g = 0;
+          int b = 0;
+          if (dest_a) {
+            r = dest_r * 255 / dest_a;
+            g = dest_g * 255 / dest_a;
+            b = dest_b * 255 / dest_a;
           }
-          break;
+          dest_scan[0] = std::clamp(b, 0, 255);
+          dest_scan[1] = std::clamp(g, 0, 255);
+          dest_scan[2] = std::clamp(r, 0, 255);
+          dest_scan[3] = PixelFromFixed(dest_a);
+          dest_scan += DestBpp;
+          sum += DestBpp;
         }
+        break;
       }
-      dest_bitmap_->ComposeScanline(row - dest_clip_.top, dest_scanline_);
     }
   });
 }
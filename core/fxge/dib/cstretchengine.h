@@ -16,6 +16,7 @@
 #include "core/fxcrt/fx_system.h"
 #include "core/fxcrt/raw_span.h"
 #include "core/fxcrt/retain_ptr.h"
+#include "core/fxcrt/span.h"
 #include "core/fxcrt/unowned_ptr.h"
 #include "core/fxge/dib/fx_dib.h"
 
@@ -65,6 +66,18 @@ class CStretchEngine {
       UNSAFE_BUFFERS(weights_[position - src_start_] = weight);
     }
 
+    // Returns an empty span when `src_end_` < `src_start_`, which happens for
+    // destination pixels that map outside the source clip.
+    pdfium::span<const uint32_t> GetWeights() const {
+      if (src_end_ < src_start_) {
+        return {};
+      }
+      // SAFETY: SetStartEnd() ensures `src_end_ - src_start_` is less than the
+      // number of allocated weights, and it is non-negative here.
+      return UNSAFE_BUFFERS(pdfium::span(
+          weights_, static_cast<size_t>(src_end_ - src_start_ + 1)));
+    }
+
     // NOTE: relies on defined behaviour for unsigned overflow to
     // decrement the previous position, as needed.
     void RemoveLastWeightAndAdjust(uint32_t weight_change) {
@@ -134,6 +147,14 @@ class CStretchEngine {
     kManyBpptoManyBppWithAlpha
   };
 
+  bool ContinueStretchHorzInBands(PauseIndicatorIface* pPause);
+  void StretchHorzRow(pdfium::span<const uint8_t> src_span,
+                      pdfium::span<uint8_t> dest_span) const;
+  // `sums` is scratch space with one entry per byte of `dest_span` pixels.
+  void StretchVertRow(const PixelWeight& weights,
+                      pdfium::span<uint32_t> sums,
+                      pdfium::span<uint8_t> dest_span) const;
+
   const FXDIB_Format dest_format_;
   const int dest_bpp_;
   const int src_bpp_;
@@ -4,14 +4,31 @@
 
 #include "core/fxge/dib/cstretchengine.h"
 
+#include <algorithm>
+#include <array>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "core/fpdfapi/page/cpdf_dib.h"
+#include "core/fpdfapi/page/cpdf_pagemodule.h"
 #include "core/fpdfapi/parser/cpdf_dictionary.h"
+#include "core/fpdfapi/parser/cpdf_name.h"
 #include "core/fpdfapi/parser/cpdf_number.h"
 #include "core/fpdfapi/parser/cpdf_stream.h"
+#include "core/fpdfapi/parser/cpdf_test_document.h"
+#include "core/fxcodec/jpeg/jpegmodule.h"
+#include "core/fxcrt/cfx_threadpool.h"
+#include "core/fxcrt/data_vector.h"
+#include "core/fxcrt/pauseindicator_iface.h"
+#include "core/fxge/dib/cfx_bitmapstorer.h"
+#include "core/fxge/dib/cfx_dibitmap.h"
+#include "core/fxge/dib/cfx_imagestretcher.h"
 #include "core/fxge/dib/fx_dib.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/utils/benchmark_timer.h"
+#include "testing/utils/file_util.h"
+#include "testing/utils/path_service.h"
 
 namespace {
 
@@ -27,6 +44,13 @@ uint32_t PixelWeightSum(const CStretchEngine::PixelWeight* weights) {
   return sum;
 }
 
+void ExpectNoWeights(const CStretchEngine::WeightTable& table,
+                     int dest_width) {
+  for (int i = 0; i < dest_width; ++i) {
+    EXPECT_TRUE(table.GetPixelWeight(i)->GetWeights().empty()) << "at " << i;
+  }
+}
+
 void ExecuteOneStretchTest(int32_t dest_width,
                            int32_t src_width,
                            const FXDIB_ResampleOptions& options) {
@@ -66,6 +90,41 @@ void ExecuteStretchTests(const FXDIB_ResampleOptions& options) {
   }
 }
 
+RetainPtr<CFX_DIBitmap> CreateTestBitmap(int width,
+                                         int height,
+                                         FXDIB_Format format) {
+  auto bitmap = pdfium::MakeRetain<CFX_DIBitmap>();
+  if (!bitmap->Create(width, height, format)) {
+    return nullptr;
+  }
+  for (int row = 0; row < height; ++row) {
+    pdfium::span<uint8_t> scanline = bitmap->GetWritableScanline(row);
+    for (size_t i = 0; i < scanline.size(); ++i) {
+      scanline[i] = static_cast<uint8_t>((row * 7 + i * 13) ^ (i >> 3));
+    }
+  }
+  return bitmap;
+}
+
+RetainPtr<CFX_DIBitmap> Stretch(RetainPtr<const CFX_DIBitmap> source,
+                                int dest_width,
+                                int dest_height) {
+  CFX_BitmapStorer storer;
+  CFX_ImageStretcher stretcher(&storer, std::move(source), dest_width,
+                               dest_height,
+                               FX_RECT(0, 0, dest_width, dest_height),
+                               FXDIB_ResampleOptions());
+  if (stretcher.Start()) {
+    stretcher.Continue(nullptr);
+  }
+  return storer.Detach();
+}
+
+class AlwaysPause final : public PauseIndicatorIface {
+ public:
+  bool NeedToPauseNow() override { return true; }
+};
+
 }  // namespace
 
 TEST(CStretchEngine, OverflowInCtor) {
@@ -113,6 +172,7 @@ TEST(CStretchEngine, ZeroLengthSrc) {
   FXDIB_ResampleOptions options;
   CStretchEngine::WeightTable table;
   ASSERT_TRUE(table.CalculateWeights(100, 0, 100, 0, 0, 0, options));
+  ExpectNoWeights(table, 100);
 }
 
 TEST(CStretchEngine, ZeroLengthSrcNoSmoothing) {
@@ -120,6 +180,7 @@ TEST(CStretchEngine, ZeroLengthSrcNoSmoothing) {
   options.bNoSmoothing = true;
   CStretchEngine::WeightTable table;
   ASSERT_TRUE(table.CalculateWeights(100, 0, 100, 0, 0, 0, options));
+  ExpectNoWeights(table, 100);
 }
 
 TEST(CStretchEngine, ZeroLengthSrcBilinear) {
@@ -127,6 +188,7 @@ TEST(CStretchEngine, ZeroLengthSrcBilinear) {
   options.bInterpolateBilinear = true;
   CStretchEngine::WeightTable table;
   ASSERT_TRUE(table.CalculateWeights(100, 0, 100, 0, 0, 0, options));
+  ExpectNoWeights(table, 100);
 }
 
 TEST(CStretchEngine, ZeroLengthSrcNoSmoothingBilinear) {
@@ -135,6 +197,7 @@ TEST(CStretchEngine, ZeroLengthSrcNoSmoothingBilinear) {
   options.bInterpolateBilinear = true;
   CStretchEngine::WeightTable table;
   ASSERT_TRUE(table.CalculateWeights(100, 0, 100, 0, 0, 0, options));
+  ExpectNoWeights(table, 100);
 }
 
 TEST(CStretchEngine, ZeroLengthDest) {
@@ -143,6 +206,20 @@ TEST(CStretchEngine, ZeroLengthDest) {
   ASSERT_TRUE(table.CalculateWeights(0, 0, 0, 100, 0, 100, options));
 }
 
+TEST(CStretchEngine, DestOutsideSrcClip) {
+  // Destination pixels that map outside [`src_min`, `src_max`) get no weights.
+  FXDIB_ResampleOptions options;
+  options.bNoSmoothing = true;
+  CStretchEngine::WeightTable table;
+  ASSERT_TRUE(table.CalculateWeights(100, 0, 100, 100, 50, 60, options));
+  for (int i = 0; i < 100; ++i) {
+    const CStretchEngine::PixelWeight* weights = table.GetPixelWeight(i);
+    EXPECT_EQ(weights->src_end_ >= weights->src_start_ ? 1u : 0u,
+              weights->GetWeights().size())
+        << "at " << i;
+  }
+}
+
 TEST(CStretchEngine, TooManyWeights) {
   FXDIB_ResampleOptions options;
   CStretchEngine::WeightTable table;
@@ -150,3 +227,131 @@ TEST(CStretchEngine, TooManyWeights) {
                                       kTooBigSrcLen, 0, kTooBigSrcLen,
                                       options));
 }
+
+TEST(CStretchEngine, SameResultWithThreadPool) {
+  static constexpr FXDIB_Format kFormats[] = {
+      FXDIB_Format::k8bppRgb, FXDIB_Format::kBgr, FXDIB_Format::kBgrx,
+      FXDIB_Format::kBgra};
+  for (FXDIB_Format format : kFormats) {
+    RetainPtr<CFX_DIBitmap> source = CreateTestBitmap(301, 257, format);
+    ASSERT_TRUE(source);
+    for (int scale : {3, 1000}) {
+      const int dest_width = 301 * scale / 100;
+      const int dest_height = 257 * scale / 100;
+      RetainPtr<CFX_DIBitmap> expected =
+          Stretch(source, dest_width, dest_height);
+      ASSERT_TRUE(expected);
+
+      CFX_ThreadPool::InitializeGlobals(3);
+      RetainPtr<CFX_DIBitmap> actual = Stretch(source, dest_width, dest_height);
+      CFX_ThreadPool::DestroyGlobals();
+      ASSERT_TRUE(actual);
+      EXPECT_TRUE(std::ranges::equal(expected->GetBuffer(),
+                                     actual->GetBuffer()))
+          << static_cast<int>(format) << " at " << scale << "%";
+    }
+  }
+}
+
+TEST(CStretchEngine, SkipsJpegRowsAboveDecodeArea) {
+  pdfium::InitializePageModule();
+  {
+    std::string path = PathService::GetTestFilePath("mona_lisa.jpg");
+    ASSERT_FALSE(path.empty());
+    std::vector<uint8_t> contents = GetFileContents(path.c_str());
+    ASSERT_FALSE(contents.empty());
+
+    static constexpr int kSize = 120;
+    auto dict = pdfium::MakeRetain<CPDF_Dictionary>();
+    dict->SetNewFor<CPDF_Name>("Type", "XObject");
+    dict->SetNewFor<CPDF_Name>("Subtype", "Image");
+    dict->SetNewFor<CPDF_Number>("Width", kSize);
+    dict->SetNewFor<CPDF_Number>("Height", kSize);
+    dict->SetNewFor<CPDF_Number>("BitsPerComponent", 8);
+    dict->SetNewFor<CPDF_Name>("ColorSpace", "DeviceRGB");
+    dict->SetNewFor<CPDF_Name>("Filter", "DCTDecode");
+    auto stream = pdfium::MakeRetain<CPDF_Stream>(
+        DataVector<uint8_t>(contents.begin(), contents.end()), std::move(dict));
+    CPDF_TestDocument doc;
+
+    // Stretches the visible part of the image, loaded for `decode_area`.
+    auto stretch = [&](const FX_RECT& visible, const FX_RECT& decode_area,
+                       PauseIndicatorIface* pause) -> RetainPtr<CFX_DIBitmap> {
+      auto dib = pdfium::MakeRetain<CPDF_DIB>(&doc, stream);
+      if (dib->StartLoadDIBBase(
+              /*bHasMask=*/false, /*pFormResources=*/nullptr,
+              /*pPageResources=*/nullptr, /*bStdCS=*/false,
+              CPDF_ColorSpace::Family::kUnknown, /*bLoadMask=*/false,
+              /*max_size_required=*/{0, 0},
+              decode_area) != CPDF_DIB::LoadState::kSuccess) {
+        return nullptr;
+      }
+      CFX_BitmapStorer storer;
+      if (!storer.SetInfo(visible.Width(), visible.Height(), dib->GetFormat(),
+                          {})) {
+        return nullptr;
+      }
+      CStretchEngine engine(&storer, dib->GetFormat(), kSize, kSize, visible,
+                            dib, FXDIB_ResampleOptions());
+      if (!engine.StartStretchHorz()) {
+        return nullptr;
+      }
+      while (engine.Continue(pause)) {
+      }
+      return storer.Detach();
+    };
+
+    // Only the bottom third of the image is visible.
+    const FX_RECT visible(0, 80, kSize, kSize);
+    RetainPtr<CFX_DIBitmap> expected = stretch(visible, FX_RECT(), nullptr);
+    ASSERT_TRUE(expected);
+
+    AlwaysPause always_pause;
+    for (PauseIndicatorIface* pause :
+         std::to_array<PauseIndicatorIface*>({nullptr, &always_pause})) {
+      SCOPED_TRACE(pause != nullptr);
+      const size_t decoded_before = JpegModule::GetDecodedLineCountForTesting();
+      RetainPtr<CFX_DIBitmap> actual = stretch(visible, visible, pause);
+      ASSERT_TRUE(actual);
+
+      // Rows above the visible area get skipped, not decoded.
+      EXPECT_EQ(static_cast<size_t>(visible.Height()),
+                JpegModule::GetDecodedLineCountForTesting() - decoded_before);
+      EXPECT_TRUE(
+          std::ranges::equal(expected->GetBuffer(), actual->GetBuffer()));
+    }
+  }
+  pdfium::DestroyPageModule();
+}
+
+// Not run by default. Use --gtest_also_run_disabled_tests to time stretching
+// a 300 dpi letter-size scan to thumbnail size and to twice its size.
+TEST(CStretchEngine, DISABLED_StretchScannedPageBenchmark) {
+  static constexpr int kSrcWidth = 2550;
+  static constexpr int kSrcHeight = 3300;
+  static constexpr FXDIB_Format kFormats[] = {
+      FXDIB_Format::k8bppRgb, FXDIB_Format::kBgr, FXDIB_Format::kBgra};
+  static constexpr struct {
+    int width;
+    int height;
+  } kDestSizes[] = {{kSrcWidth / 16, kSrcHeight / 16},
+                    {kSrcWidth * 2, kSrcHeight * 2}};
+
+  for (FXDIB_Format format : kFormats) {
+    RetainPtr<CFX_DIBitmap> source =
+        CreateTestBitmap(kSrcWidth, kSrcHeight, format);
+    ASSERT_TRUE(source);
+    for (const auto& size : kDestSizes) {
+      RetainPtr<CFX_DIBitmap> result;
+      {
+        ScopedBenchmarkTimer timer(
+            "format " + std::to_string(static_cast<int>(format)) + ", " +
+            std::to_string(kSrcWidth) + "x" + std::to_string(kSrcHeight) +
+            " -> " + std::to_string(size.width) + "x" +
+            std::to_string(size.height));
+        result = Stretch(source, size.width, size.height);
+      }
+      ASSERT_TRUE(result);
+    }
+  }
+}
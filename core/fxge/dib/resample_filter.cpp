@@ -0,0 +1,164 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxge/dib/resample_filter.h"
+
+#include <algorithm>
+
+#include "core/fxcrt/byteorder.h"
+#include "core/fxcrt/check_op.h"
+#include "core/fxcrt/compiler_specific.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace fxge {
+
+namespace {
+
+constexpr uint32_t kMaxWeight = 1 << 16;
+
+#if defined(__SSE2__)
+// Widens the 4 bytes in the low lane of `pixel` to one 32-bit lane each.
+__m128i UnpackPixel(__m128i pixel) {
+  const __m128i zero = _mm_setzero_si128();
+  return _mm_unpacklo_epi16(_mm_unpacklo_epi8(pixel, zero), zero);
+}
+
+// Adds `weight * x` for the 8 16-bit lanes of `x` to the 32-bit lanes of
+// `lo` and `hi`. The products need at most 25 bits, so they are assembled
+// from the low and high halves of 16x16-bit multiplies.
+void AccumulateColumns(__m128i x, uint32_t weight, __m128i& lo, __m128i& hi) {
+  DCHECK_LE(weight, kMaxWeight);
+  if (weight == kMaxWeight) {
+    // Weight 1.0 does not fit in 16 bits, but is just a shift.
+    const __m128i zero = _mm_setzero_si128();
+    lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(zero, x));
+    hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(zero, x));
+    return;
+  }
+  const __m128i w = _mm_set1_epi16(static_cast<int16_t>(weight));
+  const __m128i prod_lo = _mm_mullo_epi16(x, w);
+  const __m128i prod_hi = _mm_mulhi_epu16(x, w);
+  lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(prod_lo, prod_hi));
+  hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(prod_lo, prod_hi));
+}
+#endif  // defined(__SSE2__)
+
+}  // namespace
+
+uint32_t WeightedSum8(pdfium::span<const uint8_t> src,
+                      pdfium::span<const uint32_t> weights) {
+  src = src.first(weights.size());
+  uint32_t sum = 0;
+  size_t i = 0;
+#if defined(__SSE2__)
+  // Only worthwhile for the long filters used when shrinking images.
+  if (weights.size() >= 4) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    for (; i + 4 <= weights.size(); i += 4) {
+      // SAFETY: loop condition ensures 4 weights remain at `i`.
+      const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+          UNSAFE_BUFFERS(weights.data() + i)));
+      const __m128i x = UnpackPixel(_mm_cvtsi32_si128(static_cast<int>(
+          fxcrt::GetUInt32LSBFirst(src.subspan(i).first<4u>()))));
+      acc = _mm_add_epi64(acc, _mm_mul_epu32(w, x));
+      acc = _mm_add_epi64(acc, _mm_mul_epu32(_mm_srli_epi64(w, 32),
+                                             _mm_srli_epi64(x, 32)));
+    }
+    // The low 32 bits of the 64-bit lanes wrap exactly like scalar uint32_t.
+    acc = _mm_add_epi64(acc, _mm_unpackhi_epi64(acc, acc));
+    sum = static_cast<uint32_t>(_mm_cvtsi128_si32(acc));
+  }
+#endif
+  for (; i < weights.size(); ++i) {
+    sum += weights[i] * src[i];
+  }
+  return sum;
+}
+
+std::array<uint32_t, 3> WeightedSumBgr(pdfium::span<const uint8_t> src,
+                                       int bytes_per_pixel,
+                                       pdfium::span<const uint32_t> weights) {
+  DCHECK(bytes_per_pixel == 3 || bytes_per_pixel == 4);
+  std::array<uint32_t, 3> sums = {};
+  if (weights.empty()) {
+    return sums;
+  }
+  src = src.first((weights.size() - 1) * bytes_per_pixel + 3);
+  for (size_t i = 0; i < weights.size(); ++i) {
+    pdfium::span<const uint8_t> pixel = src.subspan(i * bytes_per_pixel, 3u);
+    sums[0] += weights[i] * pixel[0];
+    sums[1] += weights[i] * pixel[1];
+    sums[2] += weights[i] * pixel[2];
+  }
+  return sums;
+}
+
+std::array<uint32_t, 4> AlphaWeightedSumBgra(
+    pdfium::span<const uint8_t> src,
+    pdfium::span<const uint32_t> weights) {
+  std::array<uint32_t, 4> sums = {};
+  src = src.first(weights.size() * 4);
+  for (size_t i = 0; i < weights.size(); ++i) {
+    pdfium::span<const uint8_t> pixel = src.subspan(i * 4, 4u);
+    const uint32_t weight = weights[i] * pixel[3] / 255;
+    sums[0] += weight * pixel[0];
+    sums[1] += weight * pixel[1];
+    sums[2] += weight * pixel[2];
+    sums[3] += weight;
+  }
+  return sums;
+}
+
+void WeightedColumnSums(pdfium::span<const uint8_t> src,
+                        size_t pitch,
+                        pdfium::span<const uint32_t> weights,
+                        pdfium::span<uint32_t> sums) {
+  if (weights.empty()) {
+    std::fill(sums.begin(), sums.end(), 0);
+    return;
+  }
+  // Check once up front so the inner loops can index rows directly.
+  CHECK_LE(sums.size(), pitch);
+  CHECK_GE(src.size(), (weights.size() - 1) * pitch + sums.size());
+
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= sums.size(); i += 16) {
+    __m128i acc0 = zero;
+    __m128i acc1 = zero;
+    __m128i acc2 = zero;
+    __m128i acc3 = zero;
+    for (size_t row = 0; row < weights.size(); ++row) {
+      // SAFETY: CHECK()s above ensure 16 bytes are available at `i` in each
+      // row.
+      const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+          UNSAFE_BUFFERS(src.data() + row * pitch + i)));
+      AccumulateColumns(_mm_unpacklo_epi8(x, zero), weights[row], acc0, acc1);
+      AccumulateColumns(_mm_unpackhi_epi8(x, zero), weights[row], acc2, acc3);
+    }
+    // SAFETY: loop condition ensures 16 sums are available at `i`.
+    UNSAFE_BUFFERS({
+      __m128i* dest = reinterpret_cast<__m128i*>(sums.data() + i);
+      _mm_storeu_si128(dest, acc0);
+      _mm_storeu_si128(dest + 1, acc1);
+      _mm_storeu_si128(dest + 2, acc2);
+      _mm_storeu_si128(dest + 3, acc3);
+    });
+  }
+#endif
+  for (; i < sums.size(); ++i) {
+    uint32_t sum = 0;
+    for (size_t row = 0; row < weights.size(); ++row) {
+      sum += weights[row] * src[row * pitch + i];
+    }
+    sums[i] = sum;
+  }
+}
+
+}  // namespace fxge
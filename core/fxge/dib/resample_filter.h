@@ -0,0 +1,49 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CORE_FXGE_DIB_RESAMPLE_FILTER_H_
+#define CORE_FXGE_DIB_RESAMPLE_FILTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "core/fxcrt/span.h"
+
+namespace fxge {
+
+// Multiply-accumulate kernels for CStretchEngine. Weights are in
+// CStretchEngine's 16.16 fixed-point format and may not exceed 1.0. Results
+// are always identical to accumulating in scalar uint32_t arithmetic, even
+// when a vectorized implementation is available for the target CPU.
+
+// Returns the sum of `weights[i] * src[i]`.
+uint32_t WeightedSum8(pdfium::span<const uint8_t> src,
+                      pdfium::span<const uint32_t> weights);
+
+// Returns the sums of `weights[i] * pixel[c]` for channels `c` 0 to 2 of
+// consecutive `bytes_per_pixel`-sized pixels in `src`. `bytes_per_pixel`
+// must be 3 or 4.
+std::array<uint32_t, 3> WeightedSumBgr(pdfium::span<const uint8_t> src,
+                                       int bytes_per_pixel,
+                                       pdfium::span<const uint32_t> weights);
+
+// Like WeightedSumBgr() for 4-byte BGRA pixels, but with each weight first
+// scaled by the pixel's alpha as `weights[i] * alpha / 255`. The last result
+// is the sum of the scaled weights.
+std::array<uint32_t, 4> AlphaWeightedSumBgra(
+    pdfium::span<const uint8_t> src,
+    pdfium::span<const uint32_t> weights);
+
+// For each offset `i` in `sums`, stores the sum of `weights[row] *
+// src[row * pitch + i]` over the rows selected by `weights`.
+void WeightedColumnSums(pdfium::span<const uint8_t> src,
+                        size_t pitch,
+                        pdfium::span<const uint32_t> weights,
+                        pdfium::span<uint32_t> sums);
+
+}  // namespace fxge
+
+#endif  // CORE_FXGE_DIB_RESAMPLE_FILTER_H_
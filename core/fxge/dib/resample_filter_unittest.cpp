@@ -0,0 +1,127 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "core/fxge/dib/resample_filter.h"
+
+#include <stdint.h>
+
+#include <array>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Deterministic filler so that failures are reproducible.
+class TestData {
+ public:
+  uint32_t Next() {
+    state_ = state_ * 1103515245 + 12345;
+    return state_ >> 8;
+  }
+
+  std::vector<uint8_t> Bytes(size_t count) {
+    std::vector<uint8_t> result(count);
+    for (uint8_t& byte : result) {
+      byte = static_cast<uint8_t>(Next());
+    }
+    return result;
+  }
+
+  // Weights up to and including 1.0 in 16.16 fixed point.
+  std::vector<uint32_t> Weights(size_t count) {
+    std::vector<uint32_t> result(count);
+    for (uint32_t& weight : result) {
+      weight = Next() % 65537;
+    }
+    return result;
+  }
+
+ private:
+  uint32_t state_ = 1;
+};
+
+}  // namespace
+
+TEST(ResampleFilter, WeightedSum8) {
+  TestData data;
+  for (size_t count = 0; count < 40; ++count) {
+    std::vector<uint8_t> src = data.Bytes(count);
+    std::vector<uint32_t> weights = data.Weights(count);
+    uint32_t expected = 0;
+    for (size_t i = 0; i < count; ++i) {
+      expected += weights[i] * src[i];
+    }
+    EXPECT_EQ(expected, fxge::WeightedSum8(src, weights)) << count;
+  }
+}
+
+TEST(ResampleFilter, WeightedSumBgr) {
+  TestData data;
+  for (int bpp : {3, 4}) {
+    for (size_t count = 1; count < 40; ++count) {
+      // Exactly sized so that reading past the last pixel would be caught.
+      std::vector<uint8_t> src = data.Bytes((count - 1) * bpp + 3);
+      std::vector<uint32_t> weights = data.Weights(count);
+      std::array<uint32_t, 3> expected = {};
+      for (size_t i = 0; i < count; ++i) {
+        for (size_t c = 0; c < 3; ++c) {
+          expected[c] += weights[i] * src[i * bpp + c];
+        }
+      }
+      EXPECT_EQ(expected, fxge::WeightedSumBgr(src, bpp, weights))
+          << bpp << " " << count;
+    }
+  }
+}
+
+TEST(ResampleFilter, AlphaWeightedSumBgra) {
+  TestData data;
+  for (size_t count = 0; count < 40; ++count) {
+    std::vector<uint8_t> src = data.Bytes(count * 4);
+    std::vector<uint32_t> weights = data.Weights(count);
+    std::array<uint32_t, 4> expected = {};
+    for (size_t i = 0; i < count; ++i) {
+      uint32_t weight = weights[i] * src[i * 4 + 3] / 255;
+      for (size_t c = 0; c < 3; ++c) {
+        expected[c] += weight * src[i * 4 + c];
+      }
+      expected[3] += weight;
+    }
+    EXPECT_EQ(expected, fxge::AlphaWeightedSumBgra(src, weights)) << count;
+  }
+}
+
+TEST(ResampleFilter, WeightedColumnSums) {
+  TestData data;
+  for (size_t rows = 1; rows < 12; ++rows) {
+    for (size_t width : {1u, 15u, 16u, 17u, 100u}) {
+      const size_t pitch = width + 3;
+      std::vector<uint8_t> src = data.Bytes((rows - 1) * pitch + width);
+      std::vector<uint32_t> weights = data.Weights(rows);
+      std::vector<uint32_t> sums(width);
+      fxge::WeightedColumnSums(src, pitch, weights, sums);
+      for (size_t i = 0; i < width; ++i) {
+        uint32_t expected = 0;
+        for (size_t row = 0; row < rows; ++row) {
+          expected += weights[row] * src[row * pitch + i];
+        }
+        EXPECT_EQ(expected, sums[i]) << rows << " " << width << " " << i;
+      }
+    }
+  }
+}
+
+TEST(ResampleFilter, WeightedColumnSumsFullWeight) {
+  std::vector<uint8_t> src(32);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<uint8_t>(i * 8);
+  }
+  const std::vector<uint32_t> weights = {1 << 16};
+  std::vector<uint32_t> sums(src.size());
+  fxge::WeightedColumnSums(src, src.size(), weights, sums);
+  for (size_t i = 0; i < src.size(); ++i) {
+    EXPECT_EQ(static_cast<uint32_t>(src[i]) << 16, sums[i]);
+  }
+}
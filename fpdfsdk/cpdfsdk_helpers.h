@@ -31,6 +31,7 @@ class CPDF_Annot;
 class CPDF_AnnotContext;
 class CPDF_ClipPath;
 class CPDF_ContentMarkItem;
+class CPDF_DocumentTextFind;
 class CPDF_Object;
 class CPDF_Font;
 class CPDF_LinkExtract;
@@ -39,6 +40,7 @@ class CPDF_RenderOptions;
 class CPDF_Stream;
 class CPDF_StructElement;
 class CPDF_StructTree;
+class CPDF_TextIndex;
 class CPDF_TextPage;
 class CPDF_TextPageFind;
 class CPDFSDK_FormFillEnvironment;
@@ -220,6 +222,13 @@ inline const CPDF_Object* CPDFObjectFromFPDFStructElementAttrValue(
   return reinterpret_cast<const CPDF_Object*>(struct_element_attr_value);
 }
 
+inline FPDF_TEXTINDEX FPDFTextIndexFromCPDFTextIndex(CPDF_TextIndex* index) {
+  return reinterpret_cast<FPDF_TEXTINDEX>(index);
+}
+inline CPDF_TextIndex* CPDFTextIndexFromFPDFTextIndex(FPDF_TEXTINDEX index) {
+  return reinterpret_cast<CPDF_TextIndex*>(index);
+}
+
 inline FPDF_TEXTPAGE FPDFTextPageFromCPDFTextPage(CPDF_TextPage* page) {
   return reinterpret_cast<FPDF_TEXTPAGE>(page);
 }
@@ -236,6 +245,15 @@ inline CPDF_TextPageFind* CPDFTextPageFindFromFPDFSchHandle(
   return reinterpret_cast<CPDF_TextPageFind*>(handle);
 }
 
+inline FPDF_DOCSCHHANDLE FPDFDocSchHandleFromCPDFDocumentTextFind(
+    CPDF_DocumentTextFind* handle) {
+  return reinterpret_cast<FPDF_DOCSCHHANDLE>(handle);
+}
+inline CPDF_DocumentTextFind* CPDFDocumentTextFindFromFPDFDocSchHandle(
+    FPDF_DOCSCHHANDLE handle) {
+  return reinterpret_cast<CPDF_DocumentTextFind*>(handle);
+}
+
 inline FPDF_FORMHANDLE FPDFFormHandleFromCPDFSDKFormFillEnvironment(
     CPDFSDK_FormFillEnvironment* handle) {
   return reinterpret_cast<FPDF_FORMHANDLE>(handle);
@@ -18,6 +18,7 @@
 #include "core/fpdfapi/parser/cpdf_reference.h"
 #include "core/fpdfapi/parser/cpdf_stream_acc.h"
 #include "core/fpdfapi/parser/cpdf_string.h"
+#include "core/fxcodec/flate/flatemodule.h"
 #include "core/fxcrt/fx_extension.h"
 #include "core/fxcrt/stl_util.h"
 #include "fpdfsdk/cpdfsdk_filewriteadapter.h"
@@ -162,7 +163,8 @@ bool SaveXFADocumentData(CPDFXFA_Context* pContext,
 bool DoDocSave(FPDF_DOCUMENT document,
                FPDF_FILEWRITE* pFileWrite,
                FPDF_DWORD flags,
-               std::optional<int> version) {
+               std::optional<int> version,
+               const FlateModule::EncodeOptions& encode_options) {
   CPDF_Document* pPDFDoc = CPDFDocumentFromFPDFDocument(document);
   if (!pPDFDoc) {
     return false;
@@ -186,6 +188,7 @@ bool DoDocSave(FPDF_DOCUMENT document,
   if (version.has_value()) {
     fileMaker.SetFileVersion(version.value());
   }
+  fileMaker.SetEncodeOptions(encode_options);
   if (flags == FPDF_REMOVE_SECURITY) {
     flags = 0;
     fileMaker.RemoveSecurity();
@@ -207,7 +210,8 @@ bool DoDocSave(FPDF_DOCUMENT document,
 FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV FPDF_SaveAsCopy(FPDF_DOCUMENT document,
                                                     FPDF_FILEWRITE* pFileWrite,
                                                     FPDF_DWORD flags) {
-  return DoDocSave(document, pFileWrite, flags, {});
+  return DoDocSave(document, pFileWrite, flags, {},
+                   FlateModule::EncodeOptions());
 }
 
 FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
@@ -215,5 +219,42 @@ FPDF_SaveWithVersion(FPDF_DOCUMENT document,
                      FPDF_FILEWRITE* pFileWrite,
                      FPDF_DWORD flags,
                      int fileVersion) {
-  return DoDocSave(document, pFileWrite, flags, fileVersion);
+  return DoDocSave(document, pFileWrite, flags, fileVersion,
+                   FlateModule::EncodeOptions());
+}
+
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDF_SaveWithOptions(FPDF_DOCUMENT document,
+                     FPDF_FILEWRITE* pFileWrite,
+                     FPDF_DWORD flags,
+                     const FPDF_SAVE_OPTIONS* options) {
+  if (!options || options->version != 1 || options->compression_level < -1 ||
+      options->compression_level > 9) {
+    return false;
+  }
+
+  FlateModule::EncodeOptions encode_options;
+  encode_options.level = options->compression_level;
+  switch (options->compression_strategy) {
+    case FPDF_COMPRESSION_STRATEGY_DEFAULT:
+      encode_options.strategy = FlateModule::Strategy::kDefault;
+      break;
+    case FPDF_COMPRESSION_STRATEGY_FILTERED:
+      encode_options.strategy = FlateModule::Strategy::kFiltered;
+      break;
+    case FPDF_COMPRESSION_STRATEGY_HUFFMAN_ONLY:
+      encode_options.strategy = FlateModule::Strategy::kHuffmanOnly;
+      break;
+    case FPDF_COMPRESSION_STRATEGY_RLE:
+      encode_options.strategy = FlateModule::Strategy::kRle;
+      break;
+    default:
+      return false;
+  }
+
+  std::optional<int> version;
+  if (options->file_version != 0) {
+    version = options->file_version;
+  }
+  return DoDocSave(document, pFileWrite, flags, version, encode_options);
 }
@@ -50,6 +50,51 @@ TEST_F(FPDFSaveEmbedderTest, SaveSimpleDocWithBadVersion) {
   EXPECT_THAT(GetString(), StartsWith("%PDF-1.7\r\n"));
 }
 
+TEST_F(FPDFSaveEmbedderTest, SaveSimpleDocWithOptions) {
+  ASSERT_TRUE(OpenDocument("hello_world.pdf"));
+  FPDF_SAVE_OPTIONS options = {};
+  options.version = 1;
+  options.compression_level = -1;
+  options.compression_strategy = FPDF_COMPRESSION_STRATEGY_DEFAULT;
+  EXPECT_TRUE(FPDF_SaveWithOptions(document(), this, 0, &options));
+  EXPECT_THAT(GetString(), StartsWith("%PDF-1.7\r\n"));
+  EXPECT_EQ(805u, GetString().size());
+
+  // Level 0 stores the content stream without compressing it.
+  ClearString();
+  options.file_version = 14;
+  options.compression_level = 0;
+  EXPECT_TRUE(FPDF_SaveWithOptions(document(), this, 0, &options));
+  EXPECT_THAT(GetString(), StartsWith("%PDF-1.4\r\n"));
+  EXPECT_EQ(830u, GetString().size());
+
+  ClearString();
+  options.compression_level = 9;
+  options.compression_strategy = FPDF_COMPRESSION_STRATEGY_HUFFMAN_ONLY;
+  EXPECT_TRUE(FPDF_SaveWithOptions(document(), this, 0, &options));
+  VerifySavedDocument(200, 200, pdfium::HelloWorldChecksum());
+}
+
+TEST_F(FPDFSaveEmbedderTest, SaveSimpleDocWithBadOptions) {
+  ASSERT_TRUE(OpenDocument("hello_world.pdf"));
+  EXPECT_FALSE(FPDF_SaveWithOptions(document(), this, 0, nullptr));
+
+  FPDF_SAVE_OPTIONS options = {};
+  EXPECT_FALSE(FPDF_SaveWithOptions(document(), this, 0, &options));
+
+  options.version = 1;
+  options.compression_level = 10;
+  EXPECT_FALSE(FPDF_SaveWithOptions(document(), this, 0, &options));
+
+  options.compression_level = -2;
+  EXPECT_FALSE(FPDF_SaveWithOptions(document(), this, 0, &options));
+
+  options.compression_level = 6;
+  options.compression_strategy = 4;
+  EXPECT_FALSE(FPDF_SaveWithOptions(document(), this, 0, &options));
+  EXPECT_TRUE(GetString().empty());
+}
+
 TEST_F(FPDFSaveEmbedderTest, SaveSimpleDocIncremental) {
   ASSERT_TRUE(OpenDocument("hello_world.pdf"));
   EXPECT_TRUE(FPDF_SaveWithVersion(document(), this, FPDF_INCREMENTAL, 14));
@@ -9,24 +9,34 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "build/build_config.h"
 #include "core/fpdfapi/font/cpdf_font.h"
 #include "core/fpdfapi/page/cpdf_page.h"
 #include "core/fpdfapi/page/cpdf_textobject.h"
+#include "core/fpdfapi/parser/cpdf_dictionary.h"
+#include "core/fpdfapi/parser/cpdf_document.h"
 #include "core/fpdfdoc/cpdf_viewerpreferences.h"
+#include "core/fpdftext/cpdf_documenttextfind.h"
 #include "core/fpdftext/cpdf_linkextract.h"
+#include "core/fpdftext/cpdf_textindex.h"
 #include "core/fpdftext/cpdf_textpage.h"
 #include "core/fpdftext/cpdf_textpagefind.h"
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/compiler_specific.h"
+#include "core/fxcrt/data_vector.h"
 #include "core/fxcrt/fx_memcpy_wrappers.h"
+#include "core/fxcrt/notreached.h"
 #include "core/fxcrt/numerics/safe_conversions.h"
+#include "core/fxcrt/pauseindicator_iface.h"
 #include "core/fxcrt/span.h"
 #include "core/fxcrt/span_util.h"
 #include "core/fxcrt/stl_util.h"
 #include "fpdfsdk/cpdfsdk_helpers.h"
+#include "fpdfsdk/cpdfsdk_pauseadapter.h"
 
 namespace {
 
@@ -39,6 +49,46 @@ CPDF_TextPage* GetTextPageForValidIndex(FPDF_TEXTPAGE text_page, int index) {
   return static_cast<size_t>(index) < textpage->size() ? textpage : nullptr;
 }
 
+// Returns the text page for `page_index` of `doc`, whose content gets parsed
+// in text-only mode, or nullptr if there is no such page.
+std::unique_ptr<CPDF_TextPage> LoadTextOnlyPage(CPDF_Document* doc,
+                                                int page_index,
+                                                bool rtl) {
+  RetainPtr<CPDF_Dictionary> dict = doc->GetMutablePageDictionary(page_index);
+  if (!dict) {
+    return nullptr;
+  }
+
+  auto page = pdfium::MakeRetain<CPDF_Page>(doc, std::move(dict));
+  page->SetTextOnly(true);
+  page->ParseContent();
+  return std::make_unique<CPDF_TextPage>(
+      RetainPtr<const CPDF_Page>(std::move(page)), rtl);
+}
+
+// Searches on with `find` towards the end of the document if `forward`, or
+// towards the start otherwise.
+int ContinueDocFind(CPDF_DocumentTextFind* find,
+                    IFSDK_PAUSE* pause,
+                    bool forward) {
+  std::optional<CPDFSDK_PauseAdapter> pause_adapter;
+  if (pause) {
+    pause_adapter.emplace(pause);
+  }
+  PauseIndicatorIface* pause_indicator =
+      pause_adapter.has_value() ? &pause_adapter.value() : nullptr;
+  switch (forward ? find->FindNext(pause_indicator)
+                  : find->FindPrev(pause_indicator)) {
+    case CPDF_DocumentTextFind::Status::kNotFound:
+      return FPDF_DOCFIND_NOT_FOUND;
+    case CPDF_DocumentTextFind::Status::kFound:
+      return FPDF_DOCFIND_FOUND;
+    case CPDF_DocumentTextFind::Status::kPaused:
+      return FPDF_DOCFIND_TOBECONTINUED;
+  }
+  NOTREACHED();
+}
+
 }  // namespace
 
 FPDF_EXPORT FPDF_TEXTPAGE FPDF_CALLCONV FPDFText_LoadPage(FPDF_PAGE page) {
@@ -55,6 +105,73 @@ FPDF_EXPORT FPDF_TEXTPAGE FPDF_CALLCONV FPDFText_LoadPage(FPDF_PAGE page) {
   return FPDFTextPageFromCPDFTextPage(textpage.release());
 }
 
+FPDF_EXPORT FPDF_TEXTPAGE FPDF_CALLCONV
+FPDFText_LoadPageTextOnly(FPDF_DOCUMENT document, int page_index) {
+  CPDF_Document* doc = CPDFDocumentFromFPDFDocument(document);
+  if (!doc || page_index < 0) {
+    return nullptr;
+  }
+
+  CPDF_ViewerPreferences viewRef(doc);
+  std::unique_ptr<CPDF_TextPage> textpage =
+      LoadTextOnlyPage(doc, page_index, viewRef.IsDirectionR2L());
+
+  // Caller takes ownership.
+  return FPDFTextPageFromCPDFTextPage(textpage.release());
+}
+
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDFText_ExtractTextPageByPage(FPDF_DOCUMENT document,
+                               unsigned long flags,
+                               FPDF_PAGE_TEXT_CALLBACK callback,
+                               void* user_data) {
+  CPDF_Document* doc = CPDFDocumentFromFPDFDocument(document);
+  if (!doc || !callback || (flags & ~FPDF_TEXT_EXTRACT_CHAR_BOXES)) {
+    return false;
+  }
+
+  const bool with_char_boxes = !!(flags & FPDF_TEXT_EXTRACT_CHAR_BOXES);
+  const bool rtl = CPDF_ViewerPreferences(doc).IsDirectionR2L();
+  const int page_count = doc->GetPageCount();
+  for (int page_index = 0; page_index < page_count; ++page_index) {
+    std::unique_ptr<CPDF_TextPage> text_page =
+        LoadTextOnlyPage(doc, page_index, rtl);
+    // UTF-16LE, including the terminating NUL.
+    ByteString text;
+    DataVector<double> char_boxes;
+    FPDF_PAGE_TEXT page_text = {};
+    page_text.page_index = page_index;
+    if (text_page) {
+      text = text_page->GetAllPageText().ToUCS2LE();
+      page_text.char_count = text_page->CountChars();
+      if (with_char_boxes) {
+        char_boxes.resize(text_page->size() * 4);
+        auto boxes = pdfium::span(char_boxes);
+        for (size_t i = 0; i < text_page->size(); ++i) {
+          const CFX_FloatRect& box = text_page->GetCharInfo(i).char_box();
+          boxes[i * 4] = box.left;
+          boxes[i * 4 + 1] = box.right;
+          boxes[i * 4 + 2] = box.bottom;
+          boxes[i * 4 + 3] = box.top;
+        }
+      }
+    }
+    auto text_span = fxcrt::reinterpret_span<const unsigned short>(text.span());
+    if (!text_span.empty()) {
+      // Leave out the terminating NUL.
+      page_text.text = text_span.data();
+      page_text.text_length = pdfium::checked_cast<int>(text_span.size() - 1);
+    }
+    if (!char_boxes.empty()) {
+      page_text.char_boxes = char_boxes.data();
+    }
+    if (!callback(&page_text, user_data)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 FPDF_EXPORT void FPDF_CALLCONV FPDFText_ClosePage(FPDF_TEXTPAGE text_page) {
   // PDFium takes ownership.
   std::unique_ptr<CPDF_TextPage> textpage_deleter(
@@ -322,6 +439,85 @@ FPDFText_GetCharOrigin(FPDF_TEXTPAGE text_page,
   return true;
 }
 
+FPDF_EXPORT int FPDF_CALLCONV
+FPDFText_GetCharInfoBatch(FPDF_TEXTPAGE text_page,
+                          int start_index,
+                          int count,
+                          const FPDF_TEXT_CHAR_INFO_ARRAYS* arrays) {
+  CPDF_TextPage* textpage = CPDFTextPageFromFPDFTextPage(text_page);
+  if (!textpage || !arrays || start_index < 0 || count < 0) {
+    return -1;
+  }
+
+  const size_t start = static_cast<size_t>(start_index);
+  if (start > textpage->size()) {
+    return -1;
+  }
+
+  const size_t n =
+      std::min(static_cast<size_t>(count), textpage->size() - start);
+  // Fill one array at a time, so each loop only touches the fields it needs.
+  // SAFETY: required from caller.
+  if (arrays->unicode) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->unicode, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).unicode();
+    }
+  }
+  if (arrays->origin_x) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->origin_x, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).origin().x;
+    }
+  }
+  if (arrays->origin_y) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->origin_y, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).origin().y;
+    }
+  }
+  if (arrays->left) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->left, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).char_box().left;
+    }
+  }
+  if (arrays->right) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->right, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).char_box().right;
+    }
+  }
+  if (arrays->bottom) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->bottom, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).char_box().bottom;
+    }
+  }
+  if (arrays->top) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->top, n));
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = textpage->GetCharInfo(start + i).char_box().top;
+    }
+  }
+  if (arrays->font_size) {
+    auto out = UNSAFE_BUFFERS(pdfium::span(arrays->font_size, n));
+    // Runs of chars share a text object, and so a font size.
+    const CPDF_TextObject* text_object = nullptr;
+    double font_size = 0;
+    for (size_t i = 0; i < n; ++i) {
+      const CPDF_TextObject* char_text_object =
+          textpage->GetCharInfo(start + i).text_object();
+      if (i == 0 || char_text_object != text_object) {
+        text_object = char_text_object;
+        font_size = textpage->GetCharFontSize(start + i);
+      }
+      out[i] = font_size;
+    }
+  }
+  return pdfium::checked_cast<int>(n);
+}
+
 FPDF_EXPORT int FPDF_CALLCONV
 FPDFText_GetCharIndexAtPos(FPDF_TEXTPAGE text_page,
                            double x,
@@ -433,6 +629,60 @@ FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetBoundedText(FPDF_TEXTPAGE text_page,
   return pdfium::checked_cast<int>(copy_span.size());
 }
 
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetTextLines(FPDF_TEXTPAGE text_page,
+                                                    FPDF_TEXT_LINE* lines,
+                                                    int max_lines) {
+  CPDF_TextPage* textpage = CPDFTextPageFromFPDFTextPage(text_page);
+  if (!textpage || max_lines < 0) {
+    return -1;
+  }
+
+  const std::vector<CPDF_TextPage::TextLine>& text_lines =
+      textpage->GetTextLines();
+  if (lines) {
+    // SAFETY: required from caller.
+    auto lines_span =
+        UNSAFE_BUFFERS(pdfium::span(lines, static_cast<size_t>(max_lines)));
+    for (size_t i = 0; i < std::min(lines_span.size(), text_lines.size());
+         ++i) {
+      const CPDF_TextPage::TextLine& line = text_lines[i];
+      lines_span[i].char_index = line.char_index;
+      lines_span[i].char_count = line.char_count;
+      lines_span[i].bounds = FSRectFFromCFXFloatRect(line.bounds);
+      lines_span[i].baseline_start = {line.baseline_start.x,
+                                      line.baseline_start.y};
+      lines_span[i].baseline_end = {line.baseline_end.x, line.baseline_end.y};
+      lines_span[i].block_index = line.block_index;
+    }
+  }
+  return pdfium::checked_cast<int>(text_lines.size());
+}
+
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetTextBlocks(FPDF_TEXTPAGE text_page,
+                                                     FPDF_TEXT_BLOCK* blocks,
+                                                     int max_blocks) {
+  CPDF_TextPage* textpage = CPDFTextPageFromFPDFTextPage(text_page);
+  if (!textpage || max_blocks < 0) {
+    return -1;
+  }
+
+  const std::vector<CPDF_TextPage::TextBlock>& text_blocks =
+      textpage->GetTextBlocks();
+  if (blocks) {
+    // SAFETY: required from caller.
+    auto blocks_span =
+        UNSAFE_BUFFERS(pdfium::span(blocks, static_cast<size_t>(max_blocks)));
+    for (size_t i = 0; i < std::min(blocks_span.size(), text_blocks.size());
+         ++i) {
+      const CPDF_TextPage::TextBlock& block = text_blocks[i];
+      blocks_span[i].line_index = block.line_index;
+      blocks_span[i].line_count = block.line_count;
+      blocks_span[i].bounds = FSRectFFromCFXFloatRect(block.bounds);
+    }
+  }
+  return pdfium::checked_cast<int>(text_blocks.size());
+}
+
 FPDF_EXPORT FPDF_SCHHANDLE FPDF_CALLCONV
 FPDFText_FindStart(FPDF_TEXTPAGE text_page,
                    FPDF_WIDESTRING findwhat,
@@ -504,6 +754,190 @@ FPDF_EXPORT void FPDF_CALLCONV FPDFText_FindClose(FPDF_SCHHANDLE handle) {
       CPDFTextPageFindFromFPDFSchHandle(handle));
 }
 
+FPDF_EXPORT FPDF_DOCSCHHANDLE FPDF_CALLCONV
+FPDFText_DocFindStart(FPDF_DOCUMENT document,
+                      FPDF_WIDESTRING findwhat,
+                      unsigned long flags,
+                      int start_page,
+                      unsigned long max_cache_bytes) {
+  CPDF_Document* doc = CPDFDocumentFromFPDFDocument(document);
+  if (!doc || !findwhat) {
+    return nullptr;
+  }
+
+  CPDF_TextPageFind::Options options;
+  options.bMatchCase = !!(flags & FPDF_MATCHCASE);
+  options.bMatchWholeWord = !!(flags & FPDF_MATCHWHOLEWORD);
+  options.bConsecutive = !!(flags & FPDF_CONSECUTIVE);
+
+  const bool rtl = CPDF_ViewerPreferences(doc).IsDirectionR2L();
+  auto loader = [doc, rtl](int page_index) {
+    return LoadTextOnlyPage(doc, page_index, rtl);
+  };
+
+  // SAFETY: required from caller.
+  auto find = std::make_unique<CPDF_DocumentTextFind>(
+      std::move(loader), max_cache_bytes, doc->GetPageCount(),
+      UNSAFE_BUFFERS(WideStringFromFPDFWideString(findwhat)), options,
+      start_page);
+
+  // Caller takes ownership.
+  return FPDFDocSchHandleFromCPDFDocumentTextFind(find.release());
+}
+
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_DocFindNext(FPDF_DOCSCHHANDLE handle,
+                                                   IFSDK_PAUSE* pause) {
+  CPDF_DocumentTextFind* find =
+      CPDFDocumentTextFindFromFPDFDocSchHandle(handle);
+  if (!find) {
+    return FPDF_DOCFIND_NOT_FOUND;
+  }
+
+  return ContinueDocFind(find, pause, /*forward=*/true);
+}
+
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_DocFindPrev(FPDF_DOCSCHHANDLE handle,
+                                                   IFSDK_PAUSE* pause) {
+  CPDF_DocumentTextFind* find =
+      CPDFDocumentTextFindFromFPDFDocSchHandle(handle);
+  if (!find) {
+    return FPDF_DOCFIND_NOT_FOUND;
+  }
+
+  return ContinueDocFind(find, pause, /*forward=*/false);
+}
+
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDFText_DocFindGetResult(FPDF_DOCSCHHANDLE handle,
+                          int* page_index,
+                          int* char_index,
+                          int* char_count) {
+  CPDF_DocumentTextFind* find =
+      CPDFDocumentTextFindFromFPDFDocSchHandle(handle);
+  if (!find || !page_index || !char_index || !char_count) {
+    return false;
+  }
+
+  std::optional<CPDF_DocumentTextFind::Match> match = find->GetMatch();
+  if (!match.has_value()) {
+    return false;
+  }
+
+  *page_index = match->page_index;
+  *char_index = match->char_index;
+  *char_count = match->char_count;
+  return true;
+}
+
+FPDF_EXPORT void FPDF_CALLCONV FPDFText_DocFindClose(FPDF_DOCSCHHANDLE handle) {
+  // Take ownership back from caller and destroy.
+  std::unique_ptr<CPDF_DocumentTextFind> find(
+      CPDFDocumentTextFindFromFPDFDocSchHandle(handle));
+}
+
+FPDF_EXPORT FPDF_TEXTINDEX FPDF_CALLCONV FPDFText_CreateIndex() {
+  // Caller takes ownership.
+  return FPDFTextIndexFromCPDFTextIndex(new CPDF_TextIndex());
+}
+
+FPDF_EXPORT FPDF_TEXTINDEX FPDF_CALLCONV
+FPDFText_LoadIndex(const void* data, unsigned long size) {
+  if (!data) {
+    return nullptr;
+  }
+
+  // SAFETY: required from caller.
+  auto data_span =
+      UNSAFE_BUFFERS(pdfium::span(static_cast<const uint8_t*>(data), size));
+
+  // Caller takes ownership.
+  return FPDFTextIndexFromCPDFTextIndex(
+      CPDF_TextIndex::Deserialize(data_span).release());
+}
+
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDFText_ContinueIndex(FPDF_TEXTINDEX index,
+                       FPDF_DOCUMENT document,
+                       IFSDK_PAUSE* pause) {
+  CPDF_TextIndex* textindex = CPDFTextIndexFromFPDFTextIndex(index);
+  CPDF_Document* doc = CPDFDocumentFromFPDFDocument(document);
+  if (!textindex || !doc) {
+    return false;
+  }
+
+  // Pages are added one at a time on this thread, rather than in the
+  // background, as loading them is not thread-safe. Pausing between pages
+  // lets callers spread the work out instead.
+  const bool rtl = CPDF_ViewerPreferences(doc).IsDirectionR2L();
+  const int page_count = doc->GetPageCount();
+  while (textindex->page_count() < page_count) {
+    std::unique_ptr<CPDF_TextPage> textpage =
+        LoadTextOnlyPage(doc, textindex->page_count(), rtl);
+    if (textpage) {
+      textindex->AddPage(textpage->GetAllPageText().AsStringView(),
+                         textpage->GetCharIndicesOfText());
+    } else {
+      textindex->AddPage(WideStringView(), {});
+    }
+    if (textindex->page_count() < page_count && pause &&
+        CPDFSDK_PauseAdapter(pause).NeedToPauseNow()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+FPDF_EXPORT int FPDF_CALLCONV
+FPDFText_GetIndexedPageCount(FPDF_TEXTINDEX index) {
+  CPDF_TextIndex* textindex = CPDFTextIndexFromFPDFTextIndex(index);
+  return textindex ? textindex->page_count() : -1;
+}
+
+FPDF_EXPORT unsigned long FPDF_CALLCONV
+FPDFText_SaveIndex(FPDF_TEXTINDEX index, void* buffer, unsigned long buflen) {
+  CPDF_TextIndex* textindex = CPDFTextIndexFromFPDFTextIndex(index);
+  if (!textindex) {
+    return 0;
+  }
+
+  // SAFETY: required from caller.
+  auto result_span = UNSAFE_BUFFERS(SpanFromFPDFApiArgs(buffer, buflen));
+  const DataVector<uint8_t> data = textindex->Serialize();
+  fxcrt::try_spancpy(result_span, pdfium::span(data));
+  return pdfium::checked_cast<unsigned long>(data.size());
+}
+
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_FindInIndex(FPDF_TEXTINDEX index,
+                                                   FPDF_WIDESTRING query,
+                                                   FPDF_TEXT_INDEX_HIT* hits,
+                                                   int max_hits) {
+  CPDF_TextIndex* textindex = CPDFTextIndexFromFPDFTextIndex(index);
+  if (!textindex || !query || max_hits < 0) {
+    return -1;
+  }
+
+  // SAFETY: required from caller.
+  const std::vector<CPDF_TextIndex::Hit> found = textindex->Find(
+      UNSAFE_BUFFERS(WideStringFromFPDFWideString(query)).AsStringView());
+  if (hits) {
+    // SAFETY: required from caller.
+    auto hits_span =
+        UNSAFE_BUFFERS(pdfium::span(hits, static_cast<size_t>(max_hits)));
+    for (size_t i = 0; i < std::min(hits_span.size(), found.size()); ++i) {
+      hits_span[i].page_index = found[i].page_index;
+      hits_span[i].char_index = found[i].char_index;
+      hits_span[i].char_count = found[i].char_count;
+    }
+  }
+  return pdfium::checked_cast<int>(found.size());
+}
+
+FPDF_EXPORT void FPDF_CALLCONV FPDFText_CloseIndex(FPDF_TEXTINDEX index) {
+  // Take ownership back from caller and destroy.
+  std::unique_ptr<CPDF_TextIndex> textindex(
+      CPDFTextIndexFromFPDFTextIndex(index));
+}
+
 // web link
 FPDF_EXPORT FPDF_PAGELINK FPDF_CALLCONV
 FPDFLink_LoadWebLinks(FPDF_TEXTPAGE text_page) {
@@ -9,6 +9,8 @@
 #include <vector>
 
 #include "build/build_config.h"
+#include "core/fxcrt/compiler_specific.h"
+#include "core/fxcrt/fx_coordinates.h"
 #include "core/fxcrt/notreached.h"
 #include "core/fxge/fx_font.h"
 #include "public/cpp/fpdf_scopers.h"
@@ -20,6 +22,7 @@
 #include "testing/fx_string_testhelpers.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/utils/benchmark_timer.h"
 #include "testing/utils/compare_coordinates.h"
 
 using ::testing::ElementsAreArray;
@@ -278,6 +281,438 @@ TEST_F(FPDFTextEmbedderTest, Text) {
   EXPECT_EQ(0xbdbd, buffer[10]);
 }
 
+TEST_F(FPDFTextEmbedderTest, TextOnly) {
+  ASSERT_TRUE(OpenDocument("form_object_with_text.pdf"));
+  EXPECT_FALSE(FPDFText_LoadPageTextOnly(nullptr, 0));
+  EXPECT_FALSE(FPDFText_LoadPageTextOnly(document(), -1));
+  EXPECT_FALSE(FPDFText_LoadPageTextOnly(document(), 1));
+
+  // Text inside form XObjects gets extracted the same way as with a fully
+  // loaded page.
+  ScopedFPDFTextPage textpage(FPDFText_LoadPageTextOnly(document(), 0));
+  ASSERT_TRUE(textpage);
+  unsigned short buffer[128];
+  std::ranges::fill(buffer, 0xbdbd);
+  ASSERT_EQ(kHelloGoodbyeTextSize,
+            FPDFText_GetText(textpage.get(), 0, 128, buffer));
+  EXPECT_THAT(pdfium::span(buffer).first<kHelloGoodbyeTextSize>(),
+              ElementsAreArray(kHelloGoodbyeText));
+
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+  ScopedFPDFTextPage full_textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(full_textpage);
+  ASSERT_EQ(FPDFText_CountChars(full_textpage.get()),
+            FPDFText_CountChars(textpage.get()));
+  for (int i = 0; i < FPDFText_CountChars(textpage.get()); ++i) {
+    double left;
+    double right;
+    double bottom;
+    double top;
+    ASSERT_TRUE(
+        FPDFText_GetCharBox(textpage.get(), i, &left, &right, &bottom, &top));
+    double full_left;
+    double full_right;
+    double full_bottom;
+    double full_top;
+    ASSERT_TRUE(FPDFText_GetCharBox(full_textpage.get(), i, &full_left,
+                                    &full_right, &full_bottom, &full_top));
+    EXPECT_EQ(full_left, left) << i;
+    EXPECT_EQ(full_right, right) << i;
+    EXPECT_EQ(full_bottom, bottom) << i;
+    EXPECT_EQ(full_top, top) << i;
+  }
+}
+
+TEST_F(FPDFTextEmbedderTest, ExtractTextPageByPage) {
+  struct PageText {
+    int page_index;
+    std::vector<unsigned short> text;
+    int char_count;
+    std::vector<double> char_boxes;
+  };
+  auto collect = [](const FPDF_PAGE_TEXT* page_text, void* user_data) {
+    PageText result;
+    result.page_index = page_text->page_index;
+    if (page_text->text) {
+      // SAFETY: required from caller.
+      result.text.assign(page_text->text,
+                         UNSAFE_BUFFERS(page_text->text +
+                                        page_text->text_length));
+    }
+    result.char_count = page_text->char_count;
+    if (page_text->char_boxes) {
+      // SAFETY: required from caller.
+      result.char_boxes.assign(page_text->char_boxes,
+                               UNSAFE_BUFFERS(page_text->char_boxes +
+                                              page_text->char_count * 4));
+    }
+    static_cast<std::vector<PageText>*>(user_data)->push_back(
+        std::move(result));
+    return static_cast<FPDF_BOOL>(true);
+  };
+
+  ASSERT_TRUE(OpenDocument("hello_world.pdf"));
+  std::vector<PageText> pages;
+  EXPECT_FALSE(FPDFText_ExtractTextPageByPage(nullptr, 0, collect, &pages));
+  EXPECT_FALSE(FPDFText_ExtractTextPageByPage(document(), 0, nullptr, &pages));
+  EXPECT_FALSE(FPDFText_ExtractTextPageByPage(document(), 2, collect, &pages));
+  EXPECT_TRUE(pages.empty());
+
+  ASSERT_TRUE(FPDFText_ExtractTextPageByPage(
+      document(), FPDF_TEXT_EXTRACT_CHAR_BOXES, collect, &pages));
+  ASSERT_EQ(1u, pages.size());
+  EXPECT_EQ(0, pages[0].page_index);
+  EXPECT_THAT(pages[0].text,
+              ElementsAreArray(pdfium::span(kHelloGoodbyeText)
+                                   .first<kHelloGoodbyeTextSize - 1>()));
+
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+  ScopedFPDFTextPage textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(textpage);
+  ASSERT_EQ(FPDFText_CountChars(textpage.get()), pages[0].char_count);
+  ASSERT_EQ(static_cast<size_t>(pages[0].char_count) * 4,
+            pages[0].char_boxes.size());
+  for (int i = 0; i < pages[0].char_count; ++i) {
+    double left;
+    double right;
+    double bottom;
+    double top;
+    ASSERT_TRUE(
+        FPDFText_GetCharBox(textpage.get(), i, &left, &right, &bottom, &top));
+    EXPECT_EQ(left, pages[0].char_boxes[i * 4]) << i;
+    EXPECT_EQ(right, pages[0].char_boxes[i * 4 + 1]) << i;
+    EXPECT_EQ(bottom, pages[0].char_boxes[i * 4 + 2]) << i;
+    EXPECT_EQ(top, pages[0].char_boxes[i * 4 + 3]) << i;
+  }
+
+  // Without the flag, there are no boxes.
+  pages.clear();
+  ASSERT_TRUE(FPDFText_ExtractTextPageByPage(document(), 0, collect, &pages));
+  ASSERT_EQ(1u, pages.size());
+  EXPECT_EQ(FPDFText_CountChars(textpage.get()), pages[0].char_count);
+  EXPECT_TRUE(pages[0].char_boxes.empty());
+
+  // Stopping early is reported.
+  auto stop = [](const FPDF_PAGE_TEXT*, void* user_data) {
+    ++*static_cast<int*>(user_data);
+    return static_cast<FPDF_BOOL>(false);
+  };
+  int calls = 0;
+  EXPECT_FALSE(FPDFText_ExtractTextPageByPage(document(), 0, stop, &calls));
+  EXPECT_EQ(1, calls);
+}
+
+TEST_F(FPDFTextEmbedderTest, DocFind) {
+  ASSERT_TRUE(OpenDocument("hello_world_2_pages.pdf"));
+  ScopedFPDFWideString world = GetFPDFWideString(L"world");
+  EXPECT_FALSE(FPDFText_DocFindStart(nullptr, world.get(), 0, 0, 0));
+  EXPECT_FALSE(FPDFText_DocFindStart(document(), nullptr, 0, 0, 0));
+  EXPECT_EQ(FPDF_DOCFIND_NOT_FOUND, FPDFText_DocFindNext(nullptr, nullptr));
+
+  // Without room to cache pages, only the page being searched is kept.
+  for (unsigned long max_cache_bytes : {0ul, 1024ul * 1024}) {
+    ScopedFPDFTextDocFind find(
+        FPDFText_DocFindStart(document(), world.get(), 0, 0, max_cache_bytes));
+    ASSERT_TRUE(find);
+    int page_index = -1;
+    int char_index = -1;
+    int char_count = -1;
+    EXPECT_FALSE(FPDFText_DocFindGetResult(find.get(), &page_index,
+                                           &char_index, &char_count));
+
+    // Matches on both pages are found in order.
+    static constexpr int kExpectedMatches[][2] = {{0, 7}, {0, 24}, {1, 7},
+                                                  {1, 24}};
+    for (const auto& expected : kExpectedMatches) {
+      ASSERT_EQ(FPDF_DOCFIND_FOUND, FPDFText_DocFindNext(find.get(), nullptr));
+      ASSERT_TRUE(FPDFText_DocFindGetResult(find.get(), &page_index,
+                                            &char_index, &char_count));
+      EXPECT_EQ(expected[0], page_index);
+      EXPECT_EQ(expected[1], char_index);
+      EXPECT_EQ(5, char_count);
+    }
+    EXPECT_EQ(FPDF_DOCFIND_NOT_FOUND,
+              FPDFText_DocFindNext(find.get(), nullptr));
+
+    // Going back moves back onto the first page.
+    ASSERT_EQ(FPDF_DOCFIND_FOUND, FPDFText_DocFindPrev(find.get(), nullptr));
+    ASSERT_TRUE(FPDFText_DocFindGetResult(find.get(), &page_index, &char_index,
+                                          &char_count));
+    EXPECT_EQ(1, page_index);
+    EXPECT_EQ(7, char_index);
+    ASSERT_EQ(FPDF_DOCFIND_FOUND, FPDFText_DocFindPrev(find.get(), nullptr));
+    ASSERT_TRUE(FPDFText_DocFindGetResult(find.get(), &page_index, &char_index,
+                                          &char_count));
+    EXPECT_EQ(0, page_index);
+    EXPECT_EQ(24, char_index);
+  }
+
+  // Searching backwards starts at the end of the start page.
+  ScopedFPDFTextDocFind find(
+      FPDFText_DocFindStart(document(), world.get(), 0, 1, 0));
+  ASSERT_TRUE(find);
+  ASSERT_EQ(FPDF_DOCFIND_FOUND, FPDFText_DocFindPrev(find.get(), nullptr));
+  int page_index = -1;
+  int char_index = -1;
+  int char_count = -1;
+  ASSERT_TRUE(FPDFText_DocFindGetResult(find.get(), &page_index, &char_index,
+                                        &char_count));
+  EXPECT_EQ(1, page_index);
+  EXPECT_EQ(24, char_index);
+
+  find.reset(FPDFText_DocFindStart(document(), world.get(), 0, 2, 0));
+  ASSERT_TRUE(find);
+  EXPECT_EQ(FPDF_DOCFIND_NOT_FOUND, FPDFText_DocFindNext(find.get(), nullptr));
+
+  // Pausing happens between pages, after searching at least one.
+  IFSDK_PAUSE pause = {};
+  pause.version = 1;
+  pause.NeedToPauseNow = [](IFSDK_PAUSE*) { return static_cast<FPDF_BOOL>(1); };
+  ScopedFPDFWideString nope = GetFPDFWideString(L"nope");
+  find.reset(FPDFText_DocFindStart(document(), nope.get(), 0, 0, 0));
+  ASSERT_TRUE(find);
+  EXPECT_EQ(FPDF_DOCFIND_TOBECONTINUED,
+            FPDFText_DocFindNext(find.get(), &pause));
+  EXPECT_EQ(FPDF_DOCFIND_NOT_FOUND, FPDFText_DocFindNext(find.get(), &pause));
+  EXPECT_FALSE(FPDFText_DocFindGetResult(find.get(), &page_index, &char_index,
+                                         &char_count));
+}
+
+TEST_F(FPDFTextEmbedderTest, TextLinesAndBlocks) {
+  ASSERT_TRUE(OpenDocument("hello_world.pdf"));
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+  ScopedFPDFTextPage textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(textpage);
+
+  EXPECT_EQ(-1, FPDFText_GetTextLines(nullptr, nullptr, 0));
+  EXPECT_EQ(-1, FPDFText_GetTextLines(textpage.get(), nullptr, -1));
+  EXPECT_EQ(-1, FPDFText_GetTextBlocks(nullptr, nullptr, 0));
+  EXPECT_EQ(-1, FPDFText_GetTextBlocks(textpage.get(), nullptr, -1));
+  EXPECT_EQ(2, FPDFText_GetTextLines(textpage.get(), nullptr, 0));
+  EXPECT_EQ(2, FPDFText_GetTextBlocks(textpage.get(), nullptr, 0));
+
+  // "Hello, world!" and "Goodbye, world!", without the "\r\n" between them.
+  FPDF_TEXT_LINE lines[3] = {};
+  lines[1].char_index = 42;
+  ASSERT_EQ(2, FPDFText_GetTextLines(textpage.get(), lines, 1));
+  EXPECT_EQ(0, lines[0].char_index);
+  EXPECT_EQ(42, lines[1].char_index);
+  ASSERT_EQ(2, FPDFText_GetTextLines(textpage.get(), lines, 3));
+  EXPECT_EQ(0, lines[0].char_index);
+  EXPECT_EQ(13, lines[0].char_count);
+  EXPECT_EQ(15, lines[1].char_index);
+  EXPECT_EQ(15, lines[1].char_count);
+
+  // The bounds cover the char boxes, and the baseline runs through the origins
+  // of the first and last chars.
+  double left;
+  double right;
+  double bottom;
+  double top;
+  ASSERT_TRUE(
+      FPDFText_GetCharBox(textpage.get(), 4, &left, &right, &bottom, &top));
+  EXPECT_LE(lines[0].bounds.left, left);
+  EXPECT_GE(lines[0].bounds.right, right);
+  EXPECT_LE(lines[0].bounds.bottom, bottom);
+  EXPECT_GE(lines[0].bounds.top, top);
+  double x;
+  double y;
+  ASSERT_TRUE(FPDFText_GetCharOrigin(textpage.get(), 0, &x, &y));
+  EXPECT_FLOAT_EQ(x, lines[0].baseline_start.x);
+  EXPECT_FLOAT_EQ(y, lines[0].baseline_start.y);
+  ASSERT_TRUE(FPDFText_GetCharOrigin(textpage.get(), 29, &x, &y));
+  EXPECT_FLOAT_EQ(x, lines[1].baseline_end.x);
+  EXPECT_FLOAT_EQ(y, lines[1].baseline_end.y);
+  EXPECT_LT(lines[0].bounds.top, lines[1].bounds.bottom);
+
+  // The lines are far enough apart to be blocks of their own.
+  EXPECT_EQ(0, lines[0].block_index);
+  EXPECT_EQ(1, lines[1].block_index);
+  FPDF_TEXT_BLOCK blocks[2] = {};
+  ASSERT_EQ(2, FPDFText_GetTextBlocks(textpage.get(), blocks, 2));
+  EXPECT_EQ(0, blocks[0].line_index);
+  EXPECT_EQ(1, blocks[0].line_count);
+  EXPECT_FLOAT_EQ(lines[0].bounds.left, blocks[0].bounds.left);
+  EXPECT_FLOAT_EQ(lines[0].bounds.top, blocks[0].bounds.top);
+  EXPECT_FLOAT_EQ(lines[0].bounds.right, blocks[0].bounds.right);
+  EXPECT_FLOAT_EQ(lines[0].bounds.bottom, blocks[0].bounds.bottom);
+  EXPECT_EQ(1, blocks[1].line_index);
+  EXPECT_EQ(1, blocks[1].line_count);
+}
+
+TEST_F(FPDFTextEmbedderTest, GetCharInfoBatch) {
+  ASSERT_TRUE(OpenDocument("hello_world.pdf"));
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+  ScopedFPDFTextPage textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(textpage);
+  const int char_count = FPDFText_CountChars(textpage.get());
+  ASSERT_EQ(kHelloGoodbyeTextSize - 1, char_count);
+
+  std::vector<unsigned int> unicode(char_count + 1);
+  std::vector<double> origin_x(char_count + 1);
+  std::vector<double> origin_y(char_count + 1);
+  std::vector<double> left(char_count + 1);
+  std::vector<double> right(char_count + 1);
+  std::vector<double> bottom(char_count + 1);
+  std::vector<double> top(char_count + 1);
+  std::vector<double> font_size(char_count + 1);
+  FPDF_TEXT_CHAR_INFO_ARRAYS arrays = {
+      unicode.data(), origin_x.data(), origin_y.data(), left.data(),
+      right.data(),   bottom.data(),   top.data(),      font_size.data()};
+
+  EXPECT_EQ(-1, FPDFText_GetCharInfoBatch(nullptr, 0, 1, &arrays));
+  EXPECT_EQ(-1, FPDFText_GetCharInfoBatch(textpage.get(), 0, 1, nullptr));
+  EXPECT_EQ(-1, FPDFText_GetCharInfoBatch(textpage.get(), -1, 1, &arrays));
+  EXPECT_EQ(-1, FPDFText_GetCharInfoBatch(textpage.get(), 0, -1, &arrays));
+  EXPECT_EQ(-1, FPDFText_GetCharInfoBatch(textpage.get(), char_count + 1, 1,
+                                          &arrays));
+  EXPECT_EQ(0,
+            FPDFText_GetCharInfoBatch(textpage.get(), char_count, 1, &arrays));
+
+  // The range is clipped to the chars on the page.
+  ASSERT_EQ(char_count, FPDFText_GetCharInfoBatch(textpage.get(), 0,
+                                                  char_count + 1, &arrays));
+  for (int i = 0; i < char_count; ++i) {
+    SCOPED_TRACE(i);
+    EXPECT_EQ(FPDFText_GetUnicode(textpage.get(), i), unicode[i]);
+    double x;
+    double y;
+    ASSERT_TRUE(FPDFText_GetCharOrigin(textpage.get(), i, &x, &y));
+    EXPECT_EQ(x, origin_x[i]);
+    EXPECT_EQ(y, origin_y[i]);
+    double char_left;
+    double char_right;
+    double char_bottom;
+    double char_top;
+    ASSERT_TRUE(FPDFText_GetCharBox(textpage.get(), i, &char_left, &char_right,
+                                    &char_bottom, &char_top));
+    EXPECT_EQ(char_left, left[i]);
+    EXPECT_EQ(char_right, right[i]);
+    EXPECT_EQ(char_bottom, bottom[i]);
+    EXPECT_EQ(char_top, top[i]);
+    EXPECT_EQ(FPDFText_GetFontSize(textpage.get(), i), font_size[i]);
+  }
+
+  // Arrays that are not needed may be NULL.
+  std::ranges::fill(unicode, 0);
+  FPDF_TEXT_CHAR_INFO_ARRAYS unicode_only = {};
+  unicode_only.unicode = unicode.data();
+  ASSERT_EQ(2, FPDFText_GetCharInfoBatch(textpage.get(), 15, 2, &unicode_only));
+  EXPECT_EQ(static_cast<unsigned int>('G'), unicode[0]);
+  EXPECT_EQ(static_cast<unsigned int>('o'), unicode[1]);
+  EXPECT_EQ(0u, unicode[2]);
+}
+
+// Not run by default. Use --gtest_also_run_disabled_tests to compare getting
+// the info of each char with one call per field and char against one
+// FPDFText_GetCharInfoBatch() call per page.
+TEST_F(FPDFTextEmbedderTest, DISABLED_GetCharInfoBatchBenchmark) {
+  static constexpr int kIterations = 200000;
+  ASSERT_TRUE(OpenDocument("bigtable_mini.pdf"));
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+  ScopedFPDFTextPage textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(textpage);
+  const int char_count = FPDFText_CountChars(textpage.get());
+
+  std::vector<unsigned int> unicode(char_count);
+  std::vector<double> origin_x(char_count);
+  std::vector<double> origin_y(char_count);
+  std::vector<double> left(char_count);
+  std::vector<double> right(char_count);
+  std::vector<double> bottom(char_count);
+  std::vector<double> top(char_count);
+  std::vector<double> font_size(char_count);
+
+  // Time per char, rather than per page.
+  const size_t runs = static_cast<size_t>(kIterations) * char_count;
+  {
+    ScopedBenchmarkTimer timer("Per-char calls", runs);
+    for (int i = 0; i < kIterations; ++i) {
+      for (int j = 0; j < char_count; ++j) {
+        unicode[j] = FPDFText_GetUnicode(textpage.get(), j);
+        FPDFText_GetCharOrigin(textpage.get(), j, &origin_x[j], &origin_y[j]);
+        FPDFText_GetCharBox(textpage.get(), j, &left[j], &right[j], &bottom[j],
+                            &top[j]);
+        font_size[j] = FPDFText_GetFontSize(textpage.get(), j);
+      }
+    }
+  }
+
+  FPDF_TEXT_CHAR_INFO_ARRAYS arrays = {
+      unicode.data(), origin_x.data(), origin_y.data(), left.data(),
+      right.data(),   bottom.data(),   top.data(),      font_size.data()};
+  ScopedBenchmarkTimer timer("Batch call", runs);
+  for (int i = 0; i < kIterations; ++i) {
+    ASSERT_EQ(char_count, FPDFText_GetCharInfoBatch(textpage.get(), 0,
+                                                    char_count, &arrays));
+  }
+}
+
+TEST_F(FPDFTextEmbedderTest, TextIndex) {
+  ASSERT_TRUE(OpenDocument("hello_world_2_pages.pdf"));
+  ScopedFPDFTextIndex index(FPDFText_CreateIndex());
+  ASSERT_TRUE(index);
+  EXPECT_EQ(0, FPDFText_GetIndexedPageCount(index.get()));
+  EXPECT_EQ(-1, FPDFText_GetIndexedPageCount(nullptr));
+  EXPECT_FALSE(FPDFText_ContinueIndex(nullptr, document(), nullptr));
+  EXPECT_FALSE(FPDFText_ContinueIndex(index.get(), nullptr, nullptr));
+
+  // Pause after every page.
+  IFSDK_PAUSE pause = {};
+  pause.version = 1;
+  pause.NeedToPauseNow = [](IFSDK_PAUSE*) { return static_cast<FPDF_BOOL>(1); };
+  EXPECT_FALSE(FPDFText_ContinueIndex(index.get(), document(), &pause));
+  EXPECT_EQ(1, FPDFText_GetIndexedPageCount(index.get()));
+
+  ScopedFPDFWideString query = GetFPDFWideString(L"WORLD goodbye");
+  FPDF_TEXT_INDEX_HIT hits[2] = {};
+  ASSERT_EQ(1, FPDFText_FindInIndex(index.get(), query.get(), hits, 2));
+  EXPECT_EQ(0, hits[0].page_index);
+
+  // The hit spans from "world" to "Goodbye", as text page char indices.
+  EXPECT_EQ(7, hits[0].char_index);
+  EXPECT_EQ(15, hits[0].char_count);
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+  ScopedFPDFTextPage textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(textpage);
+  unsigned short buffer[16];
+  ASSERT_EQ(16, FPDFText_GetText(textpage.get(), hits[0].char_index,
+                                 hits[0].char_count, buffer));
+  EXPECT_EQ(L"world!\r\nGoodbye", GetPlatformWString(buffer));
+
+  EXPECT_TRUE(FPDFText_ContinueIndex(index.get(), document(), &pause));
+  EXPECT_EQ(2, FPDFText_GetIndexedPageCount(index.get()));
+  EXPECT_TRUE(FPDFText_ContinueIndex(index.get(), document(), nullptr));
+
+  // The count includes the hits that do not fit.
+  ScopedFPDFWideString world = GetFPDFWideString(L"world");
+  EXPECT_EQ(4, FPDFText_FindInIndex(index.get(), world.get(), hits, 2));
+  EXPECT_EQ(0, hits[1].page_index);
+  EXPECT_EQ(4, FPDFText_FindInIndex(index.get(), world.get(), nullptr, 0));
+  EXPECT_EQ(-1, FPDFText_FindInIndex(index.get(), world.get(), hits, -1));
+  EXPECT_EQ(-1, FPDFText_FindInIndex(index.get(), nullptr, hits, 2));
+  ScopedFPDFWideString nope = GetFPDFWideString(L"nope");
+  EXPECT_EQ(0, FPDFText_FindInIndex(index.get(), nope.get(), hits, 2));
+
+  // Saved indices load back the same.
+  const unsigned long size = FPDFText_SaveIndex(index.get(), nullptr, 0);
+  ASSERT_GT(size, 0u);
+  std::vector<uint8_t> data(size);
+  EXPECT_EQ(size, FPDFText_SaveIndex(index.get(), data.data(), size));
+  ScopedFPDFTextIndex loaded(FPDFText_LoadIndex(data.data(), size));
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(2, FPDFText_GetIndexedPageCount(loaded.get()));
+  EXPECT_EQ(4, FPDFText_FindInIndex(loaded.get(), world.get(), nullptr, 0));
+  EXPECT_FALSE(FPDFText_LoadIndex(data.data(), size - 1));
+  EXPECT_FALSE(FPDFText_LoadIndex(nullptr, 0));
+}
+
 TEST_F(FPDFTextEmbedderTest, TextVertical) {
   ASSERT_TRUE(OpenDocument("vertical_text.pdf"));
   ScopedPage page = LoadScopedPage(0);
@@ -347,6 +782,70 @@ TEST_F(FPDFTextEmbedderTest, TextVertical) {
   EXPECT_NEAR(170.308, rect.top, 0.001);
 }
 
+// bug_921.pdf has enough chars for position lookups to use a CPDF_CharBoxGrid.
+TEST_F(FPDFTextEmbedderTest, Bug921CharsAtPos) {
+  ASSERT_TRUE(OpenDocument("bug_921.pdf"));
+  ScopedPage page = LoadScopedPage(0);
+  ASSERT_TRUE(page);
+
+  ScopedFPDFTextPage textpage(FPDFText_LoadPage(page.get()));
+  ASSERT_TRUE(textpage);
+
+  const int char_count = FPDFText_CountChars(textpage.get());
+  ASSERT_EQ(268, char_count);
+  std::vector<CFX_FloatRect> boxes;
+  for (int i = 0; i < char_count; ++i) {
+    double left;
+    double right;
+    double bottom;
+    double top;
+    ASSERT_TRUE(
+        FPDFText_GetCharBox(textpage.get(), i, &left, &right, &bottom, &top));
+    boxes.emplace_back(left, bottom, right, top);
+  }
+
+  int tested_count = 0;
+  for (int i = 0; i < char_count; ++i) {
+    CFX_FloatRect box = boxes[i];
+    box.Normalize();
+    if (box.Width() <= 0 || box.Height() <= 0) {
+      continue;
+    }
+    SCOPED_TRACE(i);
+    ++tested_count;
+
+    // The first char whose box contains the center of this one.
+    const CFX_PointF center((box.left + box.right) / 2,
+                            (box.bottom + box.top) / 2);
+    int expected = 0;
+    while (!boxes[expected].Contains(center)) {
+      ++expected;
+    }
+    EXPECT_EQ(expected, FPDFText_GetCharIndexAtPos(textpage.get(), center.x,
+                                                   center.y, 0, 0));
+    EXPECT_EQ(expected, FPDFText_GetCharIndexAtPos(textpage.get(), center.x,
+                                                   center.y, 10, 10));
+
+    // The text within the box includes the char.
+    const unsigned int unicode = FPDFText_GetUnicode(textpage.get(), i);
+    unsigned short buffer[512];
+    const int length =
+        FPDFText_GetBoundedText(textpage.get(), box.left, box.top, box.right,
+                                box.bottom, buffer, std::size(buffer));
+    ASSERT_GT(length, 0);
+    const auto text = pdfium::span(buffer).first(static_cast<size_t>(length));
+    if (unicode < 0x10000) {
+      EXPECT_NE(text.end(), std::ranges::find(text, unicode));
+    }
+  }
+  EXPECT_GT(tested_count, 200);
+
+  EXPECT_EQ(-1,
+            FPDFText_GetCharIndexAtPos(textpage.get(), -1000, -1000, 0, 0));
+  EXPECT_EQ(-1,
+            FPDFText_GetCharIndexAtPos(textpage.get(), -1000, -1000, 10, 10));
+}
+
 TEST_F(FPDFTextEmbedderTest, TextHebrewMirrored) {
   ASSERT_TRUE(OpenDocument("hebrew_mirrored.pdf"));
   ScopedPage page = LoadScopedPage(0);
@@ -32,6 +32,7 @@
 #include "core/fpdfdoc/cpdf_nametree.h"
 #include "core/fpdfdoc/cpdf_viewerpreferences.h"
 #include "core/fxcrt/cfx_read_only_span_stream.h"
+#include "core/fxcrt/cfx_threadpool.h"
 #include "core/fxcrt/cfx_timer.h"
 #include "core/fxcrt/check_op.h"
 #include "core/fxcrt/compiler_specific.h"
@@ -242,6 +243,8 @@ FPDF_InitLibraryWithConfig(const FPDF_LIBRARY_CONFIG* config) {
 
   FX_InitializeMemoryAllocators();
   CFX_Timer::InitializeGlobals();
+  CFX_ThreadPool::InitializeGlobals(
+      config && config->version >= 5 ? config->m_WorkerThreadCount : 0);
   CFX_GEModule::Create(config ? config->m_pUserFontPaths : nullptr);
   pdfium::InitializePageModule();
 
@@ -285,6 +288,7 @@ FPDF_EXPORT void FPDF_CALLCONV FPDF_DestroyLibrary() {
 
   pdfium::DestroyPageModule();
   CFX_GEModule::Destroy();
+  CFX_ThreadPool::DestroyGlobals();
   CFX_Timer::DestroyGlobals();
   FX_DestroyMemoryAllocators();
 
@@ -361,6 +361,7 @@ int CheckPDFiumCApi() {
 
     // fpdf_save.h
     CHK(FPDF_SaveAsCopy);
+    CHK(FPDF_SaveWithOptions);
     CHK(FPDF_SaveWithVersion);
 
     // fpdf_searchex.h
@@ -427,10 +428,20 @@ int CheckPDFiumCApi() {
     CHK(FPDFLink_GetTextRange);
     CHK(FPDFLink_GetURL);
     CHK(FPDFLink_LoadWebLinks);
+    CHK(FPDFText_CloseIndex);
     CHK(FPDFText_ClosePage);
+    CHK(FPDFText_ContinueIndex);
     CHK(FPDFText_CountChars);
     CHK(FPDFText_CountRects);
+    CHK(FPDFText_CreateIndex);
+    CHK(FPDFText_DocFindClose);
+    CHK(FPDFText_DocFindGetResult);
+    CHK(FPDFText_DocFindNext);
+    CHK(FPDFText_DocFindPrev);
+    CHK(FPDFText_DocFindStart);
+    CHK(FPDFText_ExtractTextPageByPage);
     CHK(FPDFText_FindClose);
+    CHK(FPDFText_FindInIndex);
     CHK(FPDFText_FindNext);
     CHK(FPDFText_FindPrev);
     CHK(FPDFText_FindStart);
@@ -438,11 +449,13 @@ int CheckPDFiumCApi() {
     CHK(FPDFText_GetCharAngle);
     CHK(FPDFText_GetCharBox);
     CHK(FPDFText_GetCharIndexAtPos);
+    CHK(FPDFText_GetCharInfoBatch);
     CHK(FPDFText_GetCharOrigin);
     CHK(FPDFText_GetFillColor);
     CHK(FPDFText_GetFontInfo);
     CHK(FPDFText_GetFontSize);
     CHK(FPDFText_GetFontWeight);
+    CHK(FPDFText_GetIndexedPageCount);
     CHK(FPDFText_GetLooseCharBox);
     CHK(FPDFText_GetMatrix);
     CHK(FPDFText_GetRect);
@@ -450,12 +463,17 @@ int CheckPDFiumCApi() {
     CHK(FPDFText_GetSchResultIndex);
     CHK(FPDFText_GetStrokeColor);
     CHK(FPDFText_GetText);
+    CHK(FPDFText_GetTextBlocks);
+    CHK(FPDFText_GetTextLines);
     CHK(FPDFText_GetTextObject);
     CHK(FPDFText_GetUnicode);
     CHK(FPDFText_HasUnicodeMapError);
     CHK(FPDFText_IsGenerated);
     CHK(FPDFText_IsHyphen);
+    CHK(FPDFText_LoadIndex);
     CHK(FPDFText_LoadPage);
+    CHK(FPDFText_LoadPageTextOnly);
+    CHK(FPDFText_SaveIndex);
 
     // fpdf_thumbnail.h
     CHK(FPDFPage_GetDecodedThumbnailData);
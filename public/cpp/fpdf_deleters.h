@@ -75,10 +75,20 @@ struct FPDFStructTreeDeleter {
   inline void operator()(FPDF_STRUCTTREE tree) { FPDF_StructTree_Close(tree); }
 };
 
+struct FPDFTextDocFindDeleter {
+  inline void operator()(FPDF_DOCSCHHANDLE handle) {
+    FPDFText_DocFindClose(handle);
+  }
+};
+
 struct FPDFTextFindDeleter {
   inline void operator()(FPDF_SCHHANDLE handle) { FPDFText_FindClose(handle); }
 };
 
+struct FPDFTextIndexDeleter {
+  inline void operator()(FPDF_TEXTINDEX index) { FPDFText_CloseIndex(index); }
+};
+
 struct FPDFTextPageDeleter {
   inline void operator()(FPDF_TEXTPAGE text) { FPDFText_ClosePage(text); }
 };
@@ -56,10 +56,18 @@ using ScopedFPDFStructTree =
     std::unique_ptr<std::remove_pointer<FPDF_STRUCTTREE>::type,
                     FPDFStructTreeDeleter>;
 
+using ScopedFPDFTextDocFind =
+    std::unique_ptr<std::remove_pointer<FPDF_DOCSCHHANDLE>::type,
+                    FPDFTextDocFindDeleter>;
+
 using ScopedFPDFTextFind =
     std::unique_ptr<std::remove_pointer<FPDF_SCHHANDLE>::type,
                     FPDFTextFindDeleter>;
 
+using ScopedFPDFTextIndex =
+    std::unique_ptr<std::remove_pointer<FPDF_TEXTINDEX>::type,
+                    FPDFTextIndexDeleter>;
+
 using ScopedFPDFTextPage =
     std::unique_ptr<std::remove_pointer<FPDF_TEXTPAGE>::type,
                     FPDFTextPageDeleter>;
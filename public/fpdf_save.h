@@ -79,6 +79,51 @@ FPDF_SaveWithVersion(FPDF_DOCUMENT document,
                      FPDF_DWORD flags,
                      int fileVersion);
 
+// Compression strategies for FPDF_SAVE_OPTIONS, same as zlib's.
+#define FPDF_COMPRESSION_STRATEGY_DEFAULT 0
+#define FPDF_COMPRESSION_STRATEGY_FILTERED 1
+#define FPDF_COMPRESSION_STRATEGY_HUFFMAN_ONLY 2
+#define FPDF_COMPRESSION_STRATEGY_RLE 3
+
+// Experimental API.
+// Options for FPDF_SaveWithOptions().
+typedef struct FPDF_SAVE_OPTIONS_ {
+  // Version number of the interface. Currently must be 1.
+  int version;
+
+  // The PDF file version as for FPDF_SaveWithVersion(), or 0 to keep the
+  // version of the document.
+  int file_version;
+
+  // The zlib compression level for streams that get compressed when saving,
+  // from 0 for none to 9 for the smallest output, or -1 for the default.
+  int compression_level;
+
+  // One of the FPDF_COMPRESSION_STRATEGY_* values.
+  int compression_strategy;
+} FPDF_SAVE_OPTIONS;
+
+// Experimental API.
+// Function: FPDF_SaveWithOptions
+//          Same as FPDF_SaveAsCopy(), except the file version and the
+//          compression of the saved document can be specified by the caller.
+//          If FPDF_InitLibraryWithConfig() set up worker threads, streams get
+//          compressed on them. The output does not depend on the number of
+//          threads.
+// Parameters:
+//          document        -   Handle to document.
+//          pFileWrite      -   A pointer to a custom file write structure.
+//          flags           -   The creating flags.
+//          options         -   The options to save with.
+// Return value:
+//          TRUE if succeed, FALSE if failed, including for invalid |options|.
+//
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDF_SaveWithOptions(FPDF_DOCUMENT document,
+                     FPDF_FILEWRITE* pFileWrite,
+                     FPDF_DWORD flags,
+                     const FPDF_SAVE_OPTIONS* options);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,9 @@
 // NOLINTNEXTLINE(build/include)
 #include "fpdfview.h"
 
+// NOLINTNEXTLINE(build/include)
+#include "fpdf_progressive.h"
+
 // Exported Functions
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +33,89 @@ extern "C" {
 //
 FPDF_EXPORT FPDF_TEXTPAGE FPDF_CALLCONV FPDFText_LoadPage(FPDF_PAGE page);
 
+// Experimental API.
+// Function: FPDFText_LoadPageTextOnly
+//          Same as FPDFText_LoadPage(), for a page that has not been loaded
+//          with FPDF_LoadPage(). Only the text of the page content is parsed:
+//          paths, images, shadings and clipping paths are skipped, and image
+//          data is never loaded. For callers that only need the text, this is
+//          much faster than FPDF_LoadPage() followed by FPDFText_LoadPage().
+// Parameters:
+//          document    -   Handle to the document.
+//          page_index  -   Index number of the page. 0 for the first page.
+// Return value:
+//          A handle to the text page information structure.
+//          NULL if something goes wrong.
+// Comments:
+//          Application must call FPDFText_ClosePage to release the text page
+//          information. The page content parsed for it is released along
+//          with it, including the text objects that FPDFText_GetTextObject()
+//          returns.
+//
+FPDF_EXPORT FPDF_TEXTPAGE FPDF_CALLCONV
+FPDFText_LoadPageTextOnly(FPDF_DOCUMENT document, int page_index);
+
+// Experimental API.
+// Flag for FPDFText_ExtractTextPageByPage() to also extract the box of each
+// char.
+#define FPDF_TEXT_EXTRACT_CHAR_BOXES 0x1
+
+// Experimental API.
+// The text of one page, passed to FPDF_PAGE_TEXT_CALLBACK. The pointers are
+// only valid during the callback.
+typedef struct FPDF_PAGE_TEXT_ {
+  // Index number of the page. 0 for the first page.
+  int page_index;
+
+  // The text of all chars on the page, in UTF-16LE as FPDFText_GetText()
+  // returns it, but without the terminating NUL. NULL if |text_length| is 0.
+  const unsigned short* text;
+
+  // Number of UTF-16 code units in |text|.
+  int text_length;
+
+  // Number of chars on the page, as FPDFText_CountChars() returns it.
+  int char_count;
+
+  // With FPDF_TEXT_EXTRACT_CHAR_BOXES, 4 values per char, in char order:
+  // left, right, bottom and top, as FPDFText_GetCharBox() returns them.
+  // Otherwise, or if |char_count| is 0, NULL.
+  const double* char_boxes;
+} FPDF_PAGE_TEXT;
+
+// Experimental API.
+// Called once per page by FPDFText_ExtractTextPageByPage(), in page order.
+// Returns TRUE to continue with the next page, or FALSE to stop.
+typedef FPDF_BOOL (*FPDF_PAGE_TEXT_CALLBACK)(const FPDF_PAGE_TEXT* page_text,
+                                             void* user_data);
+
+// Experimental API.
+// Function: FPDFText_ExtractTextPageByPage
+//          Extract the text of all pages of a document, one page after the
+//          other.
+// Parameters:
+//          document    -   Handle to the document.
+//          flags       -   0, or FPDF_TEXT_EXTRACT_CHAR_BOXES.
+//          callback    -   Called with the text of each page, in page order,
+//                          on the calling thread.
+//          user_data   -   Passed to |callback|.
+// Return value:
+//          TRUE if the text of every page was passed to |callback|. FALSE
+//          for invalid arguments, or if |callback| returned FALSE.
+// Comments:
+//          Pages are loaded as with FPDFText_LoadPageTextOnly(). Pages that
+//          fail to load are passed to |callback| without any text. Each page
+//          is loaded, extracted and released before the next one, so only one
+//          page is held in memory at a time. This saves making the
+//          FPDF_LoadPage(), FPDFText_LoadPage() and FPDFText_GetText() calls
+//          for each page, but does not extract pages in parallel.
+//
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDFText_ExtractTextPageByPage(FPDF_DOCUMENT document,
+                               unsigned long flags,
+                               FPDF_PAGE_TEXT_CALLBACK callback,
+                               void* user_data);
+
 // Function: FPDFText_ClosePage
 //          Release all resources allocated for a text page information
 //          structure.
@@ -345,6 +431,53 @@ FPDFText_GetCharOrigin(FPDF_TEXTPAGE text_page,
                        double* x,
                        double* y);
 
+// Experimental API.
+// Caller-allocated arrays for FPDFText_GetCharInfoBatch(), one value per char
+// in each. Arrays that are not needed may be NULL.
+typedef struct FPDF_TEXT_CHAR_INFO_ARRAYS_ {
+  // As FPDFText_GetUnicode() returns it.
+  unsigned int* unicode;
+
+  // As FPDFText_GetCharOrigin() returns it.
+  double* origin_x;
+  double* origin_y;
+
+  // As FPDFText_GetCharBox() returns it.
+  double* left;
+  double* right;
+  double* bottom;
+  double* top;
+
+  // As FPDFText_GetFontSize() returns it.
+  double* font_size;
+} FPDF_TEXT_CHAR_INFO_ARRAYS;
+
+// Experimental API.
+// Function: FPDFText_GetCharInfoBatch
+//          Get the unicode, origin, box and font size of a range of chars in
+//          one call.
+// Parameters:
+//          text_page   -   Handle to a text page information structure.
+//                          Returned by FPDFText_LoadPage function.
+//          start_index -   Index of the first char.
+//          count       -   Number of chars. Each non-NULL array in |arrays|
+//                          must hold at least |count| values.
+//          arrays      -   The arrays to fill.
+// Return Value:
+//          The number of chars filled in, which is less than |count| if the
+//          range runs past the last char, or -1 on error.
+// Comments:
+//          Equivalent to calling FPDFText_GetUnicode(),
+//          FPDFText_GetCharOrigin(), FPDFText_GetCharBox() and
+//          FPDFText_GetFontSize() for each char, but without the per-call
+//          overhead.
+//
+FPDF_EXPORT int FPDF_CALLCONV
+FPDFText_GetCharInfoBatch(FPDF_TEXTPAGE text_page,
+                          int start_index,
+                          int count,
+                          const FPDF_TEXT_CHAR_INFO_ARRAYS* arrays);
+
 // Function: FPDFText_GetCharIndexAtPos
 //          Get the index of a character at or nearby a certain position on the
 //          page.
@@ -477,6 +610,84 @@ FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetBoundedText(FPDF_TEXTPAGE text_page,
                                                       unsigned short* buffer,
                                                       int buflen);
 
+// Experimental API.
+// A line of text on a text page, as FPDFText_GetTextLines() returns it.
+typedef struct FPDF_TEXT_LINE_ {
+  // The chars of the line, not counting the line break that ends it.
+  int char_index;
+  int char_count;
+
+  // The box around the chars of the line, in page coordinates.
+  FS_RECTF bounds;
+
+  // Origins of the first and last chars of the line, in page coordinates.
+  // The baseline of the line runs through both.
+  FS_POINTF baseline_start;
+  FS_POINTF baseline_end;
+
+  // Index of the block the line belongs to, as FPDFText_GetTextBlocks()
+  // returns the blocks.
+  int block_index;
+} FPDF_TEXT_LINE;
+
+// Experimental API.
+// Consecutive lines on a text page that are set close together, such as the
+// lines of a paragraph, as FPDFText_GetTextBlocks() returns them.
+typedef struct FPDF_TEXT_BLOCK_ {
+  // The lines of the block, as FPDFText_GetTextLines() returns the lines.
+  int line_index;
+  int line_count;
+
+  // The box around the lines of the block, in page coordinates.
+  FS_RECTF bounds;
+} FPDF_TEXT_BLOCK;
+
+// Experimental API.
+// Function: FPDFText_GetTextLines
+//          Get the lines of text on a page, in reading order.
+// Parameters:
+//          text_page   -   Handle to a text page information structure.
+//                          Returned by FPDFText_LoadPage function.
+//          lines       -   Caller-allocated array to receive the lines. May
+//                          be NULL.
+//          max_lines   -   Number of lines |lines| can hold.
+// Return value:
+//          The number of lines on the page, which may be more than
+//          |max_lines|, or -1 on error. The first |max_lines| lines are copied
+//          to |lines|.
+// Comments:
+//          Lines are separated by the line breaks in the text of the page, as
+//          FPDFText_GetText() returns it. Lines without any visible chars are
+//          left out. The lines are computed once per text page, so that
+//          repeated calls are cheap.
+//
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetTextLines(FPDF_TEXTPAGE text_page,
+                                                    FPDF_TEXT_LINE* lines,
+                                                    int max_lines);
+
+// Experimental API.
+// Function: FPDFText_GetTextBlocks
+//          Get the blocks of text on a page, in reading order.
+// Parameters:
+//          text_page   -   Handle to a text page information structure.
+//                          Returned by FPDFText_LoadPage function.
+//          blocks      -   Caller-allocated array to receive the blocks. May
+//                          be NULL.
+//          max_blocks  -   Number of blocks |blocks| can hold.
+// Return value:
+//          The number of blocks on the page, which may be more than
+//          |max_blocks|, or -1 on error. The first |max_blocks| blocks are
+//          copied to |blocks|.
+// Comments:
+//          A line starts a new block when the space between it and the line
+//          before it is more than half a line high, or when the two lines do
+//          not overlap along the direction of the text. This is a heuristic;
+//          PDF does not record paragraphs.
+//
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetTextBlocks(FPDF_TEXTPAGE text_page,
+                                                     FPDF_TEXT_BLOCK* blocks,
+                                                     int max_blocks);
+
 // Flags used by FPDFText_FindStart function.
 //
 // If not set, it will not match case by default.
@@ -554,6 +765,239 @@ FPDF_EXPORT int FPDF_CALLCONV FPDFText_GetSchCount(FPDF_SCHHANDLE handle);
 //
 FPDF_EXPORT void FPDF_CALLCONV FPDFText_FindClose(FPDF_SCHHANDLE handle);
 
+// Experimental API.
+// Results of FPDFText_DocFindNext() and FPDFText_DocFindPrev().
+#define FPDF_DOCFIND_NOT_FOUND 0
+#define FPDF_DOCFIND_FOUND 1
+#define FPDF_DOCFIND_TOBECONTINUED 2
+
+// Experimental API.
+// Function: FPDFText_DocFindStart
+//          Start a search across all pages of a document.
+// Parameters:
+//          document        -   Handle to the document.
+//          findwhat        -   A unicode match pattern.
+//          flags           -   Option flags, as for FPDFText_FindStart().
+//          start_page      -   Index number of the page to start on. 0 for
+//                              the first page.
+//          max_cache_bytes -   How much memory, roughly, the text pages kept
+//                              around for the search may take up, in bytes.
+// Return Value:
+//          A handle for the search context, or NULL for invalid arguments.
+//          FPDFText_DocFindClose must be called to release this handle,
+//          before |document| gets closed.
+// Comments:
+//          Pages are loaded as with FPDFText_LoadPageTextOnly(), only when
+//          the search gets to them. The most recently searched pages that
+//          fit in |max_cache_bytes| are kept, so that searching back and
+//          forth does not load them again. The page being searched is always
+//          kept.
+//
+FPDF_EXPORT FPDF_DOCSCHHANDLE FPDF_CALLCONV
+FPDFText_DocFindStart(FPDF_DOCUMENT document,
+                      FPDF_WIDESTRING findwhat,
+                      unsigned long flags,
+                      int start_page,
+                      unsigned long max_cache_bytes);
+
+// Experimental API.
+// Function: FPDFText_DocFindNext
+//          Search towards the end of the document, moving on to the next
+//          page when there are no more matches on the current one.
+// Parameters:
+//          handle      -   A search context handle returned by
+//                          FPDFText_DocFindStart.
+//          pause       -   The IFSDK_PAUSE interface, which is asked before
+//                          each page after the first one searched by this
+//                          call. NULL to search until a match is found.
+// Return Value:
+//          FPDF_DOCFIND_FOUND if a match is found, see
+//          FPDFText_DocFindGetResult(). FPDF_DOCFIND_TOBECONTINUED if |pause|
+//          asked to stop for now, in which case call this function again to
+//          continue. FPDF_DOCFIND_NOT_FOUND if there are no more matches, or
+//          for invalid arguments.
+//
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_DocFindNext(FPDF_DOCSCHHANDLE handle,
+                                                   IFSDK_PAUSE* pause);
+
+// Experimental API.
+// Function: FPDFText_DocFindPrev
+//          Same as FPDFText_DocFindNext(), but towards the start of the
+//          document.
+// Parameters:
+//          handle      -   A search context handle returned by
+//                          FPDFText_DocFindStart.
+//          pause       -   The IFSDK_PAUSE interface, or NULL.
+// Return Value:
+//          Same as for FPDFText_DocFindNext().
+//
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_DocFindPrev(FPDF_DOCSCHHANDLE handle,
+                                                   IFSDK_PAUSE* pause);
+
+// Experimental API.
+// Function: FPDFText_DocFindGetResult
+//          Get the last match found.
+// Parameters:
+//          handle      -   A search context handle returned by
+//                          FPDFText_DocFindStart.
+//          page_index  -   Receives the index number of the page.
+//          char_index  -   Receives the starting character index, as
+//                          FPDFText_GetSchResultIndex() returns it.
+//          char_count  -   Receives the number of matched characters, as
+//                          FPDFText_GetSchCount() returns it.
+// Return Value:
+//          TRUE on success. FALSE if no match has been found yet, or for
+//          invalid arguments, in which case the out parameters are left
+//          unmodified.
+//
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDFText_DocFindGetResult(FPDF_DOCSCHHANDLE handle,
+                          int* page_index,
+                          int* char_index,
+                          int* char_count);
+
+// Experimental API.
+// Function: FPDFText_DocFindClose
+//          Release a search context, along with the text pages it kept.
+// Parameters:
+//          handle      -   A search context handle returned by
+//                          FPDFText_DocFindStart.
+// Return Value:
+//          None.
+//
+FPDF_EXPORT void FPDF_CALLCONV FPDFText_DocFindClose(FPDF_DOCSCHHANDLE handle);
+
+// Experimental API.
+// Where the words of a query occur in a row on a page, as
+// FPDFText_FindInIndex() returns it.
+typedef struct FPDF_TEXT_INDEX_HIT_ {
+  // Index number of the page. 0 for the first page.
+  int page_index;
+
+  // The first char of the match, as FPDFText_GetSchResultIndex() returns it
+  // for a text page loaded from that page.
+  int char_index;
+
+  // Number of chars from |char_index| to the end of the match, as
+  // FPDFText_GetSchCount() returns it.
+  int char_count;
+} FPDF_TEXT_INDEX_HIT;
+
+// Experimental API.
+// Function: FPDFText_CreateIndex
+//          Create an empty index of the words on the pages of a document.
+//          With an index, a document can be searched without loading all of
+//          its pages for every search.
+// Parameters:
+//          None.
+// Return value:
+//          A handle to the index. FPDFText_CloseIndex must be called to
+//          release it.
+// Comments:
+//          Words are runs of letters and digits, compared ignoring case.
+//          CJK ideographs and kana, which are written without spaces, are
+//          words of their own. Call FPDFText_ContinueIndex() to add the pages
+//          of a document to the index.
+//
+FPDF_EXPORT FPDF_TEXTINDEX FPDF_CALLCONV FPDFText_CreateIndex();
+
+// Experimental API.
+// Function: FPDFText_LoadIndex
+//          Load an index saved with FPDFText_SaveIndex().
+// Parameters:
+//          data    -   The saved index.
+//          size    -   Size of |data| in bytes.
+// Return value:
+//          A handle to the index, or NULL if |data| is not a saved index.
+//          FPDFText_CloseIndex must be called to release it.
+// Comments:
+//          An index that was saved before all pages were added to it can be
+//          completed with FPDFText_ContinueIndex().
+//
+FPDF_EXPORT FPDF_TEXTINDEX FPDF_CALLCONV
+FPDFText_LoadIndex(const void* data, unsigned long size);
+
+// Experimental API.
+// Function: FPDFText_ContinueIndex
+//          Add the pages of a document that are not in an index yet.
+// Parameters:
+//          index       -   Handle to the index.
+//          document    -   Handle to the document. Always pass the same
+//                          document for the same index.
+//          pause       -   The IFSDK_PAUSE interface, which is asked after
+//                          each page whether to stop for now. NULL to add all
+//                          remaining pages.
+// Return value:
+//          TRUE if all pages of |document| are in the index. FALSE if
+//          |pause| stopped indexing early, in which case call this function
+//          again later to continue, or for invalid arguments.
+// Comments:
+//          Pages are loaded as with FPDFText_LoadPageTextOnly(), one at a
+//          time, and released once added. Pages that fail to load are added
+//          without any words.
+//
+FPDF_EXPORT FPDF_BOOL FPDF_CALLCONV
+FPDFText_ContinueIndex(FPDF_TEXTINDEX index,
+                       FPDF_DOCUMENT document,
+                       IFSDK_PAUSE* pause);
+
+// Experimental API.
+// Function: FPDFText_GetIndexedPageCount
+//          Get the number of pages in an index.
+// Parameters:
+//          index   -   Handle to the index.
+// Return value:
+//          The number of pages added to |index|, counting from the first
+//          page, or -1 if |index| is NULL.
+//
+FPDF_EXPORT int FPDF_CALLCONV
+FPDFText_GetIndexedPageCount(FPDF_TEXTINDEX index);
+
+// Experimental API.
+// Function: FPDFText_SaveIndex
+//          Save an index, to load it with FPDFText_LoadIndex() later.
+// Parameters:
+//          index   -   Handle to the index.
+//          buffer  -   Buffer for the saved index. May be NULL.
+//          buflen  -   Size of |buffer| in bytes.
+// Return value:
+//          The size of the saved index in bytes, or 0 if |index| is NULL.
+//          |buffer| is only written to if |buflen| is at least that size.
+//
+FPDF_EXPORT unsigned long FPDF_CALLCONV
+FPDFText_SaveIndex(FPDF_TEXTINDEX index, void* buffer, unsigned long buflen);
+
+// Experimental API.
+// Function: FPDFText_FindInIndex
+//          Find where the words of a query occur in a row in an index.
+// Parameters:
+//          index       -   Handle to the index.
+//          query       -   The words to find, as a NUL-terminated UTF-16LE
+//                          string. Any spaces and punctuation in it, or
+//                          between the words on the page, are ignored.
+//          hits        -   Array receiving the matches, ordered by page and
+//                          char index. May be NULL.
+//          max_hits    -   Number of elements in |hits|.
+// Return value:
+//          The total number of matches, which may be more than |max_hits|,
+//          or -1 for invalid arguments. Matches only cover the pages that
+//          have been added to |index|.
+//
+FPDF_EXPORT int FPDF_CALLCONV FPDFText_FindInIndex(FPDF_TEXTINDEX index,
+                                                   FPDF_WIDESTRING query,
+                                                   FPDF_TEXT_INDEX_HIT* hits,
+                                                   int max_hits);
+
+// Experimental API.
+// Function: FPDFText_CloseIndex
+//          Release an index.
+// Parameters:
+//          index   -   Handle to the index.
+// Return value:
+//          None.
+//
+FPDF_EXPORT void FPDF_CALLCONV FPDFText_CloseIndex(FPDF_TEXTINDEX index);
+
 // Function: FPDFLink_LoadWebLinks
 //          Prepare information about weblinks in a page.
 // Parameters:
@@ -67,6 +67,7 @@ typedef struct fpdf_bitmap_t__* FPDF_BITMAP;
 typedef struct fpdf_bookmark_t__* FPDF_BOOKMARK;
 typedef struct fpdf_clippath_t__* FPDF_CLIPPATH;
 typedef struct fpdf_dest_t__* FPDF_DEST;
+typedef struct fpdf_docschhandle_t__* FPDF_DOCSCHHANDLE;
 typedef struct fpdf_document_t__* FPDF_DOCUMENT;
 typedef struct fpdf_font_t__* FPDF_FONT;
 typedef struct fpdf_form_handle_t__* FPDF_FORMHANDLE;
@@ -87,6 +88,7 @@ typedef const struct fpdf_structelement_attr_t__* FPDF_STRUCTELEMENT_ATTR;
 typedef const struct fpdf_structelement_attr_value_t__*
 FPDF_STRUCTELEMENT_ATTR_VALUE;
 typedef struct fpdf_structtree_t__* FPDF_STRUCTTREE;
+typedef struct fpdf_textindex_t__* FPDF_TEXTINDEX;
 typedef struct fpdf_textpage_t__* FPDF_TEXTPAGE;
 typedef struct fpdf_widget_t__* FPDF_WIDGET;
 typedef struct fpdf_xobject_t__* FPDF_XOBJECT;
@@ -280,6 +282,15 @@ typedef struct FPDF_LIBRARY_CONFIG_ {
   // corresponding render library is not included in the build will similarly
   // fail with an immediate crash.
   FPDF_RENDERER_TYPE m_RendererType;
+
+  // Version 5 - Experimental.
+
+  // Number of worker threads PDFium may use, in addition to the calling
+  // thread, to speed up CPU-heavy work such as stretching and transforming
+  // large images. 0 does all work on the calling thread, as in earlier
+  // versions. Results do not depend on the number of threads. PDFium APIs
+  // must still only be called from one thread at a time.
+  unsigned int m_WorkerThreadCount;
 } FPDF_LIBRARY_CONFIG;
 
 // Function: FPDF_InitLibraryWithConfig
@@ -202,6 +202,7 @@ struct Options {
   int first_page = 0;  // First 0-based page number to renderer.
   int last_page = 0;   // Last 0-based page number to renderer.
   time_t time = -1;
+  unsigned int worker_threads = 0;
 };
 
 int PageRenderFlagsFromOptions(const Options& options) {
@@ -752,6 +753,15 @@ bool ParseCommandLine(const std::vector<std::string>& args,
         fprintf(stderr, "Invalid --time argument, must be non-negative\n");
         return false;
       }
+    } else if (ParseSwitchKeyValue(cur_arg, "--worker-threads=", &value)) {
+      int worker_threads = -1;
+      std::stringstream(value) >> worker_threads;
+      if (worker_threads < 0) {
+        fprintf(stderr,
+                "Invalid --worker-threads argument, must be non-negative\n");
+        return false;
+      }
+      options->worker_threads = static_cast<unsigned int>(worker_threads);
     } else if (cur_arg.size() >= 2 && cur_arg[0] == '-' && cur_arg[1] == '-') {
       fprintf(stderr, "Unrecognized argument %s\n", cur_arg.c_str());
       return false;
@@ -1873,6 +1883,7 @@ constexpr char kUsageString[] =
 #endif  // PDF_ENABLE_SKIA
     "  --md5   - write output image paths and their md5 hashes to stdout.\n"
     "  --time=<number> - Seconds since the epoch to set system time.\n"
+    "  --worker-threads=<number> - Number of extra threads PDFium may use.\n"
     "";
 
 void SetUpErrorHandling() {
@@ -1917,11 +1928,12 @@ int main(int argc, const char* argv[]) {
   }
 
   FPDF_LIBRARY_CONFIG config;
-  config.version = 4;
+  config.version = 5;
   config.m_pUserFontPaths = nullptr;
   config.m_pIsolate = nullptr;
   config.m_v8EmbedderSlot = 0;
   config.m_pPlatform = nullptr;
+  config.m_WorkerThreadCount = options.worker_threads;
 
   switch (options.use_renderer_type) {
     case RendererType::kDefault:
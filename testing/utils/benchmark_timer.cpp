@@ -0,0 +1,29 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "testing/utils/benchmark_timer.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <utility>
+
+ScopedBenchmarkTimer::ScopedBenchmarkTimer(std::string label, size_t runs)
+    : label_(std::move(label)),
+      runs_(std::max<size_t>(runs, 1)),
+      start_(std::chrono::steady_clock::now()) {}
+
+ScopedBenchmarkTimer::~ScopedBenchmarkTimer() {
+  const std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start_;
+  const double ns_per_run = elapsed.count() / static_cast<double>(runs_);
+  const char* per_run = runs_ > 1 ? " per run" : "";
+  if (ns_per_run < 1e4) {
+    printf("%s: %.2f ns%s\n", label_.c_str(), ns_per_run, per_run);
+  } else if (ns_per_run < 1e7) {
+    printf("%s: %.2f us%s\n", label_.c_str(), ns_per_run / 1e3, per_run);
+  } else {
+    printf("%s: %.2f ms%s\n", label_.c_str(), ns_per_run / 1e6, per_run);
+  }
+}
@@ -0,0 +1,27 @@
+// Copyright 2026 The PDFium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TESTING_UTILS_BENCHMARK_TIMER_H_
+#define TESTING_UTILS_BENCHMARK_TIMER_H_
+
+#include <stddef.h>
+
+#include <chrono>
+#include <string>
+
+// Times the work done during its lifetime, for the disabled benchmark tests
+// that only run with --gtest_also_run_disabled_tests. On destruction, prints
+// `label` and the elapsed time divided by `runs`.
+class ScopedBenchmarkTimer {
+ public:
+  explicit ScopedBenchmarkTimer(std::string label, size_t runs = 1);
+  ~ScopedBenchmarkTimer();
+
+ private:
+  const std::string label_;
+  const size_t runs_;
+  const std::chrono::steady_clock::time_point start_;
+};
+
+#endif  // TESTING_UTILS_BENCHMARK_TIMER_H_